@@ -18,6 +18,7 @@
 #include <chemist/basis_set/atomic_basis_set.hpp>
 #include <chemist/basis_set/atomic_basis_set_traits.hpp>
 #include <chemist/basis_set/atomic_basis_set_view.hpp>
+#include <span>
 #include <utilities/containers/indexable_container_base.hpp>
 
 namespace chemist::basis_set {
@@ -65,6 +66,20 @@ public:
     /// Traits class holding all of the types related to the AtomicBasisSet
     using abs_traits = AtomicBasisSetTraits<reference>;
 
+    /// Type of a mutable column of contraction coefficients
+    using coefficient_span = std::span<typename abs_traits::coefficient_type>;
+
+    /// Type of a read-only column of contraction coefficients
+    using const_coefficient_span =
+      std::span<const typename abs_traits::coefficient_type>;
+
+    /// Type of a mutable column of exponents
+    using exponent_span = std::span<typename abs_traits::exponent_type>;
+
+    /// Type of a read-only column of exponents
+    using const_exponent_span =
+      std::span<const typename abs_traits::exponent_type>;
+
     // -------------------------------------------------------------------------
     // -- Ctors, assignment, and dtor
     // -------------------------------------------------------------------------
@@ -348,6 +363,25 @@ public:
      */
     typename abs_traits::const_primitive_reference primitive(size_type i) const;
 
+    /** @brief Returns the contraction coefficients or exponents of all of the
+     *         primitives in this basis set as a column.
+     *
+     *  The i-th element of each column belongs to primitive(i). Integral and
+     *  grid kernels should loop over these columns rather than building a
+     *  PrimitiveView per primitive.
+     *
+     *  @return A span over the n_primitives() coefficients or exponents. The
+     *          span is invalidated by adding centers to *this.
+     *
+     *  @throw None No throw guarantee.
+     */
+    ///@{
+    coefficient_span coefficient_column() noexcept;
+    const_coefficient_span coefficient_column() const noexcept;
+    exponent_span exponent_column() noexcept;
+    const_exponent_span exponent_column() const noexcept;
+    ///@}
+
     // -------------------------------------------------------------------------
     // -- Utility functions
     // -------------------------------------------------------------------------
@@ -32,6 +32,8 @@
 #include <chemist/electron/electron.hpp>
 #include <chemist/enums.hpp>
 #include <chemist/fragmenting/fragmenting.hpp>
+#include <chemist/hashing/geometry_fingerprint.hpp>
+#include <chemist/hashing/hashing.hpp>
 #include <chemist/molecule/molecule.hpp>
 #include <chemist/nucleus/nucleus.hpp>
 #include <chemist/point/point.hpp>
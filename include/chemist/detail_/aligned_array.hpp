@@ -0,0 +1,270 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file aligned_array.hpp
+ *
+ *  This file contains the storage used for the columns of the structure-of-
+ *  arrays classes (PointSet, Charges, Grid, etc.). The point of the storage is
+ *  to give vectorized loops an array which starts on a cache line and whose
+ *  length is a whole number of SIMD registers, so that they need neither
+ *  peel nor remainder loops.
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace chemist::detail_ {
+
+/// Alignment (in bytes) of the arrays managed by AlignedArray
+inline constexpr std::size_t simd_alignment = 64;
+
+/** @brief Minimal allocator which returns over-aligned memory.
+ *
+ *  @tparam T The type of the objects being allocated.
+ *  @tparam Alignment The alignment, in bytes, of the returned memory. Must be
+ *                    a power of two and at least alignof(T).
+ */
+template<typename T, std::size_t Alignment = simd_alignment>
+class AlignedAllocator {
+public:
+    static_assert((Alignment & (Alignment - 1)) == 0,
+                  "Alignment must be a power of two");
+    static_assert(Alignment >= alignof(T), "Alignment is too small for T");
+
+    /// Types required by the allocator concept
+    ///@{
+    using value_type = T;
+    using size_type  = std::size_t;
+    ///@}
+
+    /// Rebinds the allocator to a different type, keeping the alignment
+    template<typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template<typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    /// Allocates uninitialized, aligned memory for @p n objects
+    T* allocate(size_type n) {
+        if(n > std::numeric_limits<size_type>::max() / sizeof(T))
+            throw std::bad_array_new_length();
+        auto* p = ::operator new(n * sizeof(T), std::align_val_t{Alignment});
+        return static_cast<T*>(p);
+    }
+
+    /// Releases memory obtained from allocate
+    void deallocate(T* p, size_type) noexcept {
+        ::operator delete(p, std::align_val_t{Alignment});
+    }
+
+    /// All instances are stateless and thus interchangeable
+    template<typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const noexcept {
+        return false;
+    }
+};
+
+/** @brief A contiguous, aligned, and padded array of arithmetic values.
+ *
+ *  AlignedArray behaves like a stripped down std::vector with two additional
+ *  guarantees:
+ *
+ *  - `data()` is aligned to `simd_alignment` bytes, and
+ *  - the allocation holds `padded_size()` elements, which is `size()`
+ *    rounded up to a multiple of `simd_width`. Elements in the range
+ *    [size(), padded_size()) are always value-initialized (i.e., zero).
+ *
+ *  Together these mean loops may always process whole SIMD registers.
+ *
+ *  @tparam T The type of the elements. Assumed to be an arithmetic type.
+ */
+template<typename T>
+class AlignedArray {
+private:
+    /// Type of the storage backing *this
+    using storage_type = std::vector<T, AlignedAllocator<T>>;
+
+public:
+    /// Types mirroring those of std::vector
+    ///@{
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+    ///@}
+
+    /// Number of elements of type T which fit in `simd_alignment` bytes
+    static constexpr size_type simd_width = simd_alignment / sizeof(T);
+
+    /// Rounds @p n up to the nearest multiple of simd_width
+    static constexpr size_type padded_size(size_type n) noexcept {
+        return (n + simd_width - 1) / simd_width * simd_width;
+    }
+
+    /// Creates an empty array
+    AlignedArray() = default;
+
+    /// Creates an array holding @p n copies of @p value
+    explicit AlignedArray(size_type n, value_type value = value_type{}) :
+      m_size_(n), m_buffer_(padded_size(n)) {
+        std::fill_n(m_buffer_.begin(), n, value);
+    }
+
+    /** @brief Creates an array holding a copy of the elements in [begin, end).
+     *
+     *  If the range can be traversed more than once its length is determined
+     *  first, so that the copy requires a single allocation.
+     */
+    template<typename BeginItr, typename EndItr,
+             typename = std::enable_if_t<!std::is_arithmetic_v<BeginItr>>>
+    AlignedArray(BeginItr begin, EndItr end) {
+        using traits_type = std::iterator_traits<BeginItr>;
+        using category    = typename traits_type::iterator_category;
+        using forward_itr = std::forward_iterator_tag;
+        constexpr bool one_pass = !std::is_same_v<BeginItr, EndItr> ||
+                                  !std::is_base_of_v<forward_itr, category>;
+        if constexpr(one_pass) {
+            for(; begin != end; ++begin) push_back(*begin);
+        } else {
+            resize(std::distance(begin, end));
+            std::copy(begin, end, m_buffer_.begin());
+        }
+    }
+
+    /// Creates an array holding a copy of @p values
+    explicit AlignedArray(std::span<const value_type> values) :
+      AlignedArray(values.begin(), values.end()) {}
+
+    /// The number of (non-padding) elements in *this
+    size_type size() const noexcept { return m_size_; }
+
+    /// Is *this empty?
+    bool empty() const noexcept { return m_size_ == 0; }
+
+    /// The number of elements allocated, including padding
+    size_type padded_size() const noexcept { return m_buffer_.size(); }
+
+    /// Ensures *this can hold @p n elements without reallocating
+    void reserve(size_type n) { m_buffer_.reserve(padded_size(n)); }
+
+    /** @brief Changes the number of elements in *this to @p n.
+     *
+     *  New elements (and any padding) are zero. Elements which are removed
+     *  are zeroed so that the padding invariant holds.
+     */
+    void resize(size_type n) {
+        std::fill(m_buffer_.begin() + std::min(n, m_size_),
+                  m_buffer_.begin() + m_size_, value_type{});
+        m_buffer_.resize(padded_size(n));
+        m_size_ = n;
+    }
+
+    /// Removes all elements from *this
+    void clear() noexcept {
+        m_buffer_.clear();
+        m_size_ = 0;
+    }
+
+    /// Appends @p value to *this. Amortized O(1)
+    void push_back(value_type value) {
+        if(m_size_ == m_buffer_.size())
+            m_buffer_.resize(padded_size(m_size_ + 1));
+        m_buffer_[m_size_++] = value;
+    }
+
+    /// Unchecked element access
+    ///@{
+    reference operator[](size_type i) noexcept { return m_buffer_[i]; }
+    const_reference operator[](size_type i) const noexcept {
+        return m_buffer_[i];
+    }
+    ///@}
+
+    /// Bounds-checked element access. Throws std::out_of_range
+    ///@{
+    reference at(size_type i) {
+        bounds_check_(i);
+        return m_buffer_[i];
+    }
+    const_reference at(size_type i) const {
+        bounds_check_(i);
+        return m_buffer_[i];
+    }
+    ///@}
+
+    /// Address of the first element, aligned to simd_alignment bytes
+    ///@{
+    pointer data() noexcept { return m_buffer_.data(); }
+    const_pointer data() const noexcept { return m_buffer_.data(); }
+    ///@}
+
+    /// Iterators over the (non-padding) elements
+    ///@{
+    iterator begin() noexcept { return data(); }
+    const_iterator begin() const noexcept { return data(); }
+    iterator end() noexcept { return data() + m_size_; }
+    const_iterator end() const noexcept { return data() + m_size_; }
+    ///@}
+
+    /// Value comparison of the (non-padding) elements
+    bool operator==(const AlignedArray& rhs) const noexcept {
+        return std::equal(begin(), end(), rhs.begin(), rhs.end());
+    }
+
+    /// Negates operator==
+    bool operator!=(const AlignedArray& rhs) const noexcept {
+        return !(*this == rhs);
+    }
+
+private:
+    /// Throws std::out_of_range if @p i is not a valid element index
+    void bounds_check_(size_type i) const {
+        if(i < m_size_) return;
+        throw std::out_of_range("Index " + std::to_string(i) +
+                                " is not in the range [0, " +
+                                std::to_string(m_size_) + ").");
+    }
+
+    /// The number of (non-padding) elements
+    size_type m_size_ = 0;
+
+    /// The elements, including padding
+    storage_type m_buffer_;
+};
+
+} // namespace chemist::detail_
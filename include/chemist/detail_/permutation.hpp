@@ -0,0 +1,71 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file permutation.hpp
+ *
+ *  Helpers shared by the `permute` members of the container classes. All of
+ *  them use the same convention: applying the permutation `p` to a container
+ *  makes the new i-th element the old `p[i]`-th element.
+ */
+
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace chemist::detail_ {
+
+/// Type used to hold a permutation of the indices [0, n)
+using permutation_type = std::vector<std::size_t>;
+
+/** @brief Ensures @p p is a permutation of [0, @p n).
+ *
+ *  @throw std::runtime_error if @p p does not contain each index in [0, @p n)
+ *                            exactly once. Strong throw guarantee.
+ */
+inline void check_permutation(const permutation_type& p, std::size_t n) {
+    bool is_valid = p.size() == n;
+    std::vector<bool> seen(is_valid ? n : 0, false);
+    for(std::size_t i = 0; is_valid && i < n; ++i) {
+        is_valid = p[i] < n && !seen[p[i]];
+        if(is_valid) seen[p[i]] = true;
+    }
+    if(is_valid) return;
+    throw std::runtime_error("Not a permutation of [0, " + std::to_string(n) +
+                             ")");
+}
+
+/** @brief Reorders @p values so that the new i-th element is the old
+ *         `p[i]`-th element.
+ *
+ *  @tparam ArrayType A random-access container which can be constructed from
+ *                    a size, e.g., std::vector or AlignedArray.
+ *
+ *  It is assumed that @p p has already been checked with check_permutation.
+ *
+ *  @throw std::bad_alloc if allocating the scratch space fails. Strong throw
+ *                        guarantee.
+ */
+template<typename ArrayType>
+void apply_permutation(ArrayType& values, const permutation_type& p) {
+    ArrayType rv(p.size());
+    for(std::size_t i = 0; i < p.size(); ++i) rv[i] = std::move(values[p[i]]);
+    values = std::move(rv);
+}
+
+} // namespace chemist::detail_
@@ -23,4 +23,10 @@ enum class ShellType { cartesian = 0, pure = 1 };
 /// Enumerate gauge types
 enum class GaugeType { length = 0, velocity = 1 };
 
+/// Enumerate space-filling curves which can be used to reorder points
+enum class SpaceFillingCurve { morton = 0, hilbert = 1 };
+
+/// Enumerate the motions geometry fingerprints and comparisons ignore
+enum class GeometryInvariance { translation = 0, rotation = 1 };
+
 } // namespace chemist
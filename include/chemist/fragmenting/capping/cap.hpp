@@ -175,6 +175,9 @@ public:
      */
     size_type get_anchor_index() const { return m_anchor_.value(); }
 
+    /// Has the index of the anchor nucleus been set?
+    bool has_anchor_index() const noexcept { return m_anchor_.has_value(); }
+
     /** @brief Sets the index of the nucleus *this replaces.
      *
      *  This method can be used to set the index of the nucleus being replaced
@@ -200,6 +203,11 @@ public:
      */
     size_type get_replaced_index() const { return m_replaced_.value(); }
 
+    /// Has the index of the replaced nucleus been set?
+    bool has_replaced_index() const noexcept {
+        return m_replaced_.has_value();
+    }
+
     /** @brief Determines if two cap instances are value equal.
      *
      *  Two non-default Cap instances are value equal if they both are
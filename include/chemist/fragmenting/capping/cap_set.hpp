@@ -15,9 +15,12 @@
  */
 
 #pragma once
+#include <algorithm>
 #include <chemist/fragmenting/capping/cap.hpp>
 #include <set>
+#include <span>
 #include <utilities/containers/indexable_container_base.hpp>
+#include <utility>
 #include <vector>
 
 namespace chemist::fragmenting {
@@ -27,6 +30,12 @@ namespace chemist::fragmenting {
  *  When a fragment of a molecule severs covalent bonds, those bonds must be
  *  capped. This class is used to track the caps. For design details see:
  *  https://nwchemex.github.io/Chemist/developer/design/chemistry/caps.html
+ *
+ *  To find the caps of a fragment quickly, *this maintains an index of its
+ *  caps sorted by anchor index. Only the caps whose anchors are in the
+ *  fragment are then looked at, rather than every cap in *this. To keep the
+ *  index correct, element access is read-only; caps are modified with
+ *  set_cap, set_anchor_index, and set_replaced_index.
  */
 class CapSet : public utilities::IndexableContainerBase<CapSet> {
 private:
@@ -37,8 +46,8 @@ public:
     /// Type of each cap
     using value_type = Cap;
 
-    /// Type of a mutable reference to a cap
-    using reference = value_type&;
+    /// Type of a reference to a cap. Read-only, see the class description.
+    using reference = const value_type&;
 
     /// Type of a read-only reference to a cap
     using const_reference = const value_type&;
@@ -61,6 +70,12 @@ public:
     /// Type used to specify a set of indices
     using index_set_type = std::set<size_type>;
 
+    /// Type used to specify a sorted list of indices
+    using sorted_indices_type = std::span<const size_type>;
+
+    /// Type of a mask whose i-th element is true if index i is selected
+    using index_mask_type = std::vector<bool>;
+
     /** @brief Creates ane empty CapSet.
      *
      *  The CapSet resulting from the default ctor has no caps in it. Caps can
@@ -81,7 +96,9 @@ public:
      *  @throw std::bad_alloc if there is a problem allocating memory for the
      *                        initial state. Strong throw guarantee.
      */
-    explicit CapSet(std::initializer_list<value_type> il) : m_caps_(il) {}
+    explicit CapSet(std::initializer_list<value_type> il) : m_caps_(il) {
+        reindex_();
+    }
 
     /** @brief Creates a CapSet from a range of Cap objects.
      *
@@ -103,7 +120,9 @@ public:
      */
     template<typename BeginItr, typename EndItr>
     CapSet(BeginItr&& begin, EndItr&& end) :
-      m_caps_(std::forward<BeginItr>(begin), std::forward<EndItr>(end)) {}
+      m_caps_(std::forward<BeginItr>(begin), std::forward<EndItr>(end)) {
+        reindex_();
+    }
 
     /** @brief Adds @p cap to *this.
      *
@@ -118,7 +137,7 @@ public:
      *  @throw std::bad_alloc if there is a problem allocating memory for
      *                        storing @p cap. Strong throw guarantee.
      */
-    void push_back(value_type cap) { m_caps_.emplace_back(std::move(cap)); }
+    void push_back(value_type cap);
 
     /** @brief Used to construct a cap in place.
      *
@@ -139,15 +158,58 @@ public:
         push_back(value_type(anchor, replaced, std::forward<Args>(atoms)...));
     }
 
+    /** @brief Replaces the @p i-th cap with @p cap.
+     *
+     *  @param[in] i The offset of the cap to replace.
+     *  @param[in] cap The new value of the @p i-th cap.
+     *
+     *  @throw std::out_of_range if @p i is not in the range [0, size()).
+     *                           Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem updating the index. Strong
+     *                        throw guarantee.
+     */
+    void set_cap(size_type i, value_type cap);
+
+    /** @brief Sets the anchor index of the @p i-th cap.
+     *
+     *  This is the same as calling Cap::set_anchor_index on the @p i-th cap,
+     *  except that *this is notified of the change.
+     *
+     *  @param[in] i The offset of the cap to modify.
+     *  @param[in] anchor The index of the nucleus the cap is anchored to.
+     *
+     *  @throw std::out_of_range if @p i is not in the range [0, size()).
+     *                           Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem updating the index. Strong
+     *                        throw guarantee.
+     */
+    void set_anchor_index(size_type i, size_type anchor);
+
+    /** @brief Sets the replaced index of the @p i-th cap.
+     *
+     *  This is the same as calling Cap::set_replaced_index on the @p i-th
+     *  cap, except that *this is notified of the change.
+     *
+     *  @param[in] i The offset of the cap to modify.
+     *  @param[in] replaced The index of the nucleus the cap replaces.
+     *
+     *  @throw std::out_of_range if @p i is not in the range [0, size()).
+     *                           Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem updating the index. Strong
+     *                        throw guarantee.
+     */
+    void set_replaced_index(size_type i, size_type replaced);
+
     /** @brief Retrieves the set of caps for a set of indices.
      *
      *  @tparam BeingItr The type of the iterator pointing to the first index.
      *  @tparam EndItr   The type of the iterator pointing to just past the last
      *                   index.
      *
-     *  This method fills in an object of type `index_set_type` from the
-     *  provided iterators and then dispatches to get_caps(index_set_type).
-     *  See the description for get_caps(index_set_type) for more details.
+     *  This method copies the provided indices into a sorted list and then
+     *  dispatches to get_cap_indices(sorted_indices_type). See the
+     *  description for get_cap_indices(const index_set_type&) for more
+     *  details.
      *
      *  @param[in,out] begin An iterator pointing to the first index. After
      *                       this method is called @p begin will be equal to
@@ -164,8 +226,8 @@ public:
      */
     template<typename BeginItr, typename EndItr>
     index_set_type get_cap_indices(BeginItr&& begin, EndItr&& end) const {
-        return get_cap_indices(index_set_type(std::forward<BeginItr>(begin),
-                                              std::forward<EndItr>(end)));
+        return get_cap_indices(sorted_indices_type(
+          sort_(std::forward<BeginItr>(begin), std::forward<EndItr>(end))));
     }
 
     /** @brief Retrieves the set of cap indices for a set fragment indices.
@@ -174,7 +236,8 @@ public:
      *  which  are in the fragment. If any of those indices is an anchor index
      *  and the corresponding replaced index is not in the fragment, then a
      *  bond has been broken. This method returns the indices of the caps
-     *  needed for the input fragment.
+     *  needed for the input fragment. Caps which are missing their anchor or
+     *  replaced index are never needed.
      *
      *  @param[in] fragment_indices Indices for the elements which are in the
      *                              fragment.
@@ -187,6 +250,43 @@ public:
     index_set_type get_cap_indices(
       const index_set_type& fragment_indices) const;
 
+    /** @brief Retrieves the set of cap indices for a sorted list of fragment
+     *         indices.
+     *
+     *  This overload avoids building an index_set_type when the fragment is
+     *  already stored as a sorted list (repeated indices are allowed). It is
+     *  otherwise the same as get_cap_indices(const index_set_type&).
+     *
+     *  @param[in] fragment_indices Indices for the elements which are in the
+     *                              fragment, in ascending order.
+     *
+     *  @return A container with the indices of the caps needed for the
+     *          fragment.
+     *
+     *  @throw std::runtime_error if @p fragment_indices is not sorted. Strong
+     *                            throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    index_set_type get_cap_indices(sorted_indices_type fragment_indices) const;
+
+    /** @brief Retrieves the set of cap indices for a fragment given as a mask.
+     *
+     *  This overload is the same as get_cap_indices(const index_set_type&)
+     *  except that element @f$i@f$ of @p fragment_mask is true if index
+     *  @f$i@f$ is in the fragment. Indices past the end of @p fragment_mask
+     *  are not in the fragment.
+     *
+     *  @param[in] fragment_mask Which elements are in the fragment.
+     *
+     *  @return A container with the indices of the caps needed for the
+     *          fragment.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    index_set_type get_cap_indices(const index_mask_type& fragment_mask) const;
+
     /** @brief Returns the nuclei needed to cap the input fragment.
      *
      *  @tparam BeginItr The type of the iterator that points to the index of
@@ -194,9 +294,8 @@ public:
      *  @tparam EndItr   The type of the iterator that points to just past the
      *                   index of the last nucleus.
      *
-     *  This method uses the provided iterators to initialize a container of
-     *  type index_set_type. The resulting container is then forwarded to
-     *  get_cap_nuclei(const index_set_type&). See the documentation of
+     *  This method finds the caps of the fragment with the iterator overload
+     *  of get_cap_indices and returns their nuclei. See the documentation of
      *  get_cap_nuclei(const index_set_type&) for more details.
      *
      *  @param[in,out] begin The iterator which points to the index of the
@@ -215,8 +314,8 @@ public:
      */
     template<typename BeginItr, typename EndItr>
     nuclei_reference get_cap_nuclei(BeginItr&& begin, EndItr&& end) {
-        return get_cap_nuclei(index_set_type(std::forward<BeginItr>(begin),
-                                             std::forward<EndItr>(end)));
+        return get_cap_nuclei(sorted_indices_type(
+          sort_(std::forward<BeginItr>(begin), std::forward<EndItr>(end))));
     }
 
     /** @brief Returns the nuclei needed to cap @p fragment_indices.
@@ -236,6 +335,26 @@ public:
      */
     nuclei_reference get_cap_nuclei(const index_set_type& fragment_indices);
 
+    /** @brief Returns the nuclei needed to cap a fragment given as a sorted
+     *         list of indices.
+     *
+     *  This overload is the same as get_cap_nuclei(const index_set_type&)
+     *  except that the fragment is specified as in
+     *  get_cap_indices(sorted_indices_type).
+     *
+     *  @param[in] fragment_indices The indices of the nuclei in the fragment,
+     *                              in ascending order.
+     *
+     *  @return A mutable view of a Nuclei object containing the nuclei needed
+     *          to cap the input fragment.
+     *
+     *  @throw std::runtime_error if @p fragment_indices is not sorted. Strong
+     *                            throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    nuclei_reference get_cap_nuclei(sorted_indices_type fragment_indices);
+
     /** @brief Returns the nuclei needed to cap the input fragment.
      *
      *  @tparam BeginItr The type of the iterator that points to the index of
@@ -263,8 +382,8 @@ public:
     template<typename BeginItr, typename EndItr>
     const_nuclei_reference get_cap_nuclei(BeginItr&& begin,
                                           EndItr&& end) const {
-        return get_cap_nuclei(index_set_type(std::forward<BeginItr>(begin),
-                                             std::forward<EndItr>(end)));
+        return get_cap_nuclei(sorted_indices_type(
+          sort_(std::forward<BeginItr>(begin), std::forward<EndItr>(end))));
     }
 
     /** @brief Returns the nuclei needed to cap @p fragment_indices.
@@ -283,6 +402,47 @@ public:
     const_nuclei_reference get_cap_nuclei(
       const index_set_type& fragment_indices) const;
 
+    /** @brief Returns the nuclei needed to cap a fragment given as a sorted
+     *         list of indices.
+     *
+     *  This method is the same as the non-const version except that the
+     *  resulting view is read-only.
+     *
+     *  @param[in] fragment_indices The indices of the nuclei in the fragment,
+     *                              in ascending order.
+     *
+     *  @return A read-only view of a Nuclei object containing the nuclei needed
+     *          to cap the input fragment.
+     *
+     *  @throw std::runtime_error if @p fragment_indices is not sorted. Strong
+     *                            throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    const_nuclei_reference get_cap_nuclei(
+      sorted_indices_type fragment_indices) const;
+
+    /** @brief Returns the nuclei of the caps in @p cap_indices.
+     *
+     *  This method is used when the caps of a fragment are already known,
+     *  e.g., because they were found by get_cap_indices() and stored. The
+     *  nuclei of the caps are combined, in the order of @p cap_indices, into
+     *  a Nuclei object and a view of that object is returned.
+     *
+     *  @param[in] cap_indices The offsets of the caps in *this.
+     *
+     *  @return A view of a Nuclei object containing the nuclei of the caps.
+     *
+     *  @throw std::out_of_range if any index in @p cap_indices is not in the
+     *                           range [0, size()). Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    ///@{
+    nuclei_reference get_nuclei(const index_set_type& cap_indices);
+    const_nuclei_reference get_nuclei(const index_set_type& cap_indices) const;
+    ///@}
+
 private:
     /// Allows the base to implement *this via CRTP
     friend base_type;
@@ -290,10 +450,26 @@ private:
     /// Container the caps are stored in
     using cap_set = std::vector<value_type>;
 
-    /// Used to implement operator[]/at
-    reference at_(size_type i) noexcept { return m_caps_[i]; }
+    /// Type of an entry in the index, the anchor and the offset of the cap
+    using anchor_entry_type = std::pair<size_type, size_type>;
+
+    /// Type of the index
+    using anchor_index_type = std::vector<anchor_entry_type>;
+
+    /// Returns the indices in [begin, end) as a sorted list
+    template<typename BeginItr, typename EndItr>
+    static std::vector<size_type> sort_(BeginItr&& begin, EndItr&& end);
+
+    /// Rebuilds m_anchors_ from m_caps_
+    void reindex_();
 
-    /// Used to implement operator[] const/at const
+    /// Adds the i-th cap to m_anchors_. Space for it must be reserved.
+    void index_(size_type i);
+
+    /// Removes the i-th cap from m_anchors_
+    void unindex_(size_type i) noexcept;
+
+    /// Used to implement operator[]/at (both const and non-const)
     const_reference at_(size_type i) const noexcept { return m_caps_[i]; }
 
     /// Used to implement size()
@@ -301,6 +477,22 @@ private:
 
     /// The actual caps in this set
     cap_set m_caps_;
+
+    /// (anchor, offset) for caps with an anchor and replaced index, sorted
+    anchor_index_type m_anchors_;
 };
 
+// -----------------------------------------------------------------------------
+// -- Inline implementations
+// -----------------------------------------------------------------------------
+
+template<typename BeginItr, typename EndItr>
+std::vector<typename CapSet::size_type> CapSet::sort_(BeginItr&& begin,
+                                                      EndItr&& end) {
+    std::vector<size_type> rv(std::forward<BeginItr>(begin),
+                              std::forward<EndItr>(end));
+    std::sort(rv.begin(), rv.end());
+    return rv;
+}
+
 } // namespace chemist::fragmenting
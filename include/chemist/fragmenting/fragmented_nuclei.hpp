@@ -310,7 +310,9 @@ public:
      *  @p nuclei. To map the elements in @p nuclei to the supersystem in *this,
      *  this method relies on value equality. N.b., that such comparisons
      *  involve floating point comparisons and thus users are strongly suggested
-     *  to use the elements of `supersystem()` directly.
+     *  to use the elements of `supersystem()` directly. Elements which alias
+     *  a nucleus of `supersystem()` map to that nucleus, other elements map to
+     *  the first nucleus of `supersystem()` they compare equal to.
      *
      *  @param[in] nuclei The objects to associate with the fragment.
      *
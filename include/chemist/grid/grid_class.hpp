@@ -15,9 +15,13 @@
  */
 
 #pragma once
+#include <chemist/detail_/aligned_array.hpp>
+#include <chemist/detail_/permutation.hpp>
 #include <chemist/grid/grid_point.hpp>
 #include <chemist/grid/grid_point_view.hpp>
 #include <chemist/point/point_set.hpp>
+#include <chemist/point/space_filling_curve.hpp>
+#include <span>
 #include <utilities/containers/indexable_container_base.hpp>
 
 namespace chemist {
@@ -49,6 +53,10 @@ public:
     /// Type storing the Cartesian coordinates of each grid point
     using point_set_type = typename traits_type::point_set_type;
 
+    /// Type acting like a read-only reference to the coordinates
+    using const_point_set_reference =
+      typename point_set_traits::const_view_type;
+
     /// Type of a grid point
     using value_type = typename traits_type::grid_point_type;
 
@@ -58,6 +66,30 @@ public:
     /// Type acting like a read-only reference to a grid point
     using const_reference = typename grid_point_traits::const_view_type;
 
+    /// Type used to store the weight of a grid point
+    using weight_type = typename value_type::weight_type;
+
+    /// Type of a pointer to a weight
+    using weight_pointer = weight_type*;
+
+    /// Type of a read-only pointer to a weight
+    using const_weight_pointer = const weight_type*;
+
+    /// Type of a mutable, contiguous column of weights
+    using weight_span = std::span<weight_type>;
+
+    /// Type of a read-only, contiguous column of weights
+    using const_weight_span = std::span<const weight_type>;
+
+    /// Type of a read-only, contiguous column of coordinates
+    using const_coord_span = typename point_set_type::const_coord_span;
+
+    /// Type used to describe a reordering of the grid points in *this
+    using permutation_type = typename point_set_type::permutation_type;
+
+    /// Alignment, in bytes, of the pointer returned by weight_data()
+    static constexpr size_type data_alignment = detail_::simd_alignment;
+
     // -------------------------------------------------------------------------
     // -- Ctors
     // -------------------------------------------------------------------------
@@ -100,10 +132,135 @@ public:
         }
     }
 
-private:
-    /// Type used to store the weight of a grid point
-    using weight_type = typename value_type::weight_type;
+    // -------------------------------------------------------------------------
+    // -- Setters
+    // -------------------------------------------------------------------------
+
+    /** @brief Reorders the grid points in *this according to @p p.
+     *
+     *  After this call the i-th grid point of *this is the grid point which
+     *  was previously the `p[i]`-th grid point. The weights are permuted along
+     *  with the coordinates.
+     *
+     *  @param[in] p A permutation of [0, size()).
+     *
+     *  @throw std::runtime_error if @p p is not a permutation of [0, size()).
+     *                            Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    void permute(const permutation_type& p) {
+        detail_::check_permutation(p, size());
+        auto weights = m_weights_;
+        detail_::apply_permutation(weights, p);
+        m_points_.permute(p);
+        m_weights_ = std::move(weights);
+    }
+
+    /** @brief Sorts the grid points in *this along a space-filling curve.
+     *
+     *  Quadratures are usually evaluated in batches of grid points. Sorting
+     *  the grid points along a space-filling curve makes each batch spatially
+     *  compact, which improves screening. See PointSet::reorder for details.
+     *
+     *  @param[in] curve The space-filling curve to sort along. Defaults to
+     *                   Hilbert.
+     *
+     *  @return The permutation which was applied to *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    permutation_type reorder(
+      SpaceFillingCurve curve = SpaceFillingCurve::hilbert) {
+        auto p = space_filling_curve_order(m_points_, curve);
+        permute(p);
+        return p;
+    }
+
+    // -------------------------------------------------------------------------
+    // -- Accessors
+    // -------------------------------------------------------------------------
 
+    /** @brief Returns a mutable pointer to the first weight.
+     *
+     *  The weights are stored contiguously. The array is aligned to
+     *  `data_alignment` bytes and zero-padded to a whole number of SIMD
+     *  registers, i.e., the same layout as the coordinate arrays of a
+     *  PointSet.
+     *
+     *  @return A pointer to the first weight. If *this is empty the result is
+     *          a null pointer.
+     *
+     *  @throw None No throw guarantee.
+     */
+    weight_pointer weight_data() noexcept {
+        return size() ? m_weights_.data() : nullptr;
+    }
+
+    /** @brief Returns a read-only pointer to the first weight.
+     *
+     *  This method is the same as the non-const version except that the
+     *  resulting pointer is read-only.
+     *
+     *  @return A pointer to the first weight or a null pointer.
+     *
+     *  @throw None No throw guarantee.
+     */
+    const_weight_pointer weight_data() const noexcept {
+        return size() ? m_weights_.data() : nullptr;
+    }
+
+    /** @brief Returns the weights of the grid points as a column.
+     *
+     *  Quadrature loops should run over weight_column() and x_column(), etc.
+     *  rather than over `(*this)[i]`, which builds a GridPointView for each
+     *  grid point.
+     *
+     *  @return A span over the size() weights (no padding).
+     *
+     *  @throw None No throw guarantee.
+     */
+    ///@{
+    weight_span weight_column() noexcept {
+        return weight_span(weight_data(), size_());
+    }
+    const_weight_span weight_column() const noexcept {
+        return const_weight_span(weight_data(), size_());
+    }
+    ///@}
+
+    /** @brief Returns the x-, y-, or z-coordinates of the grid points as a
+     *         column.
+     *
+     *  The coordinates are read-only because changing them would also change
+     *  the meaning of the weights.
+     *
+     *  @return A span over the size() coordinates.
+     *
+     *  @throw None No throw guarantee.
+     */
+    ///@{
+    const_coord_span x_column() const noexcept { return m_points_.x_column(); }
+    const_coord_span y_column() const noexcept { return m_points_.y_column(); }
+    const_coord_span z_column() const noexcept { return m_points_.z_column(); }
+    ///@}
+
+    /** @brief Returns the coordinates of the grid points.
+     *
+     *  This is useful for passing the grid points to algorithms written in
+     *  terms of PointSet objects, e.g., SpatialIndex.
+     *
+     *  @return A read-only view of the coordinates of the grid points.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the view.
+     *                        Strong throw guarantee.
+     */
+    const_point_set_reference point_set() const {
+        return const_point_set_reference(m_points_);
+    }
+
+private:
     /// Allows the base to access the implementations of at_ and size_
     friend base_type;
 
@@ -121,7 +278,7 @@ private:
     size_type size_() const noexcept { return m_weights_.size(); }
 
     /// Holds the weights of the grid points
-    std::vector<weight_type> m_weights_;
+    detail_::AlignedArray<weight_type> m_weights_;
 
     /// Holds the Cartesian coordinates of the grid points.
     point_set_type m_points_;
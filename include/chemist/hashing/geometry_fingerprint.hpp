@@ -0,0 +1,154 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file geometry_fingerprint.hpp
+ *
+ *  Tolerant fingerprints and comparisons of geometries. Geometry
+ *  optimizations, scans, and fragment-based methods produce geometries which
+ *  differ only by floating-point noise. Such geometries have different
+ *  content hashes and do not compare equal, so caches keyed on them miss.
+ *
+ *  geometry_fingerprint() quantizes the coordinates to a grid whose spacing
+ *  is a user-provided tolerance, after removing the centroid (and, if
+ *  requested, the orientation), and hashes the result. Geometries which are
+ *  the same to within the tolerance usually have the same fingerprint.
+ *  Quantization can not make this a guarantee (noise may push a coordinate
+ *  across a grid boundary), nor can it ensure that geometries with the same
+ *  fingerprint are within the tolerance, so a fingerprint hit should be
+ *  confirmed with same_geometry(), which compares the root-mean-square
+ *  deviation (RMSD) of the two geometries with the tolerance.
+ *
+ *  With GeometryInvariance::translation the geometries are compared after
+ *  moving their centroids to the origin. With GeometryInvariance::rotation
+ *  they are additionally optimally rotated onto each other (the Kabsch
+ *  problem, solved here with Horn's quaternion method). In that case the
+ *  fingerprint hashes the distance of each point from the centroid and from
+ *  the next point, which do not depend on the orientation.
+ *
+ *  Points are compared in the order they are stored, i.e., the fingerprints
+ *  and comparisons do not try to match up permuted atoms. For Nuclei and
+ *  Molecule objects everything besides the coordinates (names, atomic
+ *  numbers, masses, charges, the molecular charge and multiplicity) must
+ *  match exactly.
+ */
+#pragma once
+#include <chemist/enums.hpp>
+#include <chemist/hashing/hasher.hpp>
+#include <chemist/molecule/molecule_class.hpp>
+#include <chemist/nucleus/nuclei.hpp>
+#include <chemist/point/point_set.hpp>
+
+namespace chemist::hashing {
+
+/** @brief Computes a fingerprint of the geometry of @p points.
+ *
+ *  @tparam T The floating-point type of the coordinates.
+ *
+ *  @param[in] points The geometry to fingerprint.
+ *  @param[in] tolerance The spacing of the grid the coordinates are rounded
+ *                       to. Must be positive.
+ *  @param[in] invariance Which rigid motions the fingerprint should ignore.
+ *                        Defaults to translations only.
+ *
+ *  @return A 64-bit fingerprint of the geometry.
+ *
+ *  @throw std::runtime_error if @p tolerance is not positive. Strong throw
+ *                            guarantee.
+ *  @throw std::bad_alloc if there is a problem gathering the coordinates.
+ *                        Strong throw guarantee.
+ */
+template<typename T>
+Hasher::hash_type geometry_fingerprint(
+  const PointSet<T>& points, double tolerance,
+  GeometryInvariance invariance = GeometryInvariance::translation);
+
+/** @brief Computes a fingerprint of @p nuclei or @p molecule.
+ *
+ *  These overloads fingerprint the coordinates like the PointSet overload
+ *  and hash the remaining state exactly. See the PointSet overload for
+ *  details.
+ */
+///@{
+Hasher::hash_type geometry_fingerprint(
+  const Nuclei& nuclei, double tolerance,
+  GeometryInvariance invariance = GeometryInvariance::translation);
+
+Hasher::hash_type geometry_fingerprint(
+  const Molecule& molecule, double tolerance,
+  GeometryInvariance invariance = GeometryInvariance::translation);
+///@}
+
+/** @brief Computes the RMSD between the geometries @p lhs and @p rhs.
+ *
+ *  The i-th point of @p lhs is paired with the i-th point of @p rhs. Both
+ *  geometries are centered on their centroids and, for
+ *  GeometryInvariance::rotation, @p rhs is optimally rotated onto @p lhs
+ *  (proper rotations only, mirror images are not superimposed).
+ *
+ *  @tparam T The floating-point type of the coordinates.
+ *
+ *  @param[in] lhs The first geometry.
+ *  @param[in] rhs The second geometry.
+ *  @param[in] invariance Which rigid motions to remove before comparing.
+ *                        Defaults to translations only.
+ *
+ *  @return The RMSD of the two geometries (0 if both are empty).
+ *
+ *  @throw std::runtime_error if @p lhs and @p rhs have different sizes.
+ *                            Strong throw guarantee.
+ *  @throw std::bad_alloc if there is a problem gathering the coordinates.
+ *                        Strong throw guarantee.
+ */
+template<typename T>
+double geometry_rmsd(
+  const PointSet<T>& lhs, const PointSet<T>& rhs,
+  GeometryInvariance invariance = GeometryInvariance::translation);
+
+/** @brief Determines if two geometries are the same to within @p tolerance.
+ *
+ *  Two geometries are the same if they have the same number of points, all
+ *  non-geometric state is equal, and their RMSD (see geometry_rmsd) is less
+ *  than or equal to @p tolerance. This is the check a fingerprint hit should
+ *  be confirmed with.
+ *
+ *  @param[in] lhs The first geometry.
+ *  @param[in] rhs The second geometry.
+ *  @param[in] tolerance The largest RMSD for which the geometries are the
+ *                       same.
+ *  @param[in] invariance Which rigid motions to remove before comparing.
+ *                        Defaults to translations only.
+ *
+ *  @return True if the geometries are the same and false otherwise.
+ *
+ *  @throw std::bad_alloc if there is a problem gathering the coordinates.
+ *                        Strong throw guarantee.
+ */
+///@{
+template<typename T>
+bool same_geometry(
+  const PointSet<T>& lhs, const PointSet<T>& rhs, double tolerance,
+  GeometryInvariance invariance = GeometryInvariance::translation);
+
+bool same_geometry(
+  const Nuclei& lhs, const Nuclei& rhs, double tolerance,
+  GeometryInvariance invariance = GeometryInvariance::translation);
+
+bool same_geometry(
+  const Molecule& lhs, const Molecule& rhs, double tolerance,
+  GeometryInvariance invariance = GeometryInvariance::translation);
+///@}
+
+} // namespace chemist::hashing
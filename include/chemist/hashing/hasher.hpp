@@ -0,0 +1,189 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+namespace chemist::hashing {
+
+/** @brief Accumulates a stable 64-bit or 128-bit hash of a stream of values.
+ *
+ *  Hasher is the building block of Chemist's content hashes. Values are fed
+ *  to it one at a time with add() and the hash of everything fed so far is
+ *  retrieved with digest() or digest128(). The hash only depends on the
+ *  values (and the order they were added in), not on the address of the
+ *  values or on the process, i.e., hashes can be stored and compared across
+ *  runs and machines.
+ *
+ *  Internally each value is turned into one or more 64-bit words, which are
+ *  mixed into two independent accumulators using the round function of
+ *  xxHash64. digest128() finalizes both accumulators, digest() only the first
+ *  one (it is always the first word of digest128()).
+ *
+ *  Floating-point values are hashed by value: both zeros hash the same and
+ *  all NaNs hash the same. Floating-point values are also promoted to double
+ *  first, so a float and a double with the same value hash the same.
+ */
+class Hasher {
+public:
+    /// Type of a 64-bit hash
+    using hash_type = std::uint64_t;
+
+    /// Type of a 128-bit hash, stored as two 64-bit words
+    using hash128_type = std::array<hash_type, 2>;
+
+    /// Type of the words mixed into the hash
+    using word_type = std::uint64_t;
+
+    /** @brief Creates a Hasher which has not seen any values.
+     *
+     *  @param[in] seed Hashes computed with different seeds are unrelated.
+     *                  Defaults to 0.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit Hasher(word_type seed = 0) noexcept :
+      m_h0_(seed + m_p1_ + m_p2_), m_h1_(seed - m_p1_) {}
+
+    /** @brief Mixes a value into the hash.
+     *
+     *  Integral, enumeration, and boolean values are hashed as the 64-bit
+     *  word with the same value. Floating-point values are hashed as the bits
+     *  of the equivalent double (see the class description for how zeros and
+     *  NaNs are handled). Strings are hashed as their length followed by
+     *  their characters.
+     *
+     *  @param[in] value The value to add.
+     *
+     *  @return *this after adding @p value to it.
+     *
+     *  @throw None No throw guarantee.
+     */
+    ///@{
+    template<typename T>
+        requires(std::is_arithmetic_v<T> || std::is_enum_v<T>)
+    Hasher& add(T value) noexcept {
+        if constexpr(std::is_floating_point_v<T>) {
+            double v = value;
+            if(v == 0.0) v = 0.0;
+            if(std::isnan(v)) v = std::numeric_limits<double>::quiet_NaN();
+            return add_word(std::bit_cast<word_type>(v));
+        } else if constexpr(std::is_enum_v<T>) {
+            using underlying_type = std::underlying_type_t<T>;
+            return add_word(static_cast<underlying_type>(value));
+        } else {
+            return add_word(static_cast<word_type>(value));
+        }
+    }
+
+    Hasher& add(std::string_view value) noexcept {
+        add_word(value.size());
+        word_type word = 0;
+        std::size_t i  = 0;
+        for(; i < value.size(); ++i) {
+            word |= word_type(static_cast<unsigned char>(value[i]))
+                    << (8 * (i % 8));
+            if(i % 8 == 7) {
+                add_word(word);
+                word = 0;
+            }
+        }
+        if(i % 8) add_word(word);
+        return *this;
+    }
+    ///@}
+
+    /** @brief Mixes each of the @p n values pointed to by @p values into the
+     *         hash.
+     *
+     *  This is the same as calling add() on each value in turn.
+     *
+     *  @param[in] values A pointer to the first value.
+     *  @param[in] n The number of values to add.
+     *
+     *  @return *this after adding the values to it.
+     *
+     *  @throw None No throw guarantee.
+     */
+    template<typename T>
+    Hasher& add_range(const T* values, std::size_t n) noexcept {
+        for(std::size_t i = 0; i < n; ++i) add(values[i]);
+        return *this;
+    }
+
+    /** @brief Mixes a raw 64-bit word into the hash.
+     *
+     *  @param[in] word The word to add.
+     *
+     *  @return *this after adding @p word to it.
+     *
+     *  @throw None No throw guarantee.
+     */
+    Hasher& add_word(word_type word) noexcept {
+        m_h0_ = round_(m_h0_, word);
+        m_h1_ = round_(m_h1_, ~word);
+        ++m_n_;
+        return *this;
+    }
+
+    /// The 64-bit hash of the values added so far
+    hash_type digest() const noexcept { return avalanche_(m_h0_ + m_n_); }
+
+    /// The 128-bit hash of the values added so far
+    hash128_type digest128() const noexcept {
+        return {digest(), avalanche_(m_h1_ ^ (m_n_ * m_p3_))};
+    }
+
+private:
+    /// The primes used by xxHash64
+    ///@{
+    static constexpr word_type m_p1_ = 0x9E3779B185EBCA87ull;
+    static constexpr word_type m_p2_ = 0xC2B2AE3D27D4EB4Full;
+    static constexpr word_type m_p3_ = 0x165667B19E3779F9ull;
+    ///@}
+
+    /// Mixes @p word into the accumulator @p acc
+    static word_type round_(word_type acc, word_type word) noexcept {
+        acc += word * m_p2_;
+        acc = std::rotl(acc, 31);
+        return acc * m_p1_;
+    }
+
+    /// Ensures every bit of @p h affects every bit of the result
+    static word_type avalanche_(word_type h) noexcept {
+        h ^= h >> 33;
+        h *= m_p2_;
+        h ^= h >> 29;
+        h *= m_p3_;
+        h ^= h >> 32;
+        return h;
+    }
+
+    /// The accumulators
+    word_type m_h0_;
+    word_type m_h1_;
+
+    /// The number of words added so far
+    word_type m_n_ = 0;
+};
+
+} // namespace chemist::hashing
@@ -0,0 +1,338 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file hashing.hpp
+ *
+ *  Content hashes for Chemist's value and view types. The content hash of an
+ *  object only depends on its value, i.e., objects which compare equal with
+ *  operator== have the same hash. In particular, a view has the same hash as
+ *  the object it aliases (and as any other view aliasing an equal object),
+ *  regardless of how the view stores its state. Hashes are stable, i.e., they
+ *  do not depend on addresses and can be persisted, e.g., as cache keys.
+ *
+ *  Each supported type has a `hash_append` overload which feeds the type's
+ *  value into a Hasher. Containers feed their size followed by each of their
+ *  elements, so the hash of a container can also be computed element by
+ *  element. Containers which store their state as contiguous columns are
+ *  hashed straight out of the columns, without creating views of the
+ *  elements.
+ *
+ *  Hashes are computed on demand. Views can modify the state of the objects
+ *  they alias, so a cached hash could silently become stale; computing the
+ *  hash costs one pass over the state, which is the same as comparing two
+ *  objects with operator==.
+ *
+ *  This header also specializes std::hash for the supported types so that
+ *  they can be used as keys of, e.g., std::unordered_map.
+ */
+#pragma once
+#include <chemist/basis_set/basis_set.hpp>
+#include <chemist/chemical_system/chemical_system.hpp>
+#include <chemist/fragmenting/fragmenting.hpp>
+#include <chemist/hashing/hasher.hpp>
+#include <chemist/molecule/molecule.hpp>
+#include <chemist/nucleus/nucleus.hpp>
+#include <chemist/point/point.hpp>
+#include <chemist/point_charge/point_charge.hpp>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace chemist::hashing {
+
+/// Type of a 64-bit content hash
+using hash_type = typename Hasher::hash_type;
+
+/// Type of a 128-bit content hash
+using hash128_type = typename Hasher::hash128_type;
+
+// -- Points and point charges -------------------------------------------------
+
+/** @brief Feeds the value of a point, point charge, or nucleus into @p h.
+ *
+ *  Points are hashed as their x, y, and z coordinates. Point charges are
+ *  hashed as their point followed by their charge. Nuclei are hashed as
+ *  their name, atomic number, and mass followed by their point charge.
+ *
+ *  @param[in,out] h The Hasher to feed the value into.
+ *  @param[in] object The object to hash.
+ *
+ *  @throw None No throw guarantee.
+ */
+///@{
+template<typename T>
+void hash_append(Hasher& h, const Point<T>& object) {
+    h.add(object.x()).add(object.y()).add(object.z());
+}
+
+template<typename PointType>
+void hash_append(Hasher& h, const PointView<PointType>& object) {
+    h.add(object.x()).add(object.y()).add(object.z());
+}
+
+template<typename T>
+void hash_append(Hasher& h, const PointCharge<T>& object) {
+    h.add(object.x()).add(object.y()).add(object.z()).add(object.charge());
+}
+
+template<typename ChargeType>
+void hash_append(Hasher& h, const PointChargeView<ChargeType>& object) {
+    h.add(object.x()).add(object.y()).add(object.z()).add(object.charge());
+}
+
+void hash_append(Hasher& h, const Nucleus& object);
+
+template<typename NucleusType>
+void hash_append(Hasher& h, const NucleusView<NucleusType>& object) {
+    const std::string& name = object.name();
+    h.add(std::string_view(name)).add(object.Z()).add(object.mass());
+    h.add(object.x()).add(object.y()).add(object.z()).add(object.charge());
+}
+///@}
+
+// -- Containers of points and point charges -----------------------------------
+
+/** @brief Feeds the value of a container of points, point charges, or nuclei
+ *         into @p h.
+ *
+ *  Containers are hashed as their size followed by each of their elements.
+ *
+ *  @param[in,out] h The Hasher to feed the value into.
+ *  @param[in] object The object to hash.
+ *
+ *  @throw None No throw guarantee.
+ */
+///@{
+template<typename T>
+void hash_append(Hasher& h, const PointSet<T>& object);
+
+template<typename PointSetType>
+void hash_append(Hasher& h, const PointSetView<PointSetType>& object);
+
+template<typename T>
+void hash_append(Hasher& h, const Charges<T>& object);
+
+template<typename ChargesType>
+void hash_append(Hasher& h, const ChargesView<ChargesType>& object);
+
+void hash_append(Hasher& h, const Nuclei& object);
+
+template<typename NucleiType>
+void hash_append(Hasher& h, const NucleiView<NucleiType>& object);
+///@}
+
+// -- Atoms, molecules, and chemical systems -----------------------------------
+
+/** @brief Feeds the value of an atom, molecule, or chemical system into @p h.
+ *
+ *  Atoms are hashed as their nucleus followed by their number of electrons.
+ *  Molecules are hashed as their nuclei followed by their charge and
+ *  multiplicity (empty molecules compare equal regardless of charge and
+ *  multiplicity and are all hashed the same). Chemical systems are hashed as
+ *  their molecule.
+ *
+ *  @param[in,out] h The Hasher to feed the value into.
+ *  @param[in] object The object to hash.
+ *
+ *  @throw None No throw guarantee.
+ */
+///@{
+void hash_append(Hasher& h, const Atom& object);
+
+void hash_append(Hasher& h, const Molecule& object);
+
+template<typename MoleculeType>
+void hash_append(Hasher& h, const MoleculeView<MoleculeType>& object);
+
+void hash_append(Hasher& h, const ChemicalSystem& object);
+
+template<typename ChemicalSystemType>
+void hash_append(Hasher& h,
+                 const ChemicalSystemView<ChemicalSystemType>& object);
+///@}
+
+// -- Basis sets ---------------------------------------------------------------
+
+/** @brief Feeds the value of a basis set object into @p h.
+ *
+ *  Null objects are all hashed the same. Primitives are hashed as their
+ *  center, coefficient, and exponent. Contracted Gaussians are hashed as
+ *  their center followed by their coefficients and exponents. Shells are
+ *  hashed as their purity and angular momentum followed by their contracted
+ *  Gaussian. Atomic basis sets are hashed as their name, atomic number, and
+ *  center followed by their shells and AO basis sets are hashed as their
+ *  atomic basis sets.
+ *
+ *  @param[in,out] h The Hasher to feed the value into.
+ *  @param[in] object The object to hash.
+ *
+ *  @throw None No throw guarantee.
+ */
+///@{
+template<typename T>
+void hash_append(Hasher& h, const basis_set::Primitive<T>& object);
+
+template<typename PrimitiveType>
+void hash_append(Hasher& h,
+                 const basis_set::PrimitiveView<PrimitiveType>& object);
+
+template<typename PrimitiveType>
+void hash_append(Hasher& h,
+                 const basis_set::ContractedGaussian<PrimitiveType>& object);
+
+template<typename CGType>
+void hash_append(Hasher& h,
+                 const basis_set::ContractedGaussianView<CGType>& object);
+
+template<typename CGType>
+void hash_append(Hasher& h, const basis_set::Shell<CGType>& object);
+
+template<typename ShellType>
+void hash_append(Hasher& h, const basis_set::ShellView<ShellType>& object);
+
+template<typename ShellType>
+void hash_append(Hasher& h, const basis_set::AtomicBasisSet<ShellType>& object);
+
+template<typename AtomicBasisSetType>
+void hash_append(
+  Hasher& h, const basis_set::AtomicBasisSetView<AtomicBasisSetType>& object);
+
+template<typename AtomicBasisSetType>
+void hash_append(Hasher& h,
+                 const basis_set::AOBasisSet<AtomicBasisSetType>& object);
+///@}
+
+// -- Fragments ----------------------------------------------------------------
+
+/** @brief Feeds the value of a cap or of a fragmented object into @p h.
+ *
+ *  Caps are hashed as their anchor and replaced indices (if set) followed by
+ *  their nuclei. Fragmented objects are hashed as their supersystem followed
+ *  by their fragments. Nuclear fragments are hashed as the indices of their
+ *  nuclei (and the caps of the fragmented nuclei), molecular fragments also
+ *  include the charge and multiplicity of each fragment.
+ *
+ *  @param[in,out] h The Hasher to feed the value into.
+ *  @param[in] object The object to hash.
+ *
+ *  @throw None No throw guarantee.
+ */
+///@{
+void hash_append(Hasher& h, const fragmenting::Cap& object);
+
+void hash_append(Hasher& h, const fragmenting::CapSet& object);
+
+template<typename NucleiType>
+void hash_append(Hasher& h,
+                 const fragmenting::FragmentedNuclei<NucleiType>& object);
+
+template<typename MoleculeType>
+void hash_append(Hasher& h,
+                 const fragmenting::FragmentedMolecule<MoleculeType>& object);
+
+template<typename ChemicalSystemType>
+void hash_append(
+  Hasher& h,
+  const fragmenting::FragmentedChemicalSystem<ChemicalSystemType>& object);
+///@}
+
+// -- Entry points -------------------------------------------------------------
+
+/** @brief Computes the content hash of @p object.
+ *
+ *  @tparam T The type of the object. Must have a hash_append overload.
+ *
+ *  @param[in] object The object to hash.
+ *  @param[in] seed Hashes computed with different seeds are unrelated.
+ *                  Defaults to 0.
+ *
+ *  @return The 64-bit (content_hash) or 128-bit (content_hash128) hash of
+ *          @p object.
+ *
+ *  @throw None No throw guarantee.
+ */
+///@{
+template<typename T>
+hash_type content_hash(const T& object, Hasher::word_type seed = 0) {
+    Hasher h(seed);
+    hash_append(h, object);
+    return h.digest();
+}
+
+template<typename T>
+hash128_type content_hash128(const T& object, Hasher::word_type seed = 0) {
+    Hasher h(seed);
+    hash_append(h, object);
+    return h.digest128();
+}
+///@}
+
+/// Function object computing content_hash, used to implement std::hash
+struct ContentHash {
+    template<typename T>
+    std::size_t operator()(const T& object) const {
+        return static_cast<std::size_t>(content_hash(object));
+    }
+};
+
+} // namespace chemist::hashing
+
+// -- std::hash specializations ------------------------------------------------
+
+#define CHEMIST_CONTENT_HASH(TPARAMS, TYPE) \
+    TPARAMS struct std::hash<TYPE> : chemist::hashing::ContentHash {}
+
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::Point<T>);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::PointView<T>);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::PointSet<T>);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::PointSetView<T>);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::PointCharge<T>);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::PointChargeView<T>);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::Charges<T>);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::ChargesView<T>);
+CHEMIST_CONTENT_HASH(template<>, chemist::Nucleus);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::NucleusView<T>);
+CHEMIST_CONTENT_HASH(template<>, chemist::Nuclei);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::NucleiView<T>);
+CHEMIST_CONTENT_HASH(template<>, chemist::Atom);
+CHEMIST_CONTENT_HASH(template<>, chemist::Molecule);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::MoleculeView<T>);
+CHEMIST_CONTENT_HASH(template<>, chemist::ChemicalSystem);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::ChemicalSystemView<T>);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::basis_set::Primitive<T>);
+CHEMIST_CONTENT_HASH(template<typename T>,
+                     chemist::basis_set::PrimitiveView<T>);
+CHEMIST_CONTENT_HASH(template<typename T>,
+                     chemist::basis_set::ContractedGaussian<T>);
+CHEMIST_CONTENT_HASH(template<typename T>,
+                     chemist::basis_set::ContractedGaussianView<T>);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::basis_set::Shell<T>);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::basis_set::ShellView<T>);
+CHEMIST_CONTENT_HASH(template<typename T>,
+                     chemist::basis_set::AtomicBasisSet<T>);
+CHEMIST_CONTENT_HASH(template<typename T>,
+                     chemist::basis_set::AtomicBasisSetView<T>);
+CHEMIST_CONTENT_HASH(template<typename T>, chemist::basis_set::AOBasisSet<T>);
+CHEMIST_CONTENT_HASH(template<>, chemist::fragmenting::Cap);
+CHEMIST_CONTENT_HASH(template<>, chemist::fragmenting::CapSet);
+CHEMIST_CONTENT_HASH(template<typename T>,
+                     chemist::fragmenting::FragmentedNuclei<T>);
+CHEMIST_CONTENT_HASH(template<typename T>,
+                     chemist::fragmenting::FragmentedMolecule<T>);
+CHEMIST_CONTENT_HASH(template<typename T>,
+                     chemist::fragmenting::FragmentedChemicalSystem<T>);
+
+#undef CHEMIST_CONTENT_HASH
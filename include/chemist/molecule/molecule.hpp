@@ -18,3 +18,5 @@
 #include <chemist/molecule/atom.hpp>
 #include <chemist/molecule/molecule_class.hpp>
 #include <chemist/molecule/molecule_view.hpp>
+#include <chemist/molecule/nuclear_repulsion.hpp>
+#include <chemist/molecule/periodic_table.hpp>
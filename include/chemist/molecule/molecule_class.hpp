@@ -113,6 +113,12 @@ public:
     /// Type of a read-only pointer to the molecule's charge
     using const_charge_pointer = typename traits_type::const_charge_pointer;
 
+    /// Type used to describe a reordering of the nuclei in *this
+    using permutation_type = typename nuclei_type::permutation_type;
+
+    /// Type of a transformation which can be applied to the nuclei
+    using affine_type = typename nuclei_type::affine_type;
+
     /** @brief Makes a molecule with no nuclei, no charge, and a multiplicity
      *         of 1
      *
@@ -234,6 +240,59 @@ public:
      */
     void push_back(atom_type value);
 
+    /** @brief Reorders the nuclei of *this according to @p p.
+     *
+     *  After this call the i-th nucleus of *this is the nucleus which was
+     *  previously the `p[i]`-th nucleus. Since the electrons are not tied to
+     *  specific nuclei, the charge and multiplicity are unchanged.
+     *
+     *  @param[in] p A permutation of [0, size()).
+     *
+     *  @throw std::runtime_error if @p p is not a permutation of [0, size()).
+     *                            Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    void permute(const permutation_type& p);
+
+    /** @brief Sorts the nuclei of *this along a space-filling curve.
+     *
+     *  See PointSet::reorder for details.
+     *
+     *  @param[in] curve The space-filling curve to sort along. Defaults to
+     *                   Hilbert.
+     *
+     *  @return The permutation which was applied to the nuclei of *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    permutation_type reorder(
+      SpaceFillingCurve curve = SpaceFillingCurve::hilbert);
+
+    /** @brief Applies @p f to the position of every nucleus in *this.
+     *
+     *  See PointSet::transform for details. The charge and multiplicity
+     *  of *this are not modified.
+     *
+     *  @param[in] f The transformation to apply.
+     *
+     *  @throw None No throw guarantee.
+     */
+    void transform(const affine_type& f) noexcept;
+
+    /** @brief Returns a copy of *this with @p f applied to every nucleus.
+     *
+     *  @param[in] f The transformation to apply.
+     *
+     *  @return A copy of *this in which each nucleus has been moved to the
+     *          image of its original position.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    Molecule transformed(const affine_type& f) const;
+
     /** @brief Provides access to the set of nuclei.
      *
      *  In the typical quantum chemistry approximations, a molecule is comprised
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <chemist/molecule/molecule_class.hpp>
+#include <chemist/nucleus/nuclear_repulsion.hpp>
+
+namespace chemist {
+
+/** @brief Overloads of the nuclear repulsion kernels for Molecule objects.
+ *
+ *  The nuclear repulsion only depends on the nuclei, so these overloads
+ *  simply forward the nuclei of @p mol to the NucleiView overloads. See
+ *  nuclear_repulsion.hpp in the nucleus component for full descriptions.
+ *
+ *  @param[in] mol The molecule whose nuclear repulsion is wanted.
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+///@{
+inline double nuclear_repulsion_energy(const Molecule& mol) {
+    return nuclear_repulsion_energy(mol.nuclei());
+}
+
+inline std::vector<double> nuclear_repulsion_gradient(const Molecule& mol) {
+    return nuclear_repulsion_gradient(mol.nuclei());
+}
+
+inline std::vector<double> nuclear_repulsion_hessian(const Molecule& mol) {
+    return nuclear_repulsion_hessian(mol.nuclei());
+}
+///@}
+
+} // namespace chemist
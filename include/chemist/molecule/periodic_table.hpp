@@ -0,0 +1,65 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <chemist/molecule/molecule_class.hpp>
+#include <chemist/nucleus/periodic_table.hpp>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace chemist {
+
+/** @brief Creates a Molecule from arrays of elements and coordinates.
+ *
+ *  The nuclei are made by make_nuclei. The multiplicity is the lowest one
+ *  consistent with the number of electrons (1 if it is even and 2 if it is
+ *  odd), except for a neutral atom, which gets the multiplicity of its
+ *  ground state from the periodic table.
+ *
+ *  @param[in] Zs The atomic number of each nucleus.
+ *  @param[in] symbols The (case-insensitive) atomic symbol of each nucleus.
+ *  @param[in] x The x-coordinate of each nucleus.
+ *  @param[in] y The y-coordinate of each nucleus.
+ *  @param[in] z The z-coordinate of each nucleus.
+ *  @param[in] charge The net charge of the molecule. Default is 0.
+ *
+ *  @return The newly created Molecule.
+ *
+ *  @throw std::out_of_range if an atomic number is not in the periodic
+ *                           table. Strong throw guarantee.
+ *  @throw std::runtime_error if an atomic symbol is unknown or if the arrays
+ *                            are not all the same length. Strong throw
+ *                            guarantee.
+ *  @throw std::bad_alloc if there is a problem allocating the return.
+ *                        Strong throw guarantee.
+ */
+///@{
+Molecule make_molecule(std::span<const Element::atomic_number_type> Zs,
+                       std::span<const double> x, std::span<const double> y,
+                       std::span<const double> z,
+                       Molecule::charge_type charge = 0);
+Molecule make_molecule(std::span<const std::string_view> symbols,
+                       std::span<const double> x, std::span<const double> y,
+                       std::span<const double> z,
+                       Molecule::charge_type charge = 0);
+Molecule make_molecule(std::span<const std::string> symbols,
+                       std::span<const double> x, std::span<const double> y,
+                       std::span<const double> z,
+                       Molecule::charge_type charge = 0);
+///@}
+
+} // namespace chemist
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace chemist {
+
+/** @brief A string which is stored once per distinct value.
+ *
+ *  Every nucleus has a name and large systems repeat the same handful of
+ *  names (usually element symbols) over and over. InternedName stores each
+ *  distinct string once, in a process-wide symbol table, and is itself only a
+ *  handle to its entry in that table. Copying an InternedName copies the
+ *  handle and comparing two InternedName objects for equality compares the
+ *  handles, i.e., both are O(1) regardless of the length of the name, and a
+ *  name does not own any heap memory.
+ *
+ *  InternedName is a value type. Entries of the table are immutable, so
+ *  assigning a new value to an InternedName only changes that InternedName
+ *  (it now refers to the new value's entry). It implicitly converts to and
+ *  from std::string so it can be used like the std::string names which
+ *  preceded it.
+ *
+ *  Entries are never removed from the table. That is fine for names, which
+ *  have few distinct values, but InternedName should not be used to store
+ *  arbitrary, unbounded sets of strings. Interning is thread-safe.
+ */
+class InternedName {
+public:
+    /// Type of the string *this is a handle to
+    using string_type = std::string;
+
+    /// Type used for lengths
+    using size_type = std::size_t;
+
+    /** @brief Creates the empty name.
+     *
+     *  The empty name is not stored in the symbol table (its entry exists
+     *  before any name is interned), so this never allocates.
+     *
+     *  @throw None No throw guarantee.
+     */
+    InternedName() noexcept;
+
+    /** @brief Creates a handle to the value @p name.
+     *
+     *  If @p name has not been seen before it is added to the symbol table.
+     *  Looking up a name which has been seen before does not allocate.
+     *
+     *  @param[in] name The value of the name.
+     *
+     *  @throw std::bad_alloc if @p name is new and there is a problem adding
+     *                        it to the table. Strong throw guarantee.
+     */
+    ///@{
+    InternedName(std::string_view name);
+    InternedName(const string_type& name) :
+      InternedName(std::string_view(name)) {}
+    InternedName(const char* name) : InternedName(std::string_view(name)) {}
+    ///@}
+
+    /// The value of *this
+    const string_type& str() const noexcept { return *m_pname_; }
+
+    /// Allows *this to be used where a std::string is expected
+    operator const string_type&() const noexcept { return str(); }
+
+    /// The value of *this as a C-string
+    const char* c_str() const noexcept { return str().c_str(); }
+
+    /// The number of characters in *this
+    size_type size() const noexcept { return str().size(); }
+
+    /// True if *this is the empty name
+    bool empty() const noexcept { return str().empty(); }
+
+    /** @brief Determines the number of distinct names interned so far.
+     *
+     *  Mainly useful for testing and diagnostics.
+     *
+     *  @return The number of entries in the symbol table. The empty name is
+     *          not stored in the table and is not counted.
+     *
+     *  @throw None No throw guarantee.
+     */
+    static size_type table_size() noexcept;
+
+    /// Exchanges the handles of *this and @p other
+    void swap(InternedName& other) noexcept {
+        std::swap(m_pname_, other.m_pname_);
+    }
+
+    /** @brief Value comparisons.
+     *
+     *  Comparing two InternedName objects for equality compares their
+     *  handles. Comparisons with strings compare the characters (they do not
+     *  intern the string). Ordering is lexicographic, like std::string.
+     */
+    ///@{
+    bool operator==(const InternedName& rhs) const noexcept {
+        return m_pname_ == rhs.m_pname_;
+    }
+    bool operator==(const string_type& rhs) const noexcept {
+        return str() == rhs;
+    }
+    bool operator==(const char* rhs) const noexcept { return str() == rhs; }
+    bool operator<(const InternedName& rhs) const noexcept {
+        return m_pname_ != rhs.m_pname_ && str() < rhs.str();
+    }
+    ///@}
+
+    /// Serializes *this by value
+    template<typename Archive>
+    void save(Archive& ar) const {
+        ar& str();
+    }
+
+    /// Deserializes a value into *this, interning it
+    template<typename Archive>
+    void load(Archive& ar) {
+        string_type buffer;
+        ar & buffer;
+        *this = InternedName(buffer);
+    }
+
+private:
+    /// The entry of the table holding the value of *this
+    const string_type* m_pname_;
+};
+
+/// Prints the value of @p name to @p os
+inline std::ostream& operator<<(std::ostream& os, const InternedName& name) {
+    return os << name.str();
+}
+
+} // namespace chemist
+
+/// Hashes the handle, consistent with InternedName::operator==
+template<>
+struct std::hash<chemist::InternedName> {
+    std::size_t operator()(const chemist::InternedName& name) const noexcept {
+        return std::hash<const std::string*>{}(&name.str());
+    }
+};
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file nuclear_repulsion.hpp
+ *
+ *  Kernels for the nuclear repulsion energy
+ *  @f$E = \sum_{i<j} Q_iQ_j/|\mathbf{r}_i - \mathbf{r}_j|@f$ and its first and
+ *  second derivatives with respect to the nuclear coordinates. @f$Q_i@f$ is
+ *  the charge of the i-th nucleus (which is not necessarily its atomic
+ *  number, e.g., ghost atoms have a charge of zero).
+ *
+ *  The kernels read the charges and coordinates as arrays (gathering them
+ *  once if the nuclei are not stored contiguously) and never construct
+ *  per-pair NucleusView objects. The pair loops are vectorized and, if
+ *  Chemist was built with OpenMP, threaded over the nuclei.
+ *
+ *  All quantities are in atomic units. Pairs of nuclei sitting on top of each
+ *  other do not contribute. Gradients are returned as @f$3N@f$ element
+ *  vectors ordered atom-major, i.e., element @f$3i + k@f$ is the derivative
+ *  with respect to the @f$k@f$-th Cartesian coordinate of the @f$i@f$-th
+ *  nucleus. Hessians are row-major @f$3N@f$ by @f$3N@f$ matrices using the
+ *  same ordering for both indices.
+ */
+#pragma once
+#include <chemist/nucleus/nuclei.hpp>
+#include <chemist/nucleus/nuclei_view.hpp>
+#include <vector>
+
+namespace chemist {
+
+/** @brief Computes the nuclear repulsion energy of @p nuclei.
+ *
+ *  @param[in] nuclei The nuclei whose repulsion energy is wanted.
+ *
+ *  @return The repulsion energy (0 for fewer than two nuclei).
+ *
+ *  @throw std::bad_alloc if there is a problem gathering the nuclei. Strong
+ *                        throw guarantee.
+ */
+double nuclear_repulsion_energy(const Nuclei& nuclei);
+
+/** @brief Computes the gradient of the nuclear repulsion energy.
+ *
+ *  @param[in] nuclei The @f$N@f$ nuclei whose repulsion gradient is wanted.
+ *
+ *  @return The @f$3N@f$ element gradient, ordered atom-major.
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+std::vector<double> nuclear_repulsion_gradient(const Nuclei& nuclei);
+
+/** @brief Computes the Hessian of the nuclear repulsion energy.
+ *
+ *  @param[in] nuclei The @f$N@f$ nuclei whose repulsion Hessian is wanted.
+ *
+ *  @return The @f$3N@f$ by @f$3N@f$ Hessian, row-major and ordered
+ *          atom-major.
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+std::vector<double> nuclear_repulsion_hessian(const Nuclei& nuclei);
+
+/** @brief Overloads of the repulsion kernels for NucleiView objects.
+ *
+ *  These overloads behave exactly like their Nuclei counterparts.
+ *
+ *  @tparam NucleiType The cv-qualified Nuclei type being viewed.
+ */
+///@{
+template<typename NucleiType>
+double nuclear_repulsion_energy(const NucleiView<NucleiType>& nuclei);
+
+template<typename NucleiType>
+std::vector<double> nuclear_repulsion_gradient(
+  const NucleiView<NucleiType>& nuclei);
+
+template<typename NucleiType>
+std::vector<double> nuclear_repulsion_hessian(
+  const NucleiView<NucleiType>& nuclei);
+///@}
+
+// -- Interaction-only kernels -------------------------------------------------
+
+/** @brief Computes the repulsion between the nuclei of @p lhs and @p rhs.
+ *
+ *  Only pairs with one nucleus in @p lhs and the other in @p rhs contribute,
+ *  i.e., this is @f$E(A \cup B) - E(A) - E(B)@f$ for @f$A =@f$ @p lhs and
+ *  @f$B =@f$ @p rhs, which is what fragment-based methods and embedding
+ *  corrections need. @p lhs and @p rhs are assumed to be disjoint.
+ *
+ *  @tparam NucleiType1 The cv-qualified Nuclei type viewed by @p lhs.
+ *  @tparam NucleiType2 The cv-qualified Nuclei type viewed by @p rhs.
+ *
+ *  @param[in] lhs The @f$N_A@f$ nuclei of the first fragment.
+ *  @param[in] rhs The @f$N_B@f$ nuclei of the second fragment.
+ *
+ *  @return The interaction energy.
+ *
+ *  @throw std::bad_alloc if there is a problem gathering the nuclei. Strong
+ *                        throw guarantee.
+ */
+template<typename NucleiType1, typename NucleiType2>
+double nuclear_interaction_energy(const NucleiView<NucleiType1>& lhs,
+                                  const NucleiView<NucleiType2>& rhs);
+
+/** @brief Computes the gradient of the interaction energy.
+ *
+ *  The gradient is with respect to the nuclei of @p lhs followed by those of
+ *  @p rhs, i.e., it is the gradient of nuclear_interaction_energy for the
+ *  @f$N_A + N_B@f$ nuclei of @p lhs and @p rhs concatenated.
+ *
+ *  @return The @f$3(N_A + N_B)@f$ element gradient, ordered atom-major.
+ */
+template<typename NucleiType1, typename NucleiType2>
+std::vector<double> nuclear_interaction_gradient(
+  const NucleiView<NucleiType1>& lhs, const NucleiView<NucleiType2>& rhs);
+
+/** @brief Computes the Hessian of the interaction energy.
+ *
+ *  The nuclei are ordered like they are for nuclear_interaction_gradient.
+ *
+ *  @return The @f$3(N_A + N_B)@f$ by @f$3(N_A + N_B)@f$ Hessian, row-major
+ *          and ordered atom-major.
+ */
+template<typename NucleiType1, typename NucleiType2>
+std::vector<double> nuclear_interaction_hessian(
+  const NucleiView<NucleiType1>& lhs, const NucleiView<NucleiType2>& rhs);
+
+} // namespace chemist
@@ -19,6 +19,7 @@
 #include <chemist/point_charge/charges_view.hpp>
 #include <chemist/traits/nucleus_traits.hpp>
 #include <utilities/containers/indexable_container_base.hpp>
+#include <span>
 
 namespace chemist {
 namespace detail_ {
@@ -63,6 +64,15 @@ public:
     /// Read-only reference to an element
     using const_reference = typename nucleus_traits::const_view_type;
 
+    /// Type used to store a Nucleus's name
+    using name_type = typename nucleus_traits::name_type;
+
+    /// Type used to store a Nucleus's atomic number
+    using atomic_number_type = typename nucleus_traits::atomic_number_type;
+
+    /// Type used to store a Nucleus's mass
+    using mass_type = typename nucleus_traits::mass_type;
+
     /// Type of a mutable pointer to a Nucleus's name
     using name_pointer = typename nucleus_traits::name_pointer;
 
@@ -83,6 +93,18 @@ public:
     /// Type of a read-only pointer to a Nucleus's mass
     using const_mass_pointer = typename nucleus_traits::const_mass_pointer;
 
+    /// Type of a mutable, contiguous column of atomic numbers
+    using atomic_number_span = std::span<atomic_number_type>;
+
+    /// Type of a read-only, contiguous column of atomic numbers
+    using const_atomic_number_span = std::span<const atomic_number_type>;
+
+    /// Type of a mutable, contiguous column of masses
+    using mass_span = std::span<mass_type>;
+
+    /// Type of a read-only, contiguous column of masses
+    using const_mass_span = std::span<const mass_type>;
+
     // -- PointCharge types
 
     // Class defining the types of the Charges subset of *this
@@ -106,6 +128,12 @@ public:
     /// Integral type used for indexing
     using size_type = typename base_type::size_type;
 
+    /// Type used to describe a reordering of the nuclei in *this
+    using permutation_type = typename charge_set_type::permutation_type;
+
+    /// Type of a transformation which can be applied to the nuclei
+    using affine_type = typename charge_set_type::affine_type;
+
     /** @brief Creates an empty Nuclei object.
      *
      *  The Nuclei object resulting from this ctor will function like an
@@ -151,6 +179,26 @@ public:
         }
     }
 
+    /** @brief Creates a Nuclei object from its columns.
+     *
+     *  This ctor is meant for populating a Nuclei object in bulk (e.g., from a
+     *  file reader). All of the inputs are adopted by *this, i.e., no copies
+     *  of the underlying buffers are made. The Charges object can itself be
+     *  populated in bulk, see the Charges and PointSet ctors.
+     *
+     *  @param[in] charges The point charge piece of each nucleus.
+     *  @param[in] names The name of each nucleus.
+     *  @param[in] Zs The atomic number of each nucleus.
+     *  @param[in] masses The mass of each nucleus.
+     *
+     *  @throw std::runtime_error if the inputs are not all the same length.
+     *                            Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the PIMPL.
+     *                        Strong throw guarantee.
+     */
+    Nuclei(charge_set_type charges, std::vector<name_type> names,
+           std::vector<atomic_number_type> Zs, std::vector<mass_type> masses);
+
     /** @brief Creates a new Nuclei by deep copying @p rhs.
      *
      *  @param[in] other the object we are copying.
@@ -223,6 +271,66 @@ public:
      */
     void push_back(value_type q);
 
+    /** @brief Ensures *this can hold @p n nuclei without reallocating.
+     *
+     *  @param[in] n The number of nuclei *this should be able to hold.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    void reserve(size_type n);
+
+    /** @brief Reorders the nuclei in *this according to @p p.
+     *
+     *  After this call the i-th nucleus of *this is the nucleus which was
+     *  previously the `p[i]`-th nucleus.
+     *
+     *  @param[in] p A permutation of [0, size()).
+     *
+     *  @throw std::runtime_error if @p p is not a permutation of [0, size()).
+     *                            Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    void permute(const permutation_type& p);
+
+    /** @brief Sorts the nuclei in *this along a space-filling curve.
+     *
+     *  See PointSet::reorder for details.
+     *
+     *  @param[in] curve The space-filling curve to sort along. Defaults to
+     *                   Hilbert.
+     *
+     *  @return The permutation which was applied to *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    permutation_type reorder(
+      SpaceFillingCurve curve = SpaceFillingCurve::hilbert);
+
+    /** @brief Applies @p f to the position of every nucleus in *this.
+     *
+     *  See PointSet::transform for details.
+     *
+     *  @param[in] f The transformation to apply.
+     *
+     *  @throw None No throw guarantee.
+     */
+    void transform(const affine_type& f) noexcept;
+
+    /** @brief Returns a copy of *this with @p f applied to every nucleus.
+     *
+     *  @param[in] f The transformation to apply.
+     *
+     *  @return A copy of *this in which each nucleus has been moved to the
+     *          image of its original position.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    Nuclei transformed(const affine_type& f) const;
+
     charge_set_reference charges();
 
     const_charge_set_reference charges() const;
@@ -239,6 +347,31 @@ public:
 
     const_mass_pointer mass_data() const noexcept;
 
+    /** @brief Returns the atomic numbers or masses of the nuclei as a column.
+     *
+     *  The i-th element of each column is the respective property of the
+     *  i-th nucleus. The coordinates and charges are available as columns
+     *  through charges().
+     *
+     *  @return A span over the size() atomic numbers or masses.
+     *
+     *  @throw None No throw guarantee.
+     */
+    ///@{
+    atomic_number_span atomic_number_column() noexcept {
+        return atomic_number_span(atomic_number_data(), size_());
+    }
+    const_atomic_number_span atomic_number_column() const noexcept {
+        return const_atomic_number_span(atomic_number_data(), size_());
+    }
+    mass_span mass_column() noexcept {
+        return mass_span(mass_data(), size_());
+    }
+    const_mass_span mass_column() const noexcept {
+        return const_mass_span(mass_data(), size_());
+    }
+    ///@}
+
     /** @brief Serialize Nuclei instance
      *
      * @param ar The archive object
@@ -19,6 +19,7 @@
 #include <chemist/point_charge/charges_view.hpp>
 #include <chemist/traits/nucleus_traits.hpp>
 #include <utilities/containers/indexable_container_base.hpp>
+#include <span>
 
 namespace chemist {
 namespace detail_ {
@@ -122,6 +123,22 @@ public:
     /// Type of a pointer to a nucleus's mass
     using mass_pointer = typename nucleus_traits::mass_pointer;
 
+    /// Type of a contiguous column of atomic numbers, read-only if
+    /// NucleiType is const-qualified
+    using atomic_number_span =
+      std::span<std::remove_pointer_t<atomic_number_pointer>>;
+
+    /// Type of a read-only, contiguous column of atomic numbers
+    using const_atomic_number_span =
+      std::span<const typename nucleus_traits::atomic_number_type>;
+
+    /// Type of a contiguous column of masses, read-only if NucleiType is
+    /// const-qualified
+    using mass_span = std::span<std::remove_pointer_t<mass_pointer>>;
+
+    /// Type of a read-only, contiguous column of masses
+    using const_mass_span = std::span<const typename nucleus_traits::mass_type>;
+
     // -- PointCharge types----------------------------------------------------
 
     /// Class providing types for the Charges object *this aliases
@@ -191,6 +208,30 @@ public:
     NucleiView(charges_reference charges, name_pointer pnames,
                atomic_number_pointer patomic_numbers, mass_pointer pmasses);
 
+    /** @brief Creates a NucleiView from strided data.
+     *
+     *  This ctor allows the user to alias an existing array of structures as
+     *  if it were a Nuclei object, without copying it. The number of Nucleus
+     *  objects will be taken from @p charges (which can itself alias the
+     *  same array, see the strided ChargesView and PointSetView ctors) and
+     *  the property of the `i`-th nucleus is assumed to live `i * stride`
+     *  bytes past that of the 0-th nucleus.
+     *
+     *  @param[in] charges A ChargesView to use as the "Charges" part of *this
+     *  @param[in] pnames A pointer to the first nucleus's name.
+     *  @param[in] patomic_numbers A pointer to the first nucleus's atomic
+     *                             number.
+     *  @param[in] pmasses A pointer to the first nucleus's mass.
+     *  @param[in] stride The distance, in bytes, between the properties of
+     *                    consecutive nuclei, e.g., the size of the structure.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the internal
+     *                        state. Strong throw guarantee.
+     */
+    NucleiView(charges_reference charges, name_pointer pnames,
+               atomic_number_pointer patomic_numbers, mass_pointer pmasses,
+               size_type stride);
+
     /** @brief Holds a subset of the provided Nuclei object
      *
      *  @tparam BeginItr The type of the iterator pointing to the index of the
@@ -383,6 +424,10 @@ public:
      *  This method will turn a NucleiView object into a Nuclei object by
      *  copying the state aliased by *this into a newly created Nuclei object.
      *
+     *  The state is copied a column at a time and handed to the Nuclei object
+     *  in bulk. Contiguous and strided views copy straight out of the aliased
+     *  arrays and subsets of them gather their members out of those arrays.
+     *
      *  @return A Nuclei object with a deep copy of the state aliased by *this.
      *
      *  @throw std::bad_alloc if there is a problem allocating the new state.
@@ -390,6 +435,57 @@ public:
      */
     nuclei_type as_nuclei() const;
 
+    /** @brief Copies some of the nuclei in *this into a Nuclei object.
+     *
+     *  This method is the same as `NucleiView(*this, members).as_nuclei()`,
+     *  but does not create the intermediate view.
+     *
+     *  @param[in] members The indices of the nuclei to copy. The i-th nucleus
+     *                     of the result is nucleus `members[i]` of *this.
+     *
+     *  @return A Nuclei object with a deep copy of the nuclei @p members.
+     *
+     *  @throw std::out_of_range if a member is not in the range [0, size()).
+     *                           Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the new state.
+     *                        Strong throw guarantee.
+     */
+    nuclei_type as_nuclei(const member_list_type& members) const;
+
+    /** @brief Determines if the aliased atomic numbers and masses are stored
+     *         as contiguous columns.
+     *
+     *  Views of Nuclei objects, and views created from pointers to contiguous
+     *  arrays, are contiguous. Strided views, subsets, and unions are not.
+     *  Empty views are contiguous.
+     *
+     *  @return True if atomic_number_column() and mass_column() can be called
+     *          and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool is_contiguous() const noexcept;
+
+    /** @brief Returns the aliased atomic numbers or masses as a column.
+     *
+     *  @return A span over the size() aliased atomic numbers or masses.
+     *
+     *  @throw std::runtime_error if *this is not contiguous. Strong throw
+     *                            guarantee.
+     */
+    ///@{
+    atomic_number_span atomic_number_column() {
+        return atomic_number_span(atomic_number_column_data_(), size_());
+    }
+    const_atomic_number_span atomic_number_column() const {
+        return const_atomic_number_span(atomic_number_column_data_(), size_());
+    }
+    mass_span mass_column() { return mass_span(mass_column_data_(), size_()); }
+    const_mass_span mass_column() const {
+        return const_mass_span(mass_column_data_(), size_());
+    }
+    ///@}
+
     /** @brief Determines if the Nuclei aliased by *this and @p rhs are equal.
      *
      *  This method compares the Nuclei object aliased by *this to the Nuclei
@@ -462,6 +558,12 @@ private:
     /// Wraps determining if *this has a PIMPL or not
     bool has_pimpl_() const noexcept;
 
+    /// Address of the first atomic number, throws if not contiguous
+    atomic_number_pointer atomic_number_column_data_() const;
+
+    /// Address of the first mass, throws if not contiguous
+    mass_pointer mass_column_data_() const;
+
     /// The object implementing *this
     pimpl_pointer m_pimpl_;
 };
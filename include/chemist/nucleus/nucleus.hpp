@@ -16,6 +16,8 @@
 
 #pragma once
 #include <chemist/nucleus/nuclei.hpp>
+#include <chemist/nucleus/nuclear_repulsion.hpp>
 #include <chemist/nucleus/nuclei_view.hpp>
 #include <chemist/nucleus/nucleus_class.hpp>
 #include <chemist/nucleus/nucleus_view.hpp>
+#include <chemist/nucleus/periodic_table.hpp>
@@ -0,0 +1,356 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file periodic_table.hpp
+ *
+ *  Compile-time reference data for the elements hydrogen through radon, and
+ *  factories which use it to build Nucleus and Nuclei objects from atomic
+ *  numbers or atomic symbols.
+ *
+ *  The data is tabulated in the units it is usually quoted in (Daltons and
+ *  Angstroms) and the `_au` accessors of Element convert it to the atomic
+ *  units used by the rest of Chemist. Sources:
+ *
+ *  - Masses are those of the most abundant isotope (the longest-lived
+ *    isotope for Tc, Pm, Po, At, and Rn).
+ *  - Covalent radii are from Cordero et al., Dalton Trans. 2008, 2832. The
+ *    low-spin values are used for Mn and Fe.
+ *  - Van der Waals radii are from Bondi, J. Phys. Chem. 1964, 68, 441,
+ *    supplemented by Mantina et al., J. Phys. Chem. A 2009, 113, 5806, for
+ *    the main-group elements. Elements with neither use 2.0 Angstroms.
+ *  - Multiplicities are those of the ground state of the neutral atom.
+ */
+#pragma once
+#include <chemist/nucleus/nuclei.hpp>
+#include <chemist/nucleus/nucleus_class.hpp>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace chemist {
+
+/** @brief The reference data for one element.
+ *
+ *  Element is an aggregate so the periodic table can be a constexpr array.
+ */
+struct Element {
+    /// Type used for the atomic number, same as Nucleus
+    using atomic_number_type = typename Nucleus::atomic_number_type;
+
+    /// Type used for the multiplicity, same as Molecule
+    using multiplicity_type = unsigned short;
+
+    /// Electron masses per Dalton (CODATA 2018)
+    static constexpr double daltons_to_au = 1822.888486209;
+
+    /// Bohr per Angstrom (CODATA 2018)
+    static constexpr double angstroms_to_au = 1.0 / 0.529177210903;
+
+    /// The atomic symbol, e.g., "He"
+    std::string_view symbol;
+
+    /// The atomic number
+    atomic_number_type Z;
+
+    /// The isotopic mass, in Daltons
+    double mass;
+
+    /// The single-bond covalent radius, in Angstroms
+    double covalent_radius;
+
+    /// The van der Waals radius, in Angstroms
+    double vdw_radius;
+
+    /// The multiplicity of the atom's ground state
+    multiplicity_type multiplicity;
+
+    /// The mass in atomic units (electron masses), as Nucleus expects
+    constexpr double mass_au() const noexcept { return mass * daltons_to_au; }
+
+    /// The covalent radius in atomic units (bohr)
+    constexpr double covalent_radius_au() const noexcept {
+        return covalent_radius * angstroms_to_au;
+    }
+
+    /// The van der Waals radius in atomic units (bohr)
+    constexpr double vdw_radius_au() const noexcept {
+        return vdw_radius * angstroms_to_au;
+    }
+};
+
+/// The elements, element Z is at index Z - 1
+inline constexpr std::array<Element, 86> periodic_table{{
+    {"H", 1, 1.00782503207, 0.31, 1.20, 2},
+    {"He", 2, 4.00260325415, 0.28, 1.40, 1},
+    {"Li", 3, 7.0160034, 1.28, 1.82, 2},
+    {"Be", 4, 9.0121822, 0.96, 1.53, 1},
+    {"B", 5, 11.0093054, 0.84, 1.92, 2},
+    {"C", 6, 12.0, 0.76, 1.70, 3},
+    {"N", 7, 14.0030740048, 0.71, 1.55, 4},
+    {"O", 8, 15.99491461956, 0.66, 1.52, 3},
+    {"F", 9, 18.99840322, 0.57, 1.47, 2},
+    {"Ne", 10, 19.9924401754, 0.58, 1.54, 1},
+    {"Na", 11, 22.9897692809, 1.66, 2.27, 2},
+    {"Mg", 12, 23.9850417, 1.41, 1.73, 1},
+    {"Al", 13, 26.98153863, 1.21, 1.84, 2},
+    {"Si", 14, 27.9769265325, 1.11, 2.10, 3},
+    {"P", 15, 30.97376163, 1.07, 1.80, 4},
+    {"S", 16, 31.972071, 1.05, 1.80, 3},
+    {"Cl", 17, 34.96885268, 1.02, 1.75, 2},
+    {"Ar", 18, 39.9623831225, 1.06, 1.88, 1},
+    {"K", 19, 38.96370668, 2.03, 2.75, 2},
+    {"Ca", 20, 39.96259098, 1.76, 2.31, 1},
+    {"Sc", 21, 44.9559119, 1.70, 2.00, 2},
+    {"Ti", 22, 47.9479463, 1.60, 2.00, 3},
+    {"V", 23, 50.9439595, 1.53, 2.00, 4},
+    {"Cr", 24, 51.9405075, 1.39, 2.00, 7},
+    {"Mn", 25, 54.9380451, 1.39, 2.00, 6},
+    {"Fe", 26, 55.9349375, 1.32, 2.00, 5},
+    {"Co", 27, 58.933195, 1.26, 2.00, 4},
+    {"Ni", 28, 57.9353429, 1.24, 1.63, 3},
+    {"Cu", 29, 62.9295975, 1.32, 1.40, 2},
+    {"Zn", 30, 63.9291422, 1.22, 1.39, 1},
+    {"Ga", 31, 68.9255736, 1.22, 1.87, 2},
+    {"Ge", 32, 73.9211778, 1.20, 2.11, 3},
+    {"As", 33, 74.9215965, 1.19, 1.85, 4},
+    {"Se", 34, 79.9165213, 1.20, 1.90, 3},
+    {"Br", 35, 78.9183371, 1.20, 1.85, 2},
+    {"Kr", 36, 83.911507, 1.16, 2.02, 1},
+    {"Rb", 37, 84.911789738, 2.20, 3.03, 2},
+    {"Sr", 38, 87.9056121, 1.95, 2.49, 1},
+    {"Y", 39, 88.9058483, 1.90, 2.00, 2},
+    {"Zr", 40, 89.9047044, 1.75, 2.00, 3},
+    {"Nb", 41, 92.9063781, 1.64, 2.00, 6},
+    {"Mo", 42, 97.9054082, 1.54, 2.00, 7},
+    {"Tc", 43, 97.907216, 1.47, 2.00, 6},
+    {"Ru", 44, 101.9043493, 1.46, 2.00, 5},
+    {"Rh", 45, 102.905504, 1.42, 2.00, 4},
+    {"Pd", 46, 105.903486, 1.39, 1.63, 1},
+    {"Ag", 47, 106.905097, 1.45, 1.72, 2},
+    {"Cd", 48, 113.9033585, 1.44, 1.58, 1},
+    {"In", 49, 114.903878, 1.42, 1.93, 2},
+    {"Sn", 50, 119.9021947, 1.39, 2.17, 3},
+    {"Sb", 51, 120.9038157, 1.39, 2.06, 4},
+    {"Te", 52, 129.9062244, 1.38, 2.06, 3},
+    {"I", 53, 126.904473, 1.39, 1.98, 2},
+    {"Xe", 54, 131.9041535, 1.40, 2.16, 1},
+    {"Cs", 55, 132.905451933, 2.44, 3.43, 2},
+    {"Ba", 56, 137.9052472, 2.15, 2.68, 1},
+    {"La", 57, 138.9063533, 2.07, 2.00, 2},
+    {"Ce", 58, 139.9054387, 2.04, 2.00, 1},
+    {"Pr", 59, 140.9076528, 2.03, 2.00, 4},
+    {"Nd", 60, 141.9077233, 2.01, 2.00, 5},
+    {"Pm", 61, 144.912749, 1.99, 2.00, 6},
+    {"Sm", 62, 151.9197324, 1.98, 2.00, 7},
+    {"Eu", 63, 152.9212303, 1.98, 2.00, 8},
+    {"Gd", 64, 157.9241039, 1.96, 2.00, 9},
+    {"Tb", 65, 158.9253468, 1.94, 2.00, 6},
+    {"Dy", 66, 163.9291748, 1.92, 2.00, 5},
+    {"Ho", 67, 164.9303221, 1.92, 2.00, 4},
+    {"Er", 68, 165.9302931, 1.89, 2.00, 3},
+    {"Tm", 69, 168.9342133, 1.90, 2.00, 2},
+    {"Yb", 70, 173.9388621, 1.87, 2.00, 1},
+    {"Lu", 71, 174.9407718, 1.87, 2.00, 2},
+    {"Hf", 72, 179.94655, 1.75, 2.00, 3},
+    {"Ta", 73, 180.9479958, 1.70, 2.00, 4},
+    {"W", 74, 183.9509312, 1.62, 2.00, 5},
+    {"Re", 75, 186.9557531, 1.51, 2.00, 6},
+    {"Os", 76, 191.9614807, 1.44, 2.00, 5},
+    {"Ir", 77, 192.9629264, 1.41, 2.00, 4},
+    {"Pt", 78, 194.9647911, 1.36, 1.72, 3},
+    {"Au", 79, 196.9665687, 1.36, 1.66, 2},
+    {"Hg", 80, 201.970643, 1.32, 1.55, 1},
+    {"Tl", 81, 204.9744275, 1.45, 1.96, 2},
+    {"Pb", 82, 207.9766521, 1.46, 2.02, 3},
+    {"Bi", 83, 208.9803987, 1.48, 2.07, 4},
+    {"Po", 84, 208.9824304, 1.40, 1.97, 3},
+    {"At", 85, 209.987148, 1.50, 2.02, 2},
+    {"Rn", 86, 222.0175777, 1.50, 2.20, 1},
+}};
+
+/// The largest atomic number in the periodic table
+inline constexpr Element::atomic_number_type max_atomic_number =
+  periodic_table.size();
+
+namespace detail_ {
+
+/// Number of slots in symbol_index, i.e., 26 first letters times 27 seconds
+inline constexpr std::size_t n_symbol_slots = 26 * 27;
+
+/** @brief Maps a one- or two-letter symbol to a slot of symbol_index.
+ *
+ *  Letters are case-insensitive. Strings which are not one or two letters
+ *  map to n_symbol_slots.
+ */
+constexpr std::size_t symbol_slot(std::string_view symbol) noexcept {
+    auto letter = [](char c) -> std::size_t {
+        if(c >= 'A' && c <= 'Z') return c - 'A';
+        if(c >= 'a' && c <= 'z') return c - 'a';
+        return 26;
+    };
+    if(symbol.empty() || symbol.size() > 2) return n_symbol_slots;
+    const auto first = letter(symbol[0]);
+    if(first == 26) return n_symbol_slots;
+    if(symbol.size() == 1) return first * 27 + 26;
+    const auto second = letter(symbol[1]);
+    if(second == 26) return n_symbol_slots;
+    return first * 27 + second;
+}
+
+/// Makes the table mapping symbol slots to atomic numbers (0 if unused)
+constexpr std::array<unsigned char, n_symbol_slots> make_symbol_index() {
+    std::array<unsigned char, n_symbol_slots> rv{};
+    for(const auto& e : periodic_table) rv[symbol_slot(e.symbol)] = e.Z;
+    return rv;
+}
+
+/// Lookup table for atomic symbols, built at compile time
+inline constexpr auto symbol_index = make_symbol_index();
+
+} // namespace detail_
+
+/** @brief Is @p Z the atomic number of an element in the periodic table?
+ *
+ *  @param[in] Z The atomic number to check.
+ *
+ *  @return True if 1 <= @p Z <= max_atomic_number and false otherwise.
+ *
+ *  @throw None No throw guarantee.
+ */
+constexpr bool is_element(Element::atomic_number_type Z) noexcept {
+    return Z >= 1 && Z <= max_atomic_number;
+}
+
+/** @brief Is @p symbol the atomic symbol of an element in the periodic table?
+ *
+ *  Symbols are case-insensitive, e.g., "He", "HE", and "he" are all helium.
+ *
+ *  @param[in] symbol The atomic symbol to check.
+ *
+ *  @return True if @p symbol is a known atomic symbol and false otherwise.
+ *
+ *  @throw None No throw guarantee.
+ */
+constexpr bool is_element(std::string_view symbol) noexcept {
+    const auto slot = detail_::symbol_slot(symbol);
+    return slot < detail_::n_symbol_slots && detail_::symbol_index[slot] != 0;
+}
+
+/** @brief Looks up the atomic number of the element with symbol @p symbol.
+ *
+ *  The look up is a constant-time table access, not a search.
+ *
+ *  @param[in] symbol The (case-insensitive) atomic symbol.
+ *
+ *  @return The atomic number of @p symbol.
+ *
+ *  @throw std::runtime_error if @p symbol is not a known atomic symbol.
+ *                            Strong throw guarantee.
+ */
+constexpr Element::atomic_number_type atomic_number(std::string_view symbol) {
+    if(!is_element(symbol))
+        throw std::runtime_error("Not a known atomic symbol");
+    return detail_::symbol_index[detail_::symbol_slot(symbol)];
+}
+
+/** @brief Looks up the reference data of an element.
+ *
+ *  @param[in] Z The atomic number of the element.
+ *  @param[in] symbol The (case-insensitive) atomic symbol of the element.
+ *
+ *  @return A read-only reference to the element's entry in periodic_table.
+ *
+ *  @throw std::out_of_range if @p Z is not in the periodic table. Strong
+ *                           throw guarantee.
+ *  @throw std::runtime_error if @p symbol is not a known atomic symbol.
+ *                            Strong throw guarantee.
+ */
+///@{
+constexpr const Element& element(Element::atomic_number_type Z) {
+    if(!is_element(Z))
+        throw std::out_of_range("Atomic number is not in the periodic table");
+    return periodic_table[Z - 1];
+}
+
+constexpr const Element& element(std::string_view symbol) {
+    return periodic_table[atomic_number(symbol) - 1];
+}
+///@}
+
+/** @brief Creates a Nucleus for an element.
+ *
+ *  The Nucleus is named after the element's (canonical) symbol, and has the
+ *  element's atomic number, isotopic mass (in atomic units), and a charge
+ *  equal to its atomic number.
+ *
+ *  @param[in] Z The atomic number of the element.
+ *  @param[in] symbol The (case-insensitive) atomic symbol of the element.
+ *  @param[in] x The x-coordinate of the nucleus. Default is 0.
+ *  @param[in] y The y-coordinate of the nucleus. Default is 0.
+ *  @param[in] z The z-coordinate of the nucleus. Default is 0.
+ *
+ *  @return The newly created Nucleus.
+ *
+ *  @throw std::out_of_range if @p Z is not in the periodic table. Strong
+ *                           throw guarantee.
+ *  @throw std::runtime_error if @p symbol is not a known atomic symbol.
+ *                            Strong throw guarantee.
+ */
+///@{
+Nucleus make_nucleus(Element::atomic_number_type Z, double x = 0.0,
+                     double y = 0.0, double z = 0.0);
+Nucleus make_nucleus(std::string_view symbol, double x = 0.0, double y = 0.0,
+                     double z = 0.0);
+///@}
+
+/** @brief Creates a Nuclei object from arrays of elements and coordinates.
+ *
+ *  The i-th nucleus is made like make_nucleus makes it. The nuclei are
+ *  assembled in bulk, i.e., with a constant-time table look up per nucleus
+ *  and without creating intermediate Nucleus objects.
+ *
+ *  @param[in] Zs The atomic number of each nucleus.
+ *  @param[in] symbols The (case-insensitive) atomic symbol of each nucleus.
+ *  @param[in] x The x-coordinate of each nucleus.
+ *  @param[in] y The y-coordinate of each nucleus.
+ *  @param[in] z The z-coordinate of each nucleus.
+ *
+ *  @return The newly created Nuclei object.
+ *
+ *  @throw std::out_of_range if an atomic number is not in the periodic
+ *                           table. Strong throw guarantee.
+ *  @throw std::runtime_error if an atomic symbol is unknown or if the arrays
+ *                            are not all the same length. Strong throw
+ *                            guarantee.
+ *  @throw std::bad_alloc if there is a problem allocating the return.
+ *                        Strong throw guarantee.
+ */
+///@{
+Nuclei make_nuclei(std::span<const Element::atomic_number_type> Zs,
+                   std::span<const double> x, std::span<const double> y,
+                   std::span<const double> z);
+Nuclei make_nuclei(std::span<const std::string_view> symbols,
+                   std::span<const double> x, std::span<const double> y,
+                   std::span<const double> z);
+Nuclei make_nuclei(std::span<const std::string> symbols,
+                   std::span<const double> x, std::span<const double> y,
+                   std::span<const double> z);
+///@}
+
+} // namespace chemist
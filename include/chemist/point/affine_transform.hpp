@@ -0,0 +1,214 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <array>
+#include <chemist/point/point_class.hpp>
+#include <cstddef>
+
+namespace chemist {
+
+/** @brief Describes an affine transformation of 3-D Cartesian space.
+ *
+ *  An affine transformation maps the point @f$\mathbf{r}@f$ to
+ *  @f$\mathbf{A}\mathbf{r} + \mathbf{t}@f$, where @f$\mathbf{A}@f$ is a 3 by
+ *  3 matrix and @f$\mathbf{t}@f$ is a translation vector. Translations,
+ *  rotations, reflections, and any combination of them (e.g., the transform
+ *  to a standard orientation) are all affine transformations.
+ *
+ *  Objects of this class are lightweight values. The actual work of applying
+ *  a transformation to many points is done by apply(), which loops over
+ *  structure-of-arrays coordinates and is what PointSet::transform and
+ *  friends call.
+ *
+ *  @tparam T The floating-point type of the coordinates.
+ */
+template<typename T>
+class AffineTransform {
+public:
+    /// Floating-point type of the coordinates
+    using coord_type = T;
+
+    /// Type of a pointer to a mutable coordinate
+    using coord_pointer = coord_type*;
+
+    /// Type of a pointer to a read-only coordinate
+    using const_coord_pointer = const coord_type*;
+
+    /// Type of the 3 by 3 matrix, stored in row-major order
+    using matrix_type = std::array<coord_type, 9>;
+
+    /// Type of the translation vector
+    using vector_type = std::array<coord_type, 3>;
+
+    /// Type of a point *this can be applied to
+    using point_type = Point<coord_type>;
+
+    /// Integral type used for indexing
+    using size_type = std::size_t;
+
+    // -------------------------------------------------------------------------
+    // -- Ctors
+    // -------------------------------------------------------------------------
+
+    /** @brief Creates the identity transformation.
+     *
+     *  @throw None No throw guarantee.
+     */
+    AffineTransform() noexcept;
+
+    /** @brief Creates the transformation @f$\mathbf{r}\mapsto\mathbf{A}
+     *         \mathbf{r} + \mathbf{t}@f$.
+     *
+     *  @param[in] A The 3 by 3 matrix, in row-major order.
+     *  @param[in] t The translation vector.
+     *
+     *  @throw None No throw guarantee.
+     */
+    AffineTransform(matrix_type A, vector_type t) noexcept;
+
+    /** @brief Creates a transformation which translates points by @p t.
+     *
+     *  @param[in] t The displacement to add to every point.
+     *
+     *  @return The transformation @f$\mathbf{r}\mapsto\mathbf{r} +
+     *          \mathbf{t}@f$.
+     *
+     *  @throw None No throw guarantee.
+     */
+    static AffineTransform translation(vector_type t) noexcept;
+
+    /** @brief Creates a transformation which multiplies points by @p R.
+     *
+     *  Nothing checks that @p R is actually orthogonal, so this factory can
+     *  also be used for reflections, scalings, etc.
+     *
+     *  @param[in] R The 3 by 3 rotation matrix, in row-major order.
+     *
+     *  @return The transformation @f$\mathbf{r}\mapsto\mathbf{R}\mathbf{r}@f$.
+     *
+     *  @throw None No throw guarantee.
+     */
+    static AffineTransform rotation(matrix_type R) noexcept;
+
+    /** @brief Creates a transformation which rotates points by @p angle about
+     *         an axis through the origin.
+     *
+     *  The rotation is counter-clockwise when looking down @p axis towards the
+     *  origin (i.e., it follows the right-hand rule).
+     *
+     *  @param[in] axis The axis to rotate about. Need not be normalized.
+     *  @param[in] angle The rotation angle, in radians.
+     *
+     *  @return The requested rotation.
+     *
+     *  @throw std::runtime_error if @p axis is the zero vector. Strong throw
+     *                            guarantee.
+     */
+    static AffineTransform rotation_about(vector_type axis, coord_type angle);
+
+    // -------------------------------------------------------------------------
+    // -- Accessors
+    // -------------------------------------------------------------------------
+
+    /// The 3 by 3 matrix of *this, in row-major order
+    const matrix_type& linear_part() const noexcept { return m_A_; }
+
+    /// The translation vector of *this
+    const vector_type& translation_part() const noexcept { return m_t_; }
+
+    /// True if the matrix of *this is exactly the identity matrix
+    bool is_translation() const noexcept;
+
+    // -------------------------------------------------------------------------
+    // -- Applying the transformation
+    // -------------------------------------------------------------------------
+
+    /** @brief Returns @p r after transforming it by *this.
+     *
+     *  @param[in] r The point to transform.
+     *
+     *  @return A new point which is the image of @p r.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the new point.
+     *                        Strong throw guarantee.
+     */
+    point_type operator()(const point_type& r) const;
+
+    /** @brief Transforms @p n points stored as structure-of-arrays.
+     *
+     *  The i-th transformed point is written to `(ox[i], oy[i], oz[i])`. The
+     *  output arrays may be the input arrays (in which case the points are
+     *  transformed in place), but must otherwise not overlap them. The loop
+     *  is written so that it can be vectorized, and if Chemist was built with
+     *  OpenMP it is threaded once @p n is large enough.
+     *
+     *  @param[in] n The number of points.
+     *  @param[in] x The x-coordinates of the points.
+     *  @param[in] y The y-coordinates of the points.
+     *  @param[in] z The z-coordinates of the points.
+     *  @param[out] ox Where to write the transformed x-coordinates.
+     *  @param[out] oy Where to write the transformed y-coordinates.
+     *  @param[out] oz Where to write the transformed z-coordinates.
+     *
+     *  @throw None No throw guarantee.
+     */
+    void apply(size_type n, const_coord_pointer x, const_coord_pointer y,
+               const_coord_pointer z, coord_pointer ox, coord_pointer oy,
+               coord_pointer oz) const noexcept;
+
+    // -------------------------------------------------------------------------
+    // -- Utility methods
+    // -------------------------------------------------------------------------
+
+    /** @brief Composes two transformations.
+     *
+     *  @param[in] rhs The transformation to apply first.
+     *
+     *  @return The transformation which applies @p rhs and then *this.
+     *
+     *  @throw None No throw guarantee.
+     */
+    AffineTransform operator*(const AffineTransform& rhs) const noexcept;
+
+    /** @brief Determines if *this and @p rhs are the same transformation.
+     *
+     *  @param[in] rhs The transformation to compare to.
+     *
+     *  @return True if the matrices and translation vectors are exactly equal
+     *          and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool operator==(const AffineTransform& rhs) const noexcept;
+
+    /// Determines if *this is different than @p rhs
+    bool operator!=(const AffineTransform& rhs) const noexcept {
+        return !((*this) == rhs);
+    }
+
+private:
+    /// The matrix, in row-major order
+    matrix_type m_A_;
+
+    /// The translation vector
+    vector_type m_t_;
+};
+
+extern template class AffineTransform<float>;
+extern template class AffineTransform<double>;
+
+} // namespace chemist
@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <chemist/point/affine_transform.hpp>
 #include <chemist/point/point_class.hpp>
 #include <chemist/point/point_set.hpp>
+#include <chemist/point/point_set_geometry.hpp>
 #include <chemist/point/point_set_view.hpp>
 #include <chemist/point/point_view.hpp>
+#include <chemist/point/space_filling_curve.hpp>
+#include <chemist/point/spatial_index.hpp>
@@ -15,10 +15,16 @@
  */
 
 #pragma once
+#include <chemist/detail_/aligned_array.hpp>
+#include <chemist/enums.hpp>
+#include <chemist/point/affine_transform.hpp>
 #include <chemist/point/point_view.hpp>
 #include <chemist/traits/point_traits.hpp>
 #include <memory>
+#include <span>
+#include <type_traits>
 #include <utilities/containers/indexable_container_base.hpp>
+#include <vector>
 
 namespace chemist {
 namespace detail_ {
@@ -74,9 +80,31 @@ public:
     /// Type of a read-only pointer to a coordinate
     using const_coord_pointer = typename point_traits::const_coord_pointer;
 
+    /// Type of a mutable, contiguous column of coordinates
+    using coord_span = std::span<typename point_traits::coord_type>;
+
+    /// Type of a read-only, contiguous column of coordinates
+    using const_coord_span = std::span<const typename point_traits::coord_type>;
+
+    /// Floating-point type of the coordinates
+    using coord_type = typename value_type::coord_type;
+
     /// Integral type used for indexing
     using size_type = typename base_type::size_type;
 
+    /// Type used to describe a reordering of the points in *this
+    using permutation_type = std::vector<size_type>;
+
+    /// The PointSet type using the other floating-point type (float/double)
+    using other_precision_type =
+      PointSet<std::conditional_t<std::is_same_v<T, float>, double, float>>;
+
+    /// Type of a transformation which can be applied to the points in *this
+    using affine_type = AffineTransform<coord_type>;
+
+    /// Alignment, in bytes, of the pointers returned by x_data(), etc.
+    static constexpr size_type data_alignment = detail_::simd_alignment;
+
     /** @brief Creates an empty PointSet.
      *
      *  A default constructed PointSet behaves like an empty container (e.g.,
@@ -100,6 +128,48 @@ public:
      */
     explicit PointSet(std::initializer_list<value_type> points);
 
+    /** @brief Creates a PointSet from arrays of x, y, and z coordinates.
+     *
+     *  This ctor is meant for populating a PointSet from data which already
+     *  lives in structure-of-arrays form (e.g., a file reader or NumPy). Each
+     *  coordinate array is copied into the PointSet in a single operation, so
+     *  unlike repeated push_back calls there is no per-point overhead and no
+     *  reallocation.
+     *
+     *  @note The coordinate arrays are copied (rather than adopted) because
+     *        PointSet stores its coordinates in aligned, padded arrays. See
+     *        x_data() for details.
+     *
+     *  @param[in] x The x-coordinates of the points.
+     *  @param[in] y The y-coordinates of the points. Must be the same length
+     *               as @p x.
+     *  @param[in] z The z-coordinates of the points. Must be the same length
+     *               as @p x.
+     *
+     *  @throw std::runtime_error if @p x, @p y, and @p z are not the same
+     *                            length. Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    PointSet(std::span<const coord_type> x, std::span<const coord_type> y,
+             std::span<const coord_type> z);
+
+    /** @brief Creates a PointSet by converting the coordinates of @p other to
+     *         the floating-point type of *this.
+     *
+     *  Each coordinate array is converted in a single (vectorizable) pass.
+     *  A common use is making a single-precision copy of a double-precision
+     *  grid for screening (see the mixed-precision neighbor_mask overloads).
+     *  Converting from double to float rounds each coordinate to the nearest
+     *  float.
+     *
+     *  @param[in] other The PointSet to convert.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    explicit PointSet(const other_precision_type& other);
+
     /** @brief Creates a PointSet which is a deep copy of @p other.
      *
      *  @param[in] other The PointSet being copied.
@@ -170,6 +240,81 @@ public:
      */
     void push_back(value_type r);
 
+    /** @brief Ensures *this can hold @p n points without reallocating.
+     *
+     *  This method is an optimization for when the number of points is known
+     *  before they are added via push_back. It does not change the number of
+     *  points in *this.
+     *
+     *  @param[in] n The number of points *this should be able to hold.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    void reserve(size_type n);
+
+    /** @brief Reorders the points in *this according to @p p.
+     *
+     *  After this call the i-th point of *this is the point which was
+     *  previously the `p[i]`-th point. References to points in *this, and the
+     *  pointers returned by x_data(), etc., are invalidated.
+     *
+     *  @param[in] p A permutation of [0, size()).
+     *
+     *  @throw std::runtime_error if @p p is not a permutation of [0, size()).
+     *                            Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    void permute(const permutation_type& p);
+
+    /** @brief Sorts the points in *this along a space-filling curve.
+     *
+     *  Storing the points in curve order means that consecutive points are
+     *  close in space, which improves the cache behavior of loops over the
+     *  points. See space_filling_curve_order for details on the ordering.
+     *
+     *  The returned permutation can be used to reorder data which parallels
+     *  *this (see permute) and its inverse (see inverse_permutation) maps
+     *  results computed with the reordered points back to the original order.
+     *
+     *  @param[in] curve The space-filling curve to sort along. Defaults to
+     *                   Hilbert.
+     *
+     *  @return The permutation which was applied to *this, i.e., the new i-th
+     *          point is the old `rv[i]`-th point.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    permutation_type reorder(
+      SpaceFillingCurve curve = SpaceFillingCurve::hilbert);
+
+    /** @brief Applies @p f to every point in *this.
+     *
+     *  The transformation runs directly over the coordinate arrays of *this
+     *  (see AffineTransform::apply), which is much faster than transforming
+     *  the points one at a time through references. References to points in
+     *  *this remain valid.
+     *
+     *  @param[in] f The transformation to apply.
+     *
+     *  @throw None No throw guarantee.
+     */
+    void transform(const affine_type& f) noexcept;
+
+    /** @brief Returns a copy of *this with @p f applied to every point.
+     *
+     *  @param[in] f The transformation to apply.
+     *
+     *  @return A new PointSet whose i-th point is the image of the i-th point
+     *          of *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    PointSet transformed(const affine_type& f) const;
+
     // -------------------------------------------------------------------------
     // -- Accessors
     // -------------------------------------------------------------------------
@@ -181,7 +326,9 @@ public:
      *  x-coordinate.
      *
      *  @return The address of the 0-th point's x-coordinate. If *this has no
-     *          points this method returns a nullptr.
+     *          points this method returns a nullptr. Otherwise the address is
+     *          aligned to `data_alignment` bytes and the array holds
+     *          padded_size() elements, where elements past size() are 0.
      *
      *  @throw No throw guarantee.
      */
@@ -194,7 +341,9 @@ public:
      *  x-coordinate.
      *
      *  @return The address of the 0-th point's x-coordinate. If *this has no
-     *          points this method returns a nullptr.
+     *          points this method returns a nullptr. Otherwise the address is
+     *          aligned to `data_alignment` bytes and the array holds
+     *          padded_size() elements, where elements past size() are 0.
      *
      *  @throw No throw guarantee.
      */
@@ -207,7 +356,9 @@ public:
      *  y-coordinate.
      *
      *  @return The address of the 0-th point's y-coordinate. If *this has no
-     *          points this method returns a nullptr.
+     *          points this method returns a nullptr. Otherwise the address is
+     *          aligned to `data_alignment` bytes and the array holds
+     *          padded_size() elements, where elements past size() are 0.
      *
      *  @throw No throw guarantee.
      */
@@ -220,7 +371,9 @@ public:
      *  y-coordinate.
      *
      *  @return The address of the 0-th point's y-coordinate. If *this has no
-     *          points this method returns a nullptr.
+     *          points this method returns a nullptr. Otherwise the address is
+     *          aligned to `data_alignment` bytes and the array holds
+     *          padded_size() elements, where elements past size() are 0.
      *
      *  @throw No throw guarantee.
      */
@@ -233,7 +386,9 @@ public:
      *  z-coordinate.
      *
      *  @return The address of the 0-th point's z-coordinate. If *this has no
-     *          points this method returns a nullptr.
+     *          points this method returns a nullptr. Otherwise the address is
+     *          aligned to `data_alignment` bytes and the array holds
+     *          padded_size() elements, where elements past size() are 0.
      *
      *  @throw No throw guarantee.
      */
@@ -246,12 +401,57 @@ public:
      *  z-coordinate.
      *
      *  @return The address of the 0-th point's z-coordinate. If *this has no
-     *          points this method returns a nullptr.
+     *          points this method returns a nullptr. Otherwise the address is
+     *          aligned to `data_alignment` bytes and the array holds
+     *          padded_size() elements, where elements past size() are 0.
      *
      *  @throw No throw guarantee.
      */
     const_coord_pointer z_data() const noexcept;
 
+    /** @brief The number of elements in each coordinate array.
+     *
+     *  The arrays returned by x_data(), y_data(), and z_data() are padded so
+     *  that their length is a multiple of the SIMD width (the number of
+     *  coordinates which fit in `data_alignment` bytes). Vectorized loops may
+     *  thus run over padded_size() elements without a remainder loop. The
+     *  padding elements are always 0.
+     *
+     *  @return The number of elements in each coordinate array, including
+     *          padding. An empty PointSet returns 0.
+     *
+     *  @throw None No throw guarantee.
+     */
+    size_type padded_size() const noexcept;
+
+    /** @brief Returns the x-, y-, or z-coordinates of the points as a column.
+     *
+     *  Hot loops should run over these columns rather than over `(*this)[i]`,
+     *  which builds a PointView for each point. The i-th element of each
+     *  column is the respective coordinate of the i-th point. The columns do
+     *  not include the padding (see padded_size()).
+     *
+     *  @return A span over size() coordinates. The span is invalidated by
+     *          anything which invalidates the pointer returned by x_data(),
+     *          etc.
+     *
+     *  @throw None No throw guarantee.
+     */
+    ///@{
+    coord_span x_column() noexcept { return coord_span(x_data(), size_()); }
+    coord_span y_column() noexcept { return coord_span(y_data(), size_()); }
+    coord_span z_column() noexcept { return coord_span(z_data(), size_()); }
+    const_coord_span x_column() const noexcept {
+        return const_coord_span(x_data(), size_());
+    }
+    const_coord_span y_column() const noexcept {
+        return const_coord_span(y_data(), size_());
+    }
+    const_coord_span z_column() const noexcept {
+        return const_coord_span(z_data(), size_());
+    }
+    ///@}
+
     // -------------------------------------------------------------------------
     // -- Utility
     // -------------------------------------------------------------------------
@@ -0,0 +1,235 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file point_set_geometry.hpp
+ *
+ *  Batched geometry kernels (distances and cutoff screening) which operate on
+ *  the structure-of-arrays storage of PointSet objects. The kernels are tiled
+ *  so that a block of the right-hand set stays in cache while a block of the
+ *  left-hand set streams over it, the innermost loops are written so the
+ *  compiler can vectorize them, and the tiles are distributed over threads
+ *  (if Chemist was built with OpenMP) once the number of pairs is large
+ *  enough to amortize the threading overhead.
+ *
+ *  All functions are provided for PointSet objects and for PointSetView
+ *  objects. PointSet objects, and contiguous PointSetView objects, are
+ *  processed in place. Other PointSetView objects are first gathered into
+ *  contiguous buffers, which costs O(N) time and memory and is negligible
+ *  compared to the O(NM) kernels.
+ *
+ *  Matrices are returned as row-major, flattened std::vector objects.
+ *
+ *  For screening large double-precision sets (e.g., grids) there are also
+ *  mixed-precision overloads of neighbor_mask. They reject far away points in
+ *  single precision, which doubles the SIMD width and halves the memory
+ *  traffic, and only recheck the survivors in double precision.
+ */
+#pragma once
+#include <chemist/point/point_class.hpp>
+#include <chemist/point/point_set.hpp>
+#include <chemist/point/point_set_view.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace chemist {
+
+/// Type used to return which pairs of points are within a cutoff
+using neighbor_mask_type = std::vector<std::uint8_t>;
+
+/** @brief Computes the distance between every pair of points in @p points.
+ *
+ *  @tparam T The floating-point type of the coordinates.
+ *
+ *  @param[in] points The set of @f$N@f$ points.
+ *
+ *  @return An @f$N@f$ by @f$N@f$ row-major matrix such that element
+ *          @f$(i, j)@f$ is the distance between points @f$i@f$ and @f$j@f$.
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+template<typename T>
+std::vector<T> distance_matrix(const PointSet<T>& points);
+
+/** @brief Computes the distance from every point in @p lhs to every point in
+ *         @p rhs.
+ *
+ *  @tparam T The floating-point type of the coordinates.
+ *
+ *  @param[in] lhs The @f$N@f$ points labeling the rows of the result.
+ *  @param[in] rhs The @f$M@f$ points labeling the columns of the result.
+ *
+ *  @return An @f$N@f$ by @f$M@f$ row-major matrix such that element
+ *          @f$(i, j)@f$ is the distance between point @f$i@f$ of @p lhs and
+ *          point @f$j@f$ of @p rhs.
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+template<typename T>
+std::vector<T> distance_matrix(const PointSet<T>& lhs, const PointSet<T>& rhs);
+
+/** @brief Computes the distance from @p r to every point in @p points.
+ *
+ *  @tparam T The floating-point type of the coordinates.
+ *
+ *  @param[in] r The point we are measuring distances from.
+ *  @param[in] points The @f$N@f$ points we are measuring distances to.
+ *
+ *  @return An @f$N@f$ element vector whose @f$i@f$-th element is the distance
+ *          from @p r to the @f$i@f$-th point of @p points.
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+template<typename T>
+std::vector<T> distances(const Point<T>& r, const PointSet<T>& points);
+
+/** @brief Determines which points of @p points are within @p cutoff of @p r.
+ *
+ *  A point is considered to be within the cutoff if its distance to @p r is
+ *  less than or equal to @p cutoff. The comparison is done on squared
+ *  distances so no square roots are taken.
+ *
+ *  @tparam T The floating-point type of the coordinates.
+ *
+ *  @param[in] r The point at the center of the cutoff sphere.
+ *  @param[in] points The @f$N@f$ points to screen.
+ *  @param[in] cutoff The radius of the cutoff sphere.
+ *
+ *  @return An @f$N@f$ element mask whose @f$i@f$-th element is 1 if the
+ *          @f$i@f$-th point is within @p cutoff of @p r and 0 otherwise.
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+template<typename T>
+neighbor_mask_type neighbor_mask(const Point<T>& r, const PointSet<T>& points,
+                                 T cutoff);
+
+/** @brief Determines which pairs of points are within @p cutoff of each other.
+ *
+ *  @tparam T The floating-point type of the coordinates.
+ *
+ *  @param[in] lhs The @f$N@f$ points labeling the rows of the result.
+ *  @param[in] rhs The @f$M@f$ points labeling the columns of the result.
+ *  @param[in] cutoff The maximum distance for two points to be neighbors.
+ *
+ *  @return An @f$N@f$ by @f$M@f$ row-major mask such that element
+ *          @f$(i, j)@f$ is 1 if point @f$i@f$ of @p lhs is within @p cutoff of
+ *          point @f$j@f$ of @p rhs and 0 otherwise.
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+template<typename T>
+neighbor_mask_type neighbor_mask(const PointSet<T>& lhs,
+                                 const PointSet<T>& rhs, T cutoff);
+
+// -- Mixed-precision overloads ------------------------------------------------
+
+/** @brief Determines which points of @p points are within @p cutoff of @p r,
+ *         screening in single precision.
+ *
+ *  Most points of a large set are usually far from @p r. This overload
+ *  rejects them using @p screen, a single-precision copy of @p points (e.g.,
+ *  `PointSet<float>(points)`, made once and reused across queries). The
+ *  screen is padded by a bound on its rounding error, so it never rejects a
+ *  point which is within @p cutoff. The points which survive are then checked
+ *  in double precision. The result is therefore the same as that of
+ *  `neighbor_mask(r, points, cutoff)`.
+ *
+ *  @param[in] r The point at the center of the cutoff sphere.
+ *  @param[in] points The @f$N@f$ points to screen.
+ *  @param[in] screen @p points rounded to single precision.
+ *  @param[in] cutoff The radius of the cutoff sphere.
+ *
+ *  @return An @f$N@f$ element mask whose @f$i@f$-th element is 1 if the
+ *          @f$i@f$-th point is within @p cutoff of @p r and 0 otherwise.
+ *
+ *  @throw std::runtime_error if @p screen and @p points do not contain the
+ *                            same number of points. Strong throw guarantee.
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+neighbor_mask_type neighbor_mask(const Point<double>& r,
+                                 const PointSet<double>& points,
+                                 const PointSet<float>& screen, double cutoff);
+
+/** @brief Determines which pairs of points are within @p cutoff of each other,
+ *         screening in single precision.
+ *
+ *  This is the pairwise version of the single-point mixed-precision overload.
+ *  The result is the same as that of `neighbor_mask(lhs, rhs, cutoff)`.
+ *
+ *  @param[in] lhs The @f$N@f$ points labeling the rows of the result.
+ *  @param[in] lhs_screen @p lhs rounded to single precision.
+ *  @param[in] rhs The @f$M@f$ points labeling the columns of the result.
+ *  @param[in] rhs_screen @p rhs rounded to single precision.
+ *  @param[in] cutoff The maximum distance for two points to be neighbors.
+ *
+ *  @return An @f$N@f$ by @f$M@f$ row-major mask such that element
+ *          @f$(i, j)@f$ is 1 if point @f$i@f$ of @p lhs is within @p cutoff of
+ *          point @f$j@f$ of @p rhs and 0 otherwise.
+ *
+ *  @throw std::runtime_error if a set and its screen do not contain the same
+ *                            number of points. Strong throw guarantee.
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+neighbor_mask_type neighbor_mask(const PointSet<double>& lhs,
+                                 const PointSet<float>& lhs_screen,
+                                 const PointSet<double>& rhs,
+                                 const PointSet<float>& rhs_screen,
+                                 double cutoff);
+
+// -- PointSetView overloads ---------------------------------------------------
+
+/** @brief Overloads of the geometry kernels for PointSetView objects.
+ *
+ *  These overloads behave exactly like their PointSet counterparts. See the
+ *  PointSet overloads for full descriptions.
+ *
+ *  @tparam PointSetType The cv-qualified PointSet type being viewed.
+ */
+///@{
+template<typename PointSetType>
+auto distance_matrix(const PointSetView<PointSetType>& points)
+  -> std::vector<typename PointSetView<PointSetType>::value_type::coord_type>;
+
+template<typename PointSetType>
+auto distance_matrix(const PointSetView<PointSetType>& lhs,
+                     const PointSetView<PointSetType>& rhs)
+  -> std::vector<typename PointSetView<PointSetType>::value_type::coord_type>;
+
+template<typename PointSetType>
+auto distances(const typename PointSetView<PointSetType>::value_type& r,
+               const PointSetView<PointSetType>& points)
+  -> std::vector<typename PointSetView<PointSetType>::value_type::coord_type>;
+
+template<typename PointSetType>
+neighbor_mask_type neighbor_mask(
+  const typename PointSetView<PointSetType>::value_type& r,
+  const PointSetView<PointSetType>& points,
+  typename PointSetView<PointSetType>::value_type::coord_type cutoff);
+
+template<typename PointSetType>
+neighbor_mask_type neighbor_mask(
+  const PointSetView<PointSetType>& lhs, const PointSetView<PointSetType>& rhs,
+  typename PointSetView<PointSetType>::value_type::coord_type cutoff);
+///@}
+
+} // namespace chemist
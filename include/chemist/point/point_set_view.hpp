@@ -19,7 +19,10 @@
 #include <chemist/point/point_set.hpp>
 #include <chemist/traits/point_traits.hpp>
 #include <memory>
+#include <span>
+#include <type_traits>
 #include <utilities/containers/indexable_container_base.hpp>
+#include <vector>
 
 namespace chemist {
 namespace detail_ {
@@ -78,12 +81,33 @@ public:
     /// Type of a pointer to a PIMPL
     using pimpl_pointer = std::unique_ptr<pimpl_type>;
 
+    /// Type of a pointer to the PIMPL of a read-only view
+    using const_pimpl_pointer =
+      std::unique_ptr<detail_::PointSetViewPIMPL<const point_set_type>>;
+
     /// Type of a pointer to a mutable coordinate in a Point
     using coord_pointer = typename point_traits_type::coord_pointer;
 
+    /// Type of a contiguous column of coordinates, read-only if PointSetType
+    /// is const-qualified
+    using coord_span = std::span<std::remove_pointer_t<coord_pointer>>;
+
+    /// Type of a read-only, contiguous column of coordinates
+    using const_coord_span =
+      std::span<const typename point_traits_type::coord_type>;
+
     /// Type used for indexing and offsets
     using typename base_type::size_type;
 
+    /// Type used to specify which points of a supersystem are in a subset
+    using member_list_type = std::vector<size_type>;
+
+    /// Type of a container filled with PointSetView objects
+    using point_set_view_container = std::vector<my_type>;
+
+    /// Type of a transformation which can be applied to the aliased points
+    using affine_type = AffineTransform<typename point_traits_type::coord_type>;
+
     // -------------------------------------------------------------------------
     // -- Ctors, Assignment, and dtor
     // -------------------------------------------------------------------------
@@ -131,6 +155,80 @@ public:
     PointSetView(size_type n_points, coord_pointer px, coord_pointer py,
                  coord_pointer pz);
 
+    /** @brief Creates a PointSetView from three strided buffers.
+     *
+     *  This ctor is used to alias coordinates which are not stored in three
+     *  contiguous arrays, e.g., an interleaved `x0, y0, z0, x1, ...` buffer
+     *  or an array of structures with one member per coordinate. No copy of
+     *  the coordinates is made. For an interleaved buffer `pxyz` of doubles
+     *  the call is:
+     *
+     *  ```
+     *  PointSetView v(n, pxyz, pxyz + 1, pxyz + 2, 3 * sizeof(double));
+     *  ```
+     *
+     *  @param[in] n_points The number of points being aliased.
+     *  @param[in] px A pointer to the x-coordinate of the first point. Should
+     *                be a null pointer if @p n_points is 0.
+     *  @param[in] py A pointer to the y-coordinate of the first point. Should
+     *                be a null pointer if @p n_points is 0.
+     *  @param[in] pz A pointer to the z-coordinate of the first point. Should
+     *                be a null pointer if @p n_points is 0.
+     *  @param[in] stride The distance, in bytes, from one point's coordinate
+     *                    to the next point's coordinate. It is the same for
+     *                    all three coordinates and should be a multiple of
+     *                    the coordinate type's alignment.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the internal
+     *                        state. Strong throw guarantee.
+     */
+    PointSetView(size_type n_points, coord_pointer px, coord_pointer py,
+                 coord_pointer pz, size_type stride);
+
+    /** @brief Creates a view of a subset of the points in @p supersystem.
+     *
+     *  The resulting view will alias `members.size()` points, such that the
+     *  i-th point of *this is `supersystem[members[i]]`. The indices in
+     *  @p members need not be sorted. In particular, if a PointSet was
+     *  reordered with the permutation `p`, then
+     *
+     *  ```
+     *  PointSetView original_order(reordered, inverse_permutation(p));
+     *  ```
+     *
+     *  presents the reordered points in their original order.
+     *
+     *  @param[in] supersystem An alias of the supersystem.
+     *  @param[in] members The indices of the points in @p supersystem which
+     *                     are in *this. Each index should be in the range
+     *                     [0, supersystem.size()).
+     *
+     *  @note If the data @p supersystem aliases is invalidated it will also
+     *        invalidate *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the PIMPL. Strong
+     *                        throw guarantee.
+     */
+    PointSetView(PointSetView supersystem, member_list_type members);
+
+    /** @brief Initializes *this to the union of @p members.
+     *
+     *  This ctor is used to create a PointSetView which aliases the PointSet
+     *  formed by concatenating the PointSet objects aliased in @p members,
+     *  e.g., to treat two separately stored regions as one set of points
+     *  without copying either of them.
+     *
+     *  @param[in] members A container with aliases to the PointSet objects to
+     *                     take the union of.
+     *
+     *  @note If the data aliased by an element of @p members is invalidated
+     *        it will also invalidate *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the PIMPL. Strong
+     *                        throw guarantee.
+     */
+    explicit PointSetView(point_set_view_container members);
+
     /** @brief Implicitly allows mutable PointSetView objects to be converted
      *         to read-only PointSetView objects.
      *
@@ -154,10 +252,7 @@ public:
     template<typename PointSetType2,
              typename = enable_mutable_to_const_t<PointSetType2>>
     PointSetView(const PointSetView<PointSetType2>& other) :
-      // N.b. this implementation will NOT work if we add more PIMPL types
-      PointSetView(other.size(), other.size() ? &other.at(0).coord(0) : nullptr,
-                   other.size() ? &other.at(0).coord(1) : nullptr,
-                   other.size() ? &other.at(0).coord(2) : nullptr) {}
+      PointSetView(other.as_const_()) {}
 
     /** @brief Base ctor for stateful ctors.
      *
@@ -302,6 +397,10 @@ public:
      *  state. This method is used to convert *this from aliasing its state
      *  to owning it (this happens by deep copying the internal state).
      *
+     *  The copy is made a column at a time. Contiguous and strided views copy
+     *  straight out of the aliased arrays, and subsets of contiguous views
+     *  gather their members out of the supersystem's arrays.
+     *
      *  @return A new PointSet object containing a copy of the state in *this.
      *
      *  @throw std::bad_alloc if there is a problem allocating the return.
@@ -309,16 +408,94 @@ public:
      */
     point_set_type as_point_set() const;
 
+    /** @brief Determines if the aliased coordinates are stored as contiguous
+     *         columns.
+     *
+     *  Views of PointSet objects and views of three contiguous buffers are
+     *  contiguous, as are strided views whose stride is the size of one
+     *  coordinate. Views of subsets are not. Empty views are contiguous.
+     *
+     *  @return True if x_column(), etc. can be called and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool is_contiguous() const noexcept;
+
+    /** @brief Returns the aliased x-, y-, or z-coordinates as a column.
+     *
+     *  See PointSet::x_column for details.
+     *
+     *  @return A span over the size() aliased coordinates.
+     *
+     *  @throw std::runtime_error if *this is not contiguous (see
+     *                            is_contiguous()). Strong throw guarantee.
+     */
+    ///@{
+    coord_span x_column() { return coord_span(column_data_(0), size_()); }
+    coord_span y_column() { return coord_span(column_data_(1), size_()); }
+    coord_span z_column() { return coord_span(column_data_(2), size_()); }
+    const_coord_span x_column() const {
+        return const_coord_span(column_data_(0), size_());
+    }
+    const_coord_span y_column() const {
+        return const_coord_span(column_data_(1), size_());
+    }
+    const_coord_span z_column() const {
+        return const_coord_span(column_data_(2), size_());
+    }
+    ///@}
+
+    /** @brief Applies @p f to every aliased point.
+     *
+     *  If *this is contiguous the columns are transformed directly. Otherwise
+     *  the points are transformed in tiles: each tile is gathered into a
+     *  small buffer, transformed with AffineTransform::apply, and scattered
+     *  back. This method is only available for views of mutable PointSet
+     *  objects.
+     *
+     *  @param[in] f The transformation to apply.
+     *
+     *  @throw std::bad_alloc if *this is not contiguous and there is a problem
+     *                        creating the views used to gather or scatter the
+     *                        points. Basic throw guarantee, the tiles before
+     *                        the failing one are already transformed. Never
+     *                        throws if *this is contiguous.
+     */
+    void transform(const affine_type& f)
+      requires(!std::is_const_v<PointSetType>);
+
+    /** @brief Returns a PointSet holding the images of the aliased points.
+     *
+     *  The aliased points are not modified, so this method is available for
+     *  read-only views too.
+     *
+     *  @param[in] f The transformation to apply.
+     *
+     *  @return A new PointSet whose i-th point is the image of the i-th point
+     *          of *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    point_set_type transformed(const affine_type& f) const;
+
 private:
     /// Allow base class to access implementations
     friend base_type;
 
+    /// Allows the mutable-to-const conversion to access as_const_
+    template<typename PointSetType2>
+    friend class PointSetView;
+
     /// Used internally to determine if *this has a PIMPL or not
     bool has_pimpl_() const noexcept;
 
     /// Wraps cloning the PIMPL, accounting for when there isn't one
     pimpl_pointer clone_pimpl_() const;
 
+    /// Makes a read-only view aliasing the same PointSet as *this
+    PointSetView<const point_set_type> as_const_() const;
+
     /// Implements at/operator[] for the base class
     reference at_(size_type i);
 
@@ -328,6 +505,10 @@ private:
     /// Implements size for the base class
     size_type size_() const noexcept;
 
+    /// Address of the first coordinate of column @p xyz, throws if there is
+    /// no such column
+    coord_pointer column_data_(size_type xyz) const;
+
     /// The actual object holding the state of *this
     pimpl_pointer m_pimpl_;
 };
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file space_filling_curve.hpp
+ *
+ *  Functions for ordering points along a space-filling curve. Points which
+ *  are close along a Morton (Z-order) or Hilbert curve are also close in
+ *  space, so storing points in curve order means that blocks of consecutive
+ *  points are spatially compact. That in turn improves the cache behavior of
+ *  anything which loops over the points, e.g., grid quadrature, integral
+ *  screening, and neighbor searches.
+ *
+ *  The functions here only compute orderings. The containers (PointSet,
+ *  Charges, Grid, Nuclei, and Molecule) have `reorder` members which apply
+ *  the ordering and return the permutation. Results computed in the new order
+ *  can be mapped back to the original order with the inverse permutation,
+ *  e.g., by creating a subset view whose members are the inverse permutation.
+ *
+ *  All permutations follow the convention that the new i-th point is the old
+ *  `p[i]`-th point.
+ */
+#pragma once
+#include <chemist/enums.hpp>
+#include <chemist/point/point_set.hpp>
+#include <chemist/point/point_set_view.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace chemist {
+
+/** @brief Computes the order of @p points along a space-filling curve.
+ *
+ *  The bounding box of @p points is divided into a @f$2^{21}@f$ by
+ *  @f$2^{21}@f$ by @f$2^{21}@f$ lattice and each point is assigned the index
+ *  of its lattice cell along @p curve. Points are then sorted by that index
+ *  (ties keep their original relative order). The Hilbert curve has better
+ *  locality (consecutive cells are always adjacent), whereas Morton indices
+ *  are slightly cheaper to compute.
+ *
+ *  @tparam T The floating-point type of the coordinates.
+ *
+ *  @param[in] points The points to order.
+ *  @param[in] curve Which space-filling curve to use. Defaults to Hilbert.
+ *
+ *  @return A permutation `p` such that `points[p[0]], points[p[1]], ...` are
+ *          in curve order.
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+template<typename T>
+std::vector<std::size_t> space_filling_curve_order(
+  const PointSet<T>& points,
+  SpaceFillingCurve curve = SpaceFillingCurve::hilbert);
+
+/** @brief Overload of space_filling_curve_order for PointSetView objects.
+ *
+ *  This overload behaves exactly like the PointSet overload.
+ *
+ *  @tparam PointSetType The cv-qualified PointSet type being viewed.
+ */
+template<typename PointSetType>
+std::vector<std::size_t> space_filling_curve_order(
+  const PointSetView<PointSetType>& points,
+  SpaceFillingCurve curve = SpaceFillingCurve::hilbert);
+
+/** @brief Inverts the permutation @p p.
+ *
+ *  If @p p was used to reorder a container (so that the new i-th element is
+ *  the old `p[i]`-th element), then the returned permutation `q` satisfies
+ *  `q[p[i]] == i`, i.e., the element which was originally at index j is now
+ *  at index `q[j]`. `q` is thus the member list of a subset view (e.g.,
+ *  NucleiView or PointSetView) which presents the reordered container in
+ *  its original order.
+ *
+ *  @param[in] p The permutation to invert.
+ *
+ *  @return The inverse of @p p.
+ *
+ *  @throw std::runtime_error if @p p is not a permutation. Strong throw
+ *                            guarantee.
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+std::vector<std::size_t> inverse_permutation(
+  const std::vector<std::size_t>& p);
+
+} // namespace chemist
@@ -0,0 +1,281 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <chemist/point/point_class.hpp>
+#include <chemist/point/point_set.hpp>
+#include <chemist/point/point_set_view.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace chemist {
+namespace detail_ {
+template<typename T>
+class SpatialIndexPIMPL;
+}
+
+/** @brief Accelerates neighbor searches over a set of points.
+ *
+ *  Many algorithms only care about pairs of points which are within some
+ *  cutoff of each other (bond perception, screening of fragment n-mers,
+ *  truncating charge embeddings, screening grid points, etc.). Comparing
+ *  every pair of points is @f$\mathcal{O}(N^2)@f$. SpatialIndex instead
+ *  partitions the points into a k-d tree, after which radius and k-nearest
+ *  neighbor queries cost roughly @f$\mathcal{O}(\log N)@f$ plus the number of
+ *  points found.
+ *
+ *  The index stores its own copy of the coordinates (sorted so that points in
+ *  the same leaf of the tree are contiguous in memory). It therefore does not
+ *  alias the points it was built from and can be cached alongside them. When
+ *  only some of the points move, update() refreshes the index in time
+ *  proportional to the number of moved points (times, at worst, the depth of
+ *  the tree) rather than rebuilding it.
+ *
+ *  Indices returned by queries are the indices of the points in the PointSet
+ *  (or PointSetView) the index was built from. Charges, Nuclei, and Grid
+ *  objects can be indexed through their `point_set()` views.
+ *
+ *  If Chemist was built with OpenMP, building the tree and batched queries
+ *  are threaded.
+ *
+ *  @tparam T The floating-point type of the coordinates.
+ */
+template<typename T>
+class SpatialIndex {
+public:
+    /// Type of the PIMPL
+    using pimpl_type = detail_::SpatialIndexPIMPL<T>;
+
+    /// Type of a pointer to the PIMPL
+    using pimpl_pointer = std::unique_ptr<pimpl_type>;
+
+    /// Floating-point type of the coordinates
+    using coord_type = T;
+
+    /// Type of a point which can be used as a query
+    using point_type = Point<T>;
+
+    /// Type of the set of points which can be indexed
+    using point_set_type = PointSet<T>;
+
+    /// Integral type used for indexing
+    using size_type = std::size_t;
+
+    /// Type used to return the indices of the points found by a query
+    using index_list_type = std::vector<size_type>;
+
+    /// Type used to return the results of a batch of queries
+    using batch_result_type = std::vector<index_list_type>;
+
+    /// Type used to return pairs of neighboring points
+    using pair_list_type = std::vector<std::pair<size_type, size_type>>;
+
+    // -------------------------------------------------------------------------
+    // -- Ctors, assignment, and dtor
+    // -------------------------------------------------------------------------
+
+    /** @brief Creates an index of zero points.
+     *
+     *  @throw None No throw guarantee.
+     */
+    SpatialIndex() noexcept;
+
+    /** @brief Builds an index over @p points.
+     *
+     *  @param[in] points The points to index. *this copies the coordinates,
+     *                    i.e., *this does not alias @p points.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the index.
+     *                        Strong throw guarantee.
+     */
+    explicit SpatialIndex(const point_set_type& points);
+
+    /** @brief Builds an index over the points aliased by @p points.
+     *
+     *  This ctor behaves exactly like the PointSet ctor.
+     *
+     *  @tparam PointSetType The cv-qualified PointSet type @p points aliases.
+     */
+    template<typename PointSetType>
+    explicit SpatialIndex(const PointSetView<PointSetType>& points);
+
+    /// Deep copies @p other (the copy does not share state with @p other)
+    SpatialIndex(const SpatialIndex& other);
+
+    /// Takes ownership of @p other's index, @p other is left empty
+    SpatialIndex(SpatialIndex&& other) noexcept;
+
+    /// Deep copies @p rhs into *this
+    SpatialIndex& operator=(const SpatialIndex& rhs);
+
+    /// Takes ownership of @p rhs's index, @p rhs is left empty
+    SpatialIndex& operator=(SpatialIndex&& rhs) noexcept;
+
+    /// Default no-throw dtor
+    ~SpatialIndex() noexcept;
+
+    // -------------------------------------------------------------------------
+    // -- Incremental updates
+    // -------------------------------------------------------------------------
+
+    /** @brief Updates the coordinates of the points in @p changed.
+     *
+     *  For each index `i` in @p changed, the coordinates of the i-th point
+     *  are reread from @p points. Instead of rebuilding the tree, the
+     *  bounding boxes of the affected leaves are refit, as are those of their
+     *  ancestors up to the first one whose box did not change, so queries
+     *  remain exact. The cost is thus at most proportional to the number of
+     *  moved points times the depth of the tree. If most of the points
+     *  changed, the tree is rebuilt from scratch instead.
+     *
+     *  Refitting does not move points between leaves. If the moved points
+     *  wander far from their original neighbors the boxes grow and queries
+     *  slow down (but stay correct); call rebuild() to restore the balance.
+     *
+     *  @param[in] points The new coordinates of all the points. Must have the
+     *                    same number of points as *this.
+     *  @param[in] changed The indices of the points which moved.
+     *
+     *  @throw std::runtime_error if @p points has a different number of points
+     *                            than *this. Strong throw guarantee.
+     *  @throw std::out_of_range if an index in @p changed is not in the range
+     *                           [0, size()). Strong throw guarantee.
+     */
+    void update(const point_set_type& points, const index_list_type& changed);
+
+    /** @brief Updates the coordinates of the points in @p changed.
+     *
+     *  This overload behaves exactly like the PointSet overload. If @p points
+     *  is not contiguous (see PointSetView::is_contiguous) its coordinates
+     *  must first be gathered, which costs time proportional to its size.
+     *
+     *  @tparam PointSetType The cv-qualified PointSet type @p points aliases.
+     */
+    template<typename PointSetType>
+    void update(const PointSetView<PointSetType>& points,
+                const index_list_type& changed);
+
+    /** @brief Rebuilds the tree from the current coordinates.
+     *
+     *  Useful after a series of calls to update() which moved points far.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the new tree.
+     *                        Strong throw guarantee.
+     */
+    void rebuild();
+
+    // -------------------------------------------------------------------------
+    // -- Queries
+    // -------------------------------------------------------------------------
+
+    /// The number of points in *this
+    size_type size() const noexcept;
+
+    /// True if *this contains no points
+    bool empty() const noexcept { return size() == 0; }
+
+    /** @brief Finds the points within @p radius of @p r.
+     *
+     *  @param[in] r The point to search around.
+     *  @param[in] radius The search radius. Points exactly @p radius away from
+     *                    @p r are included.
+     *
+     *  @return The indices of the points within @p radius of @p r, sorted in
+     *          ascending order.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    index_list_type radius_query(const point_type& r, coord_type radius) const;
+
+    /** @brief Finds the @p k points closest to @p r.
+     *
+     *  @param[in] r The point to search around.
+     *  @param[in] k The number of neighbors to find. If @p k is larger than
+     *               size() all of the points are returned.
+     *
+     *  @return The indices of the min(@p k, size()) points closest to @p r,
+     *          sorted by increasing distance (ties are broken by index).
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    index_list_type nearest_neighbors(const point_type& r, size_type k) const;
+
+    /** @brief Performs a radius query around each point in @p queries.
+     *
+     *  @param[in] queries The points to search around.
+     *  @param[in] radius The search radius.
+     *
+     *  @return A container whose i-th element is `radius_query(queries[i],
+     *          radius)`.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    batch_result_type radius_query(const point_set_type& queries,
+                                   coord_type radius) const;
+
+    /** @brief Performs a k-nearest neighbor query for each point in @p queries
+     *
+     *  @param[in] queries The points to search around.
+     *  @param[in] k The number of neighbors to find for each query.
+     *
+     *  @return A container whose i-th element is `nearest_neighbors(
+     *          queries[i], k)`.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    batch_result_type nearest_neighbors(const point_set_type& queries,
+                                        size_type k) const;
+
+    /** @brief Finds all pairs of indexed points within @p radius of each
+     *         other.
+     *
+     *  This is the "self" radius query, which is what, e.g., bond perception
+     *  needs.
+     *
+     *  @param[in] radius The maximum distance between two neighbors.
+     *
+     *  @return The pairs `(i, j)`, with `i < j`, of points which are within
+     *          @p radius of each other, sorted lexicographically.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    pair_list_type neighbor_pairs(coord_type radius) const;
+
+    // -------------------------------------------------------------------------
+    // -- Utility methods
+    // -------------------------------------------------------------------------
+
+    /// Exchanges the state of *this with that of @p other
+    void swap(SpatialIndex& other) noexcept;
+
+private:
+    /// True if *this has a PIMPL
+    bool has_pimpl_() const noexcept;
+
+    /// The object actually implementing *this
+    pimpl_pointer m_pimpl_;
+};
+
+extern template class SpatialIndex<float>;
+extern template class SpatialIndex<double>;
+
+} // namespace chemist
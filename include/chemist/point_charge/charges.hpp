@@ -19,6 +19,7 @@
 #include <chemist/point_charge/point_charge_view.hpp>
 #include <chemist/traits/point_charge_traits.hpp>
 #include <utilities/containers/indexable_container_base.hpp>
+#include <span>
 #include <vector>
 
 namespace chemist {
@@ -93,6 +94,12 @@ public:
     using const_charge_pointer =
       typename point_charge_traits::const_charge_pointer;
 
+    /// Type of a mutable, contiguous column of charges
+    using charge_span = std::span<charge_type>;
+
+    /// Type of a read-only, contiguous column of charges
+    using const_charge_span = std::span<const charge_type>;
+
     // -- Point types ----------------------------------------------------------
 
     /// The type used to store the coordinates
@@ -101,6 +108,15 @@ public:
     /// Integral type used for indexing
     using size_type = typename base_type::size_type;
 
+    /// Type used to describe a reordering of the point charges in *this
+    using permutation_type = typename point_set_type::permutation_type;
+
+    /// Type of a transformation which can be applied to the point charges
+    using affine_type = typename point_set_type::affine_type;
+
+    /// Alignment, in bytes, of the pointer returned by charge_data()
+    static constexpr size_type data_alignment = detail_::simd_alignment;
+
     /** @brief Creates an empty Charges object.
      *
      *  The Charges object resulting from this ctor will function like an
@@ -129,6 +145,42 @@ public:
               std::vector<charge_type>(std::forward<BeginItr>(begin),
                                        std::forward<EndItr>(end))) {}
 
+    /** @brief Creates a Charges object from a PointSet and the charges.
+     *
+     *  This ctor is meant for populating a Charges object in bulk. @p points
+     *  is adopted as is (no copy is made) and @p charges is copied in a single
+     *  operation.
+     *
+     *  @param[in] points The locations of the point charges.
+     *  @param[in] charges The charge of each point. Must be the same length
+     *                     as @p points.
+     *
+     *  @throw std::runtime_error if @p points and @p charges are not the same
+     *                            length. Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    Charges(point_set_type points, std::span<const charge_type> charges);
+
+    /** @brief Creates a Charges object from arrays of coordinates and charges.
+     *
+     *  This ctor is a convenience for calling
+     *  `Charges(point_set_type(x, y, z), charges)`.
+     *
+     *  @param[in] x The x-coordinates of the point charges.
+     *  @param[in] y The y-coordinates of the point charges.
+     *  @param[in] z The z-coordinates of the point charges.
+     *  @param[in] charges The charge of each point charge.
+     *
+     *  @throw std::runtime_error if the arrays are not all the same length.
+     *                            Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    Charges(std::span<const coord_type> x, std::span<const coord_type> y,
+            std::span<const coord_type> z,
+            std::span<const charge_type> charges);
+
     /** @brief Creates a new Charges by deep copying @p rhs.
      *
      *  @param[in] other the object we are copying.
@@ -201,6 +253,68 @@ public:
      */
     void push_back(value_type q);
 
+    /** @brief Ensures *this can hold @p n point charges without reallocating.
+     *
+     *  @param[in] n The number of point charges *this should be able to hold.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    void reserve(size_type n);
+
+    /** @brief Reorders the point charges in *this according to @p p.
+     *
+     *  After this call the i-th point charge of *this is the point charge
+     *  which was previously the `p[i]`-th point charge. The points and the
+     *  charges are permuted together.
+     *
+     *  @param[in] p A permutation of [0, size()).
+     *
+     *  @throw std::runtime_error if @p p is not a permutation of [0, size()).
+     *                            Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    void permute(const permutation_type& p);
+
+    /** @brief Sorts the point charges in *this along a space-filling curve.
+     *
+     *  See PointSet::reorder for details.
+     *
+     *  @param[in] curve The space-filling curve to sort along. Defaults to
+     *                   Hilbert.
+     *
+     *  @return The permutation which was applied to *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating memory. Strong
+     *                        throw guarantee.
+     */
+    permutation_type reorder(
+      SpaceFillingCurve curve = SpaceFillingCurve::hilbert);
+
+    /** @brief Applies @p f to the position of every point charge in *this.
+     *
+     *  See PointSet::transform for details. The charges are not
+     *  modified.
+     *
+     *  @param[in] f The transformation to apply.
+     *
+     *  @throw None No throw guarantee.
+     */
+    void transform(const affine_type& f) noexcept;
+
+    /** @brief Returns a copy of *this with @p f applied to every point charge.
+     *
+     *  @param[in] f The transformation to apply.
+     *
+     *  @return A copy of *this in which each point charge has been moved to the
+     *          image of its original position.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    Charges transformed(const affine_type& f) const;
+
     /** @brief Returns the PointSet piece of *this.
      *
      *  Conceptually a Charges object is a PointSet plus the charges of each
@@ -231,6 +345,10 @@ public:
      *  to the first charge. If they are not, or if there are no charges, this
      *  method will return a null pointer.
      *
+     *  Like the coordinate arrays of the PointSet, the charges are aligned to
+     *  `data_alignment` bytes and zero-padded to
+     *  `point_set().padded_size()` elements.
+     *
      *  @return A pointer to the first charge or a null pointer.
      *
      *  @throw None No throw guarantee.
@@ -248,6 +366,25 @@ public:
      */
     const_charge_pointer charge_data() const noexcept;
 
+    /** @brief Returns the charges as a column.
+     *
+     *  The i-th element of the column is the charge of the i-th point charge.
+     *  Together with the columns of point_set() this lets kernels loop over
+     *  the point charges without building PointChargeView objects.
+     *
+     *  @return A span over the size() charges (no padding).
+     *
+     *  @throw None No throw guarantee.
+     */
+    ///@{
+    charge_span charge_column() noexcept {
+        return charge_span(charge_data(), size_());
+    }
+    const_charge_span charge_column() const noexcept {
+        return const_charge_span(charge_data(), size_());
+    }
+    ///@}
+
     /** @brief Serialize Charges instance
      *
      * @param ar The archive object
@@ -266,9 +403,6 @@ private:
     /// Allows the base class to access at_ and size_
     friend base_type;
 
-    /// Internally used to pass separated state to PIMPL
-    Charges(point_set_type points, std::vector<charge_type> charges);
-
     /// Used by base to implement retrieving elements by read/write reference
     reference at_(size_type i);
 
@@ -17,7 +17,9 @@
 #pragma once
 #include <chemist/point_charge/charges.hpp>
 #include <chemist/traits/point_charge_traits.hpp>
+#include <span>
 #include <utilities/containers/indexable_container_base.hpp>
+#include <vector>
 
 namespace chemist {
 namespace detail_ {
@@ -100,9 +102,24 @@ public:
     /// Type of a mutable pointer to a point charge's charge
     using charge_pointer = typename point_charge_traits::charge_pointer;
 
+    /// Type of a contiguous column of charges, read-only if ChargesType is
+    /// const-qualified
+    using charge_span = std::span<std::remove_pointer_t<charge_pointer>>;
+
+    /// Type of a read-only, contiguous column of charges
+    using const_charge_span =
+      std::span<const typename point_charge_traits::charge_type>;
+
     /// Unsigned integer type used for indexing and offsets
     using typename base_type::size_type;
 
+    /// Type used to specify which point charges of a supersystem are in a
+    /// subset
+    using member_list_type = std::vector<size_type>;
+
+    /// Type of a container filled with ChargesView objects
+    using charges_view_container = std::vector<my_type>;
+
     /** @brief Aliases an empty Charges object
      *
      *  Default created ChargesView objects act like they alias empty Charges
@@ -138,6 +155,63 @@ public:
      */
     ChargesView(point_set_reference points, charge_pointer pq);
 
+    /** @brief Creates a ChargesView that aliases @p points and strided
+     *         charges.
+     *
+     *  This ctor is used to alias charges which are not contiguous, e.g., the
+     *  `q` member of an array of `{x, y, z, q}` records. Combined with the
+     *  strided PointSetView ctor this lets such a buffer be used as a Charges
+     *  object without copying it.
+     *
+     *  @param[in] points A view of the points.
+     *  @param[in] pq A pointer to the charge of `points[0]`.
+     *  @param[in] stride The distance, in bytes, between the charges of
+     *                    consecutive point charges.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the state. Strong
+     *                        throw guarantee.
+     */
+    ChargesView(point_set_reference points, charge_pointer pq,
+                size_type stride);
+
+    /** @brief Creates a ChargesView of a subset of @p supersystem.
+     *
+     *  The resulting view aliases a Charges object with `members.size()`
+     *  point charges such that the i-th point charge is
+     *  `supersystem[members[i]]`. The PointSet piece of *this is the same
+     *  subset of `supersystem.point_set()`. This allows, for example, the
+     *  embedding charges near a fragment to be selected without copying the
+     *  full set of charges.
+     *
+     *  @param[in] supersystem An alias of the supersystem.
+     *  @param[in] members The indices of the point charges in @p supersystem
+     *                     which are in *this. Each index should be in the
+     *                     range [0, supersystem.size()).
+     *
+     *  @note If the data @p supersystem aliases is invalidated it will also
+     *        invalidate *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the PIMPL. Strong
+     *                        throw guarantee.
+     */
+    ChargesView(ChargesView supersystem, member_list_type members);
+
+    /** @brief Initializes *this to the union of @p members.
+     *
+     *  The resulting view aliases the Charges object formed by concatenating
+     *  the Charges objects aliased in @p members, without copying them.
+     *
+     *  @param[in] members A container with aliases to the Charges objects to
+     *                     take the union of.
+     *
+     *  @note If the data aliased by an element of @p members is invalidated
+     *        it will also invalidate *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the PIMPL. Strong
+     *                        throw guarantee.
+     */
+    explicit ChargesView(charges_view_container members);
+
     /** @brief Creates a new alias to the Charges object aliased by @p other.
      *
      *  This ctor is a shallow copy of the aliased Charges object and a deep
@@ -248,6 +322,49 @@ public:
      */
     const_point_set_reference point_set() const noexcept;
 
+    /** @brief Converts *this into a Charges object.
+     *
+     *  This is the ChargesView analog of PointSetView::as_point_set. The copy
+     *  is made a column at a time, straight out of the aliased arrays when
+     *  they are contiguous or strided.
+     *
+     *  @return A new Charges object containing a copy of the state in *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    charges_type as_charges() const;
+
+    /** @brief Determines if the aliased charges and coordinates are stored as
+     *         contiguous columns.
+     *
+     *  *this is contiguous if the charges are contiguous and point_set() is
+     *  contiguous (see PointSetView::is_contiguous). Empty views are
+     *  contiguous.
+     *
+     *  @return True if charge_column() and the columns of point_set() can be
+     *          retrieved and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool is_contiguous() const noexcept;
+
+    /** @brief Returns the aliased charges as a column.
+     *
+     *  @return A span over the size() aliased charges.
+     *
+     *  @throw std::runtime_error if *this is not contiguous. Strong throw
+     *                            guarantee.
+     */
+    ///@{
+    charge_span charge_column() {
+        return charge_span(charge_column_data_(), size_());
+    }
+    const_charge_span charge_column() const {
+        return const_charge_span(charge_column_data_(), size_());
+    }
+    ///@}
+
     /** @brief Determines if *this aliases the same Charges object as @p rhs.
      *
      *  This method will compare the Charges objects aliased by *this and
@@ -312,6 +429,9 @@ private:
     /// Implements base_type::size()
     size_type size_() const noexcept;
 
+    /// Address of the first charge, throws if *this is not contiguous
+    charge_pointer charge_column_data_() const;
+
     /// The actual object holding the state of *this
     pimpl_pointer m_pimpl_;
 };
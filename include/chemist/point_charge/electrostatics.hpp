@@ -0,0 +1,159 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file electrostatics.hpp
+ *
+ *  Batched kernels for the electrostatic potential and electric field
+ *  generated by a set of point charges at a set of target points, e.g., the
+ *  embedding potential of a QM/MM calculation evaluated on a grid.
+ *
+ *  The kernels work directly on the structure-of-arrays storage of Charges
+ *  and PointSet objects. The charges are processed in tiles which stay in
+ *  cache while every target point loops over them, the loop over the charges
+ *  in a tile is written so the compiler can vectorize it, and the target
+ *  points are distributed over threads (if Chemist was built with OpenMP)
+ *  once the number of charge-target pairs is large enough.
+ *
+ *  All quantities are in atomic units, i.e., the potential of the charge
+ *  @f$q_j@f$ at @f$\mathbf{r}_j@f$ is @f$q_j/|\mathbf{r}-\mathbf{r}_j|@f$.
+ *  Two optional parameters modify the bare Coulomb interaction:
+ *
+ *  - `cutoff`. Charges further than `cutoff` from a target point are
+ *    ignored. The default is an infinite cutoff.
+ *  - `smoothing`. A softening length @f$a@f$ which replaces
+ *    @f$|\mathbf{r}-\mathbf{r}_j|@f$ with
+ *    @f$\sqrt{|\mathbf{r}-\mathbf{r}_j|^2 + a^2}@f$, keeping the potential
+ *    finite near the charges. The default, 0, is the bare interaction.
+ *
+ *  A charge sitting exactly on a target point (with no smoothing) does not
+ *  contribute to the potential or field at that point.
+ *
+ *  Fields are returned as row-major 3 by @f$N@f$ matrices flattened into
+ *  std::vector objects, i.e., the x-components of all @f$N@f$ target points,
+ *  followed by the y-components, followed by the z-components.
+ */
+#pragma once
+#include <chemist/grid/grid_class.hpp>
+#include <chemist/point/point_set.hpp>
+#include <chemist/point/point_set_view.hpp>
+#include <chemist/point_charge/charges.hpp>
+#include <chemist/point_charge/charges_view.hpp>
+#include <limits>
+#include <vector>
+
+namespace chemist {
+
+/** @brief Computes the electrostatic potential of @p charges at @p points.
+ *
+ *  @tparam T The floating-point type of the charges and coordinates.
+ *
+ *  @param[in] charges The @f$M@f$ point charges generating the potential.
+ *  @param[in] points The @f$N@f$ points to evaluate the potential at.
+ *  @param[in] cutoff Charges further than this from a point are ignored.
+ *                    Defaults to infinity.
+ *  @param[in] smoothing The softening length. Defaults to 0.
+ *
+ *  @return An @f$N@f$ element vector whose @f$i@f$-th element is the
+ *          potential at the @f$i@f$-th point of @p points.
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+template<typename T>
+std::vector<T> electrostatic_potential(
+  const Charges<T>& charges, const PointSet<T>& points,
+  T cutoff = std::numeric_limits<T>::infinity(), T smoothing = 0);
+
+/** @brief Computes the electric field of @p charges at @p points.
+ *
+ *  The field is minus the gradient of the potential computed by
+ *  electrostatic_potential, with the same cutoff and smoothing.
+ *
+ *  @tparam T The floating-point type of the charges and coordinates.
+ *
+ *  @param[in] charges The @f$M@f$ point charges generating the field.
+ *  @param[in] points The @f$N@f$ points to evaluate the field at.
+ *  @param[in] cutoff Charges further than this from a point are ignored.
+ *                    Defaults to infinity.
+ *  @param[in] smoothing The softening length. Defaults to 0.
+ *
+ *  @return A 3 by @f$N@f$ row-major matrix such that element @f$(k, i)@f$ is
+ *          the @f$k@f$-th Cartesian component of the field at the
+ *          @f$i@f$-th point of @p points.
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+template<typename T>
+std::vector<T> electric_field(const Charges<T>& charges,
+                              const PointSet<T>& points,
+                              T cutoff    = std::numeric_limits<T>::infinity(),
+                              T smoothing = 0);
+
+// -- View overloads -----------------------------------------------------------
+
+/** @brief Overloads of the electrostatic kernels for views.
+ *
+ *  These overloads behave exactly like their Charges/PointSet counterparts.
+ *  Contiguous views are processed in place; other views are first gathered
+ *  into contiguous buffers, which is O(N + M) work.
+ *
+ *  @tparam ChargesType The cv-qualified Charges type being viewed.
+ *  @tparam PointSetType The cv-qualified PointSet type being viewed.
+ */
+///@{
+template<typename ChargesType, typename PointSetType>
+auto electrostatic_potential(
+  const ChargesView<ChargesType>& charges,
+  const PointSetView<PointSetType>& points,
+  typename ChargesView<ChargesType>::value_type::charge_type cutoff =
+    std::numeric_limits<
+      typename ChargesView<ChargesType>::value_type::charge_type>::infinity(),
+  typename ChargesView<ChargesType>::value_type::charge_type smoothing = 0)
+  -> std::vector<typename ChargesView<ChargesType>::value_type::charge_type>;
+
+template<typename ChargesType, typename PointSetType>
+auto electric_field(
+  const ChargesView<ChargesType>& charges,
+  const PointSetView<PointSetType>& points,
+  typename ChargesView<ChargesType>::value_type::charge_type cutoff =
+    std::numeric_limits<
+      typename ChargesView<ChargesType>::value_type::charge_type>::infinity(),
+  typename ChargesView<ChargesType>::value_type::charge_type smoothing = 0)
+  -> std::vector<typename ChargesView<ChargesType>::value_type::charge_type>;
+///@}
+
+// -- Grid overloads -----------------------------------------------------------
+
+/** @brief Evaluates the potential or field of @p charges on the points of
+ *         @p grid.
+ *
+ *  The weights of @p grid are ignored; they are only needed once the result
+ *  is integrated. See the PointSet overloads for full descriptions.
+ */
+///@{
+std::vector<double> electrostatic_potential(
+  const Charges<double>& charges, const Grid& grid,
+  double cutoff    = std::numeric_limits<double>::infinity(),
+  double smoothing = 0);
+
+std::vector<double> electric_field(
+  const Charges<double>& charges, const Grid& grid,
+  double cutoff    = std::numeric_limits<double>::infinity(),
+  double smoothing = 0);
+///@}
+
+} // namespace chemist
@@ -0,0 +1,245 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <chemist/point/point_set.hpp>
+#include <chemist/point/point_set_view.hpp>
+#include <chemist/point_charge/charges.hpp>
+#include <chemist/point_charge/charges_view.hpp>
+#include <memory>
+#include <vector>
+
+namespace chemist {
+namespace detail_ {
+template<typename T>
+class MultipoleTreePIMPL;
+}
+
+/** @brief Approximates the potential and field of a large set of charges.
+ *
+ *  Directly summing the contributions of @f$M@f$ charges at @f$N@f$ points
+ *  (what electrostatic_potential and electric_field do) is
+ *  @f$\mathcal{O}(NM)@f$, which is too expensive for environments of millions
+ *  of charges. MultipoleTree is a tree code: the charges are sorted into an
+ *  octree and each node of the octree stores the Cartesian multipole moments
+ *  of its charges, through order @f$p@f$, about the center of the node. A
+ *  target point at a distance @f$R@f$ from the center of a node whose charges
+ *  are all within @f$a@f$ of the center uses the node's multipole expansion
+ *  if @f$a \le \theta R@f$; otherwise the node's children are visited. The
+ *  charges of leaves which are too close are summed directly with the same
+ *  kernel as electrostatic_potential. Each target then costs roughly
+ *  @f$\mathcal{O}(\log M)@f$.
+ *
+ *  The approximation is controlled by the expansion order @f$p@f$ and the
+ *  opening angle @f$\theta@f$. For every target point @f$\mathbf{r}@f$, the
+ *  error in the potential satisfies:
+ *
+ *  @f[
+ *    |\delta\phi(\mathbf{r})| \le \epsilon \sum_j
+ *      \frac{|q_j|}{|\mathbf{r} - \mathbf{r}_j|}, \qquad
+ *    \epsilon = \frac{(1 + \theta)\theta^{p+1}}{1 - \theta}
+ *  @f]
+ *
+ *  (before floating-point round-off), where @f$\epsilon@f$ is returned by
+ *  error_bound(). The error in the field decreases at the same rate. Setting
+ *  @f$\theta = 0@f$ makes every interaction direct, which is useful for
+ *  testing.
+ *
+ *  Like the direct kernels, all quantities are in atomic units, a charge
+ *  sitting exactly on a target does not contribute to that target, and fields
+ *  are returned as row-major 3 by @f$N@f$ matrices. Unlike the direct kernels
+ *  there is no cutoff or smoothing.
+ *
+ *  The tree copies the charges (in tree order), i.e., it does not alias the
+ *  charges it was built from and can be reused for any number of evaluations.
+ *  If Chemist was built with OpenMP, building the moments and evaluating the
+ *  targets are threaded.
+ *
+ *  @tparam T The floating-point type of the charges and coordinates.
+ */
+template<typename T>
+class MultipoleTree {
+public:
+    /// Type of the PIMPL
+    using pimpl_type = detail_::MultipoleTreePIMPL<T>;
+
+    /// Type of a pointer to the PIMPL
+    using pimpl_pointer = std::unique_ptr<pimpl_type>;
+
+    /// Floating-point type of the charges and coordinates
+    using coord_type = T;
+
+    /// Type of the charges which can be used to build a tree
+    using charges_type = Charges<T>;
+
+    /// Type of the set of points the tree can be evaluated at
+    using point_set_type = PointSet<T>;
+
+    /// Integral type used for indexing
+    using size_type = std::size_t;
+
+    /// Type used to return potentials and fields
+    using result_type = std::vector<T>;
+
+    // -------------------------------------------------------------------------
+    // -- Ctors, assignment, and dtor
+    // -------------------------------------------------------------------------
+
+    /** @brief Creates a tree of zero charges.
+     *
+     *  The potential and field of an empty tree are zero everywhere.
+     *
+     *  @throw None No throw guarantee.
+     */
+    MultipoleTree() noexcept;
+
+    /** @brief Builds a tree over @p charges.
+     *
+     *  @param[in] charges The charges generating the potential. *this copies
+     *                     the charges, i.e., *this does not alias @p charges.
+     *  @param[in] order The order, @f$p@f$, of the multipole expansions.
+     *                   Defaults to 4 (through hexadecapoles).
+     *  @param[in] theta The opening angle. Must be in the range [0, 1).
+     *                   Defaults to 0.5.
+     *  @param[in] leaf_size Nodes with at most this many charges are not
+     *                       split. Must be positive. Defaults to 64.
+     *
+     *  @throw std::runtime_error if @p theta is not in the range [0, 1) or if
+     *                            @p leaf_size is zero. Strong throw
+     *                            guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the tree.
+     *                        Strong throw guarantee.
+     */
+    explicit MultipoleTree(const charges_type& charges, size_type order = 4,
+                           coord_type theta = 0.5, size_type leaf_size = 64);
+
+    /** @brief Builds a tree over the charges aliased by @p charges.
+     *
+     *  This ctor behaves exactly like the Charges ctor.
+     *
+     *  @tparam ChargesType The cv-qualified Charges type @p charges aliases.
+     */
+    template<typename ChargesType>
+    explicit MultipoleTree(const ChargesView<ChargesType>& charges,
+                           size_type order = 4, coord_type theta = 0.5,
+                           size_type leaf_size = 64);
+
+    /// Deep copies @p other (the copy does not share state with @p other)
+    MultipoleTree(const MultipoleTree& other);
+
+    /// Takes ownership of @p other's tree, @p other is left empty
+    MultipoleTree(MultipoleTree&& other) noexcept;
+
+    /// Deep copies @p rhs into *this
+    MultipoleTree& operator=(const MultipoleTree& rhs);
+
+    /// Takes ownership of @p rhs's tree, @p rhs is left empty
+    MultipoleTree& operator=(MultipoleTree&& rhs) noexcept;
+
+    /// Default no-throw dtor
+    ~MultipoleTree() noexcept;
+
+    // -------------------------------------------------------------------------
+    // -- Accessors
+    // -------------------------------------------------------------------------
+
+    /// The number of charges in *this
+    size_type size() const noexcept;
+
+    /// True if *this contains no charges
+    bool empty() const noexcept { return size() == 0; }
+
+    /// The order of the multipole expansions (0 if *this is empty)
+    size_type order() const noexcept;
+
+    /// The opening angle (0 if *this is empty)
+    coord_type theta() const noexcept;
+
+    /** @brief The relative error bound of the approximation.
+     *
+     *  @return @f$\epsilon = (1 + \theta)\theta^{p+1}/(1 - \theta)@f$. See
+     *          the class description for how it bounds the error.
+     *
+     *  @throw None No throw guarantee.
+     */
+    coord_type error_bound() const noexcept;
+
+    // -------------------------------------------------------------------------
+    // -- Evaluation
+    // -------------------------------------------------------------------------
+
+    /** @brief Approximates the electrostatic potential at @p points.
+     *
+     *  @param[in] points The @f$N@f$ points to evaluate the potential at.
+     *
+     *  @return An @f$N@f$ element vector whose @f$i@f$-th element is the
+     *          potential at the @f$i@f$-th point of @p points.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    result_type potential(const point_set_type& points) const;
+
+    /** @brief Approximates the electrostatic potential at @p points.
+     *
+     *  This overload behaves exactly like the PointSet overload.
+     *
+     *  @tparam PointSetType The cv-qualified PointSet type @p points aliases.
+     */
+    template<typename PointSetType>
+    result_type potential(const PointSetView<PointSetType>& points) const;
+
+    /** @brief Approximates the electric field at @p points.
+     *
+     *  @param[in] points The @f$N@f$ points to evaluate the field at.
+     *
+     *  @return A 3 by @f$N@f$ row-major matrix such that element @f$(k, i)@f$
+     *          is the @f$k@f$-th Cartesian component of the field at the
+     *          @f$i@f$-th point of @p points.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    result_type field(const point_set_type& points) const;
+
+    /** @brief Approximates the electric field at @p points.
+     *
+     *  This overload behaves exactly like the PointSet overload.
+     *
+     *  @tparam PointSetType The cv-qualified PointSet type @p points aliases.
+     */
+    template<typename PointSetType>
+    result_type field(const PointSetView<PointSetType>& points) const;
+
+    // -------------------------------------------------------------------------
+    // -- Utility methods
+    // -------------------------------------------------------------------------
+
+    /// Exchanges the state of *this with that of @p other
+    void swap(MultipoleTree& other) noexcept;
+
+private:
+    /// True if *this has a PIMPL
+    bool has_pimpl_() const noexcept;
+
+    /// The object actually implementing *this
+    pimpl_pointer m_pimpl_;
+};
+
+extern template class MultipoleTree<float>;
+extern template class MultipoleTree<double>;
+
+} // namespace chemist
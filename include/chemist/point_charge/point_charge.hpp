@@ -16,5 +16,7 @@
 
 #pragma once
 #include <chemist/point_charge/charges.hpp>
+#include <chemist/point_charge/electrostatics.hpp>
+#include <chemist/point_charge/multipole_tree.hpp>
 #include <chemist/point_charge/point_charge_class.hpp>
 #include <chemist/point_charge/point_charge_view.hpp>
@@ -0,0 +1,181 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <chemist/molecule/molecule_class.hpp>
+#include <chemist/nucleus/nuclei.hpp>
+#include <chemist/nucleus/periodic_table.hpp>
+#include <chemist/point/spatial_index.hpp>
+#include <chemist/topology/connectivity_table.hpp>
+#include <vector>
+
+namespace chemist::topology {
+
+/** @brief Works out which atoms are bonded from the positions of the nuclei.
+ *
+ *  Atoms i and j are considered bonded if the distance between them is at
+ *  most @f$R_i + R_j + \tau@f$, where @f$R_i@f$ is the covalent radius of
+ *  atom i (see periodic_table.hpp) and @f$\tau@f$ is a tolerance. Atoms whose
+ *  atomic number is not in the periodic table (e.g., dummy atoms with Z = 0)
+ *  are never bonded.
+ *
+ *  Rather than comparing every pair of atoms, the nuclei are put in a
+ *  SpatialIndex and each atom only looks at the atoms within
+ *  @f$R_i + R_{max} + \tau@f$ of it, where @f$R_{max}@f$ is the largest
+ *  covalent radius present. Since the number of such atoms does not grow with
+ *  the size of the system, perception is (up to the logarithm of the tree
+ *  queries) linear in the number of atoms. If Chemist was built with OpenMP
+ *  the atoms are searched in parallel.
+ *
+ *  BondPerception keeps the index around so that, when only some of the
+ *  atoms moved (e.g., between the steps of a molecular dynamics simulation),
+ *  update() can re-perceive the bonds of just those atoms.
+ */
+class BondPerception {
+public:
+    /// Type of the object holding the bonds
+    using connectivity_type = ConnectivityTable;
+
+    /// Type used for indexing atoms
+    using size_type = typename connectivity_type::size_type;
+
+    /// Type used to pass the indices of the atoms which moved
+    using index_list_type = std::vector<size_type>;
+
+    /// Default tolerance, 0.45 Angstrom in bohr
+    static constexpr double default_tolerance = 0.45 * Element::angstroms_to_au;
+
+    /** @brief Perceives the bonds of @p nuclei.
+     *
+     *  @param[in] nuclei The nuclei whose bonds are perceived. Coordinates
+     *                    are assumed to be in bohr.
+     *  @param[in] tolerance How much longer than the sum of the covalent radii
+     *                       a bond may be, in bohr. Defaults to
+     *                       default_tolerance.
+     *
+     *  @throw std::runtime_error if @p tolerance is negative. Strong throw
+     *                            guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the index or the
+     *                        connectivity table. Strong throw guarantee.
+     */
+    explicit BondPerception(const Nuclei& nuclei,
+                            double tolerance = default_tolerance);
+
+    /** @brief Perceives the bonds of the nuclei in @p molecule.
+     *
+     *  This ctor behaves exactly like the Nuclei ctor.
+     */
+    explicit BondPerception(const Molecule& molecule,
+                            double tolerance = default_tolerance);
+
+    /// The number of atoms bonds were perceived for
+    size_type natoms() const noexcept { return m_radii_.size(); }
+
+    /// The tolerance bonds are perceived with, in bohr
+    double tolerance() const noexcept { return m_tolerance_; }
+
+    /** @brief The bonds perceived so far.
+     *
+     *  @return A read-only reference to the connectivity table. The reference
+     *          is invalidated if *this is destroyed and its contents change
+     *          if update() is called.
+     *
+     *  @throw None No throw guarantee.
+     */
+    const connectivity_type& connectivity() const noexcept {
+        return m_connectivity_;
+    }
+
+    /** @brief Re-perceives the bonds of the atoms in @p moved.
+     *
+     *  The bonds of each atom in @p moved are removed from the connectivity
+     *  table and perceived again from the positions in @p nuclei. Bonds
+     *  between two atoms which did not move are left alone, so the result is
+     *  the same as perceiving the bonds of @p nuclei from scratch as long as
+     *  @p moved contains every atom which moved (or changed atomic number).
+     *  The coordinates are read in place from @p nuclei (nothing is copied)
+     *  and only the parts of the index holding the moved atoms are refit, so
+     *  the cost is proportional to the number of atoms in @p moved (up to the
+     *  logarithm of natoms() for walking the index).
+     *
+     *  @param[in] nuclei All of the nuclei, at their new positions.
+     *  @param[in] moved The indices of the nuclei which moved.
+     *
+     *  @throw std::runtime_error if @p nuclei has a different number of nuclei
+     *                            than natoms(). Strong throw guarantee.
+     *  @throw std::out_of_range if an index in @p moved is not in the range
+     *                           [0, natoms()). Strong throw guarantee.
+     *  @throw std::bad_alloc if there is a problem updating the index or the
+     *                        connectivity table. Basic throw guarantee.
+     */
+    void update(const Nuclei& nuclei, const index_list_type& moved);
+
+    /** @brief Re-perceives the bonds of the atoms in @p moved.
+     *
+     *  This overload behaves like the Nuclei overload, but must first copy the
+     *  nuclei out of @p molecule, which costs time proportional to the size of
+     *  @p molecule.
+     */
+    void update(const Molecule& molecule, const index_list_type& moved);
+
+private:
+    /// The atoms bonded to atom @p i, given the coordinates of all atoms
+    index_list_type bonds_of_(size_type i, const double* x, const double* y,
+                              const double* z) const;
+
+    /// How much longer than the sum of the covalent radii a bond may be
+    double m_tolerance_;
+
+    /// The largest covalent radius of any atom seen so far
+    double m_max_radius_ = 0.0;
+
+    /// The covalent radius of each atom, negative if it can't bond
+    std::vector<double> m_radii_;
+
+    /// Index of the atoms' positions
+    SpatialIndex<double> m_index_;
+
+    /// The bonds found so far
+    connectivity_type m_connectivity_;
+};
+
+/** @brief Perceives the bonds of @p nuclei.
+ *
+ *  This is a convenience function for when incremental updates are not
+ *  needed. It is equivalent to
+ *  `BondPerception(nuclei, tolerance).connectivity()`.
+ *
+ *  @param[in] nuclei The nuclei whose bonds are perceived.
+ *  @param[in] tolerance How much longer than the sum of the covalent radii a
+ *                       bond may be, in bohr.
+ *
+ *  @return A connectivity table holding the bonds of @p nuclei.
+ *
+ *  @throw std::runtime_error if @p tolerance is negative. Strong throw
+ *                            guarantee.
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+///@{
+ConnectivityTable perceive_bonds(
+  const Nuclei& nuclei, double tolerance = BondPerception::default_tolerance);
+
+ConnectivityTable perceive_bonds(
+  const Molecule& molecule,
+  double tolerance = BondPerception::default_tolerance);
+///@}
+
+} // namespace chemist::topology
@@ -57,6 +57,10 @@ public:
     /// Type used to return a set of atom indices
     using atom_indices_set = typename type_traits::atom_indices_set;
 
+    /// Type used to return a read-only range of atom indices
+    using const_atom_indices_span =
+      typename type_traits::const_atom_indices_span;
+
     /** @brief Creates an empty ConnectivityTable.
      *
      *  The instance created with this ctor is capable of holding the
@@ -168,6 +172,22 @@ public:
      */
     void add_bond(size_type i, size_type j);
 
+    /** @brief Removes the bond between atoms @p i and @p j.
+     *
+     *  This function is the inverse of add_bond. If atoms @p i and @p j are
+     *  not bonded this is a no-op. Like add_bond, the order of @p i and @p j
+     *  does not matter.
+     *
+     *  @param[in] i the index of the first atom in the bond.
+     *  @param[in] j the index of the second atom in the bond.
+     *
+     *  @throw std::out_of_range if either (or both) of @p i and/or @p j are not
+     *                           in the range [0, natoms()). Strong throw
+     *                           guarantee.
+     *  @throw std::out_of_range if @p i equals @p j. Strong throw guarantee.
+     */
+    void remove_bond(size_type i, size_type j);
+
     /** @brief The number of atoms in this table.
      *
      *  @return The number of atoms this table is for.
@@ -217,6 +237,24 @@ public:
      */
     atom_indices_set bonded_atoms(size_type i) const;
 
+    /** @brief Returns the atoms bonded to atom @p i without copying them.
+     *
+     *  This function returns the same atoms as bonded_atoms, but as a
+     *  read-only view of the table's internal (sorted) adjacency list. It is
+     *  meant for graph algorithms, which visit the neighbors of many atoms
+     *  and should not allocate a set for each one.
+     *
+     *  @param[in] i the zero-based index of the atom of interest.
+     *
+     *  @return The indices of the atoms bonded to @p i, sorted in ascending
+     *          order. The span is invalidated by any call which modifies
+     *          *this.
+     *
+     *  @throw std::out_of_range if @p i is not in the range [0, natoms()).
+     *                           Strong throw guarantee.
+     */
+    const_atom_indices_span neighbors(size_type i) const;
+
 private:
     /** @brief Returns the PIMPL in a read/write state, making a PIMPL if the
      *         instance does not have one.
@@ -0,0 +1,192 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file graph_algorithms.hpp
+ *
+ *  Algorithms on the bond graph stored in a ConnectivityTable, i.e., the
+ *  graph whose vertices are the atoms and whose edges are the bonds.
+ *
+ *  The algorithms only read the table through ConnectivityTable::neighbors,
+ *  and keep their work space in flat arrays which are allocated once per call
+ *  (once per thread for the batched variants), not once per atom. The
+ *  batched variants (k_hop_neighborhoods, shortest_paths) and the ring search
+ *  are threaded if Chemist was built with OpenMP.
+ *
+ *  All indices are atom indices, i.e., in the range [0, table.natoms()).
+ *  Results are deterministic, in particular they do not depend on the number
+ *  of threads.
+ */
+#pragma once
+#include <chemist/topology/connectivity_table.hpp>
+#include <vector>
+
+namespace chemist::topology {
+
+/// Type used for indexing atoms
+using graph_size_type = typename ConnectivityTable::size_type;
+
+/// Type used to return a list of atoms
+using atom_list_type = std::vector<graph_size_type>;
+
+/// Type used to return several lists of atoms
+using atom_list_set_type = std::vector<atom_list_type>;
+
+/** @brief Assigns each atom to a connected component of the bond graph.
+ *
+ *  Two atoms are in the same connected component if there is a path of bonds
+ *  between them. Components are numbered in order of their lowest atom index,
+ *  so atom 0 is always in component 0.
+ *
+ *  @param[in] table The bonds.
+ *
+ *  @return A `table.natoms()` long container whose i-th element is the
+ *          component atom i is in.
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+atom_list_type component_labels(const ConnectivityTable& table);
+
+/** @brief Finds the connected components of the bond graph.
+ *
+ *  For a ConnectivityTable describing a set of molecules, the connected
+ *  components are the molecules.
+ *
+ *  @param[in] table The bonds.
+ *
+ *  @return The atoms in each component. Atoms in a component are sorted in
+ *          ascending order and the components are ordered by their first
+ *          atom (i.e., the i-th component has label i in component_labels).
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+atom_list_set_type connected_components(const ConnectivityTable& table);
+
+/** @brief Finds the atoms within @p k bonds of atom @p seed.
+ *
+ *  @param[in] table The bonds.
+ *  @param[in] seed The atom to search around.
+ *  @param[in] k The maximum number of bonds between @p seed and an atom in
+ *               the neighborhood. For @p k equal to 0 the neighborhood is just
+ *               @p seed.
+ *
+ *  @return The atoms within @p k bonds of @p seed (including @p seed), sorted
+ *          in ascending order.
+ *
+ *  @throw std::out_of_range if @p seed is not in the range [0, natoms()).
+ *                           Strong throw guarantee.
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+atom_list_type k_hop_neighborhood(const ConnectivityTable& table,
+                                  graph_size_type seed, graph_size_type k);
+
+/** @brief Finds the k-hop neighborhood of each atom in @p seeds.
+ *
+ *  @param[in] table The bonds.
+ *  @param[in] seeds The atoms to search around.
+ *  @param[in] k The maximum number of bonds between a seed and an atom in its
+ *               neighborhood.
+ *
+ *  @return A container whose i-th element is
+ *          `k_hop_neighborhood(table, seeds[i], k)`.
+ *
+ *  @throw std::out_of_range if an atom in @p seeds is not in the range
+ *                           [0, natoms()). Strong throw guarantee.
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+atom_list_set_type k_hop_neighborhoods(const ConnectivityTable& table,
+                                       const atom_list_type& seeds,
+                                       graph_size_type k);
+
+/** @brief Finds a path with the fewest bonds from @p source to @p target.
+ *
+ *  If there are several shortest paths, which one is returned is
+ *  deterministic but otherwise unspecified.
+ *
+ *  @param[in] table The bonds.
+ *  @param[in] source The atom the path starts at.
+ *  @param[in] target The atom the path ends at.
+ *
+ *  @return The atoms along the path, starting with @p source and ending with
+ *          @p target (the number of bonds in the path is one less than the
+ *          number of atoms). If @p source and @p target are the same atom the
+ *          path is just that atom, and if they are not connected the path is
+ *          empty.
+ *
+ *  @throw std::out_of_range if @p source or @p target are not in the range
+ *                           [0, natoms()). Strong throw guarantee.
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+atom_list_type shortest_path(const ConnectivityTable& table,
+                             graph_size_type source, graph_size_type target);
+
+/** @brief Finds the shortest path between each pair of atoms in @p pairs.
+ *
+ *  @param[in] table The bonds.
+ *  @param[in] pairs The (source, target) pairs.
+ *
+ *  @return A container whose i-th element is
+ *          `shortest_path(table, pairs[i][0], pairs[i][1])`.
+ *
+ *  @throw std::out_of_range if an atom in @p pairs is not in the range
+ *                           [0, natoms()). Strong throw guarantee.
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+atom_list_set_type shortest_paths(
+  const ConnectivityTable& table,
+  const typename ConnectivityTable::offset_pair_list& pairs);
+
+/** @brief Finds the smallest set of smallest rings (SSSR) of the bond graph.
+ *
+ *  The SSSR is a minimum cycle basis of the bond graph: it contains
+ *  `nbonds() - natoms() + ncomponents` rings, every ring in the graph can be
+ *  built by combining them, and the total number of atoms in them is as small
+ *  as possible. For example, naphthalene has two six-membered rings (the
+ *  ten-membered perimeter is their combination) and cubane has five
+ *  four-membered rings.
+ *
+ *  Every ring lies inside a single biconnected block of the graph, so the
+ *  blocks are found first (chains, substituents, and bonds between ring
+ *  systems are discarded) and each block is solved independently with
+ *  Horton's algorithm: the candidate rings are formed from the shortest paths
+ *  between the atoms of the block, and, from smallest to largest, each
+ *  candidate which is linearly independent of the rings already picked is
+ *  kept. The cost is polynomial in the size of the largest block, which for
+ *  molecules is a ring system and thus small.
+ *
+ *  The SSSR is not unique (e.g., either pair of four-membered rings can be
+ *  used to build the sixth ring of a cube); which rings are returned is
+ *  deterministic but otherwise unspecified.
+ *
+ *  @param[in] table The bonds.
+ *
+ *  @return The rings. Each ring lists its atoms in the order they are bonded,
+ *          starting with the lowest atom index and continuing towards the
+ *          lower of its two neighbors. Rings are sorted by size and then
+ *          lexicographically.
+ *
+ *  @throw std::bad_alloc if there is a problem allocating the return. Strong
+ *                        throw guarantee.
+ */
+atom_list_set_type smallest_set_of_smallest_rings(
+  const ConnectivityTable& table);
+
+} // namespace chemist::topology
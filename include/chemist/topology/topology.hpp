@@ -21,7 +21,9 @@
  *  Convenience header file for including the topology subcomponent of Chemist.
  */
 
+#include <chemist/topology/bond_perception.hpp>
 #include <chemist/topology/connectivity_table.hpp>
+#include <chemist/topology/graph_algorithms.hpp>
 
 /** @brief Namespace for classes and functions describing the topology of
  *         chemical systems.
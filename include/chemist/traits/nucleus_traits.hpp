@@ -15,6 +15,7 @@
  */
 
 #pragma once
+#include <chemist/nucleus/interned_name.hpp>
 #include <chemist/traits/chemist_class_traits.hpp>
 #include <chemist/traits/point_charge_traits.hpp>
 #include <string>
@@ -34,7 +35,7 @@ struct ChemistClassTraits<Nucleus> {
     using const_reference               = const Nucleus&;
     using view_type                     = NucleusView<value_type>;
     using const_view_type               = NucleusView<const value_type>;
-    using name_type                     = std::string;
+    using name_type                     = InternedName;
     using name_reference                = name_type&;
     using const_name_reference          = const name_type&;
     using name_pointer                  = name_type*;
@@ -59,7 +60,7 @@ struct ChemistClassTraits<const Nucleus> {
     using const_reference               = const Nucleus&;
     using view_type                     = NucleusView<const value_type>;
     using const_view_type               = NucleusView<const value_type>;
-    using name_type                     = std::string;
+    using name_type                     = InternedName;
     using name_reference                = const name_type&;
     using const_name_reference          = const name_type&;
     using name_pointer                  = const name_type*;
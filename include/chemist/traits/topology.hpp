@@ -20,6 +20,7 @@
 #include <iostream>
 #include <memory>
 #include <set>
+#include <span>
 #include <vector>
 namespace chemist {
 namespace topology {
@@ -39,6 +40,9 @@ struct ChemistClassTraits<topology::ConnectivityTable> {
 
     /// Type of a set-like container of atom indices
     using atom_indices_set = std::set<size_type>;
+
+    /// Type of a read-only, contiguous range of atom indices
+    using const_atom_indices_span = std::span<const size_type>;
 };
 
 } // namespace chemist
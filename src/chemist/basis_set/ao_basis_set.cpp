@@ -139,6 +139,33 @@ typename AO_BS::abs_traits::const_primitive_reference AO_BS::primitive(
     return std::as_const(*m_pimpl_).primitive(i);
 }
 
+AO_BS_TPARAMS
+typename AO_BS::coefficient_span AO_BS::coefficient_column() noexcept {
+    if(!has_pimpl_()) return coefficient_span{};
+    return coefficient_span(m_pimpl_->coefficient_data(), n_primitives());
+}
+
+AO_BS_TPARAMS
+typename AO_BS::const_coefficient_span AO_BS::coefficient_column()
+  const noexcept {
+    if(!has_pimpl_()) return const_coefficient_span{};
+    return const_coefficient_span(std::as_const(*m_pimpl_).coefficient_data(),
+                                  n_primitives());
+}
+
+AO_BS_TPARAMS
+typename AO_BS::exponent_span AO_BS::exponent_column() noexcept {
+    if(!has_pimpl_()) return exponent_span{};
+    return exponent_span(m_pimpl_->exponent_data(), n_primitives());
+}
+
+AO_BS_TPARAMS
+typename AO_BS::const_exponent_span AO_BS::exponent_column() const noexcept {
+    if(!has_pimpl_()) return const_exponent_span{};
+    return const_exponent_span(std::as_const(*m_pimpl_).exponent_data(),
+                               n_primitives());
+}
+
 // -----------------------------------------------------------------------------
 // -- Utility functions
 // -----------------------------------------------------------------------------
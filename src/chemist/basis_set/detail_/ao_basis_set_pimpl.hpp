@@ -79,6 +79,14 @@ public:
 
     size_type n_primitives() const noexcept { return m_coefs_.size(); }
 
+    auto* coefficient_data() noexcept { return m_coefs_.data(); }
+
+    const auto* coefficient_data() const noexcept { return m_coefs_.data(); }
+
+    auto* exponent_data() noexcept { return m_exps_.data(); }
+
+    const auto* exponent_data() const noexcept { return m_exps_.data(); }
+
     auto shell_range(size_type center) const {
         size_type begin = m_shell_offsets_[center];
         size_type end   = begin + m_shells_per_center_[center];
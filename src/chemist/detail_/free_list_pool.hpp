@@ -0,0 +1,111 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <new>
+
+namespace chemist::detail_ {
+
+/** @brief Recycles fixed-size blocks of memory on a per-thread basis.
+ *
+ *  Small, frequently created objects (e.g., the PIMPL of a Point) spend most
+ *  of their construction time in the global allocator. FreeListPool keeps the
+ *  blocks of released objects in a thread-local singly linked list and hands
+ *  them back out on the next allocation, so that in the steady state creating
+ *  and destroying such objects does not touch the global allocator at all.
+ *
+ *  Every block is obtained from, and ultimately returned to, the global
+ *  `::operator new`/`::operator delete`. Hence it is safe for a block to be
+ *  allocated on one thread and released on another (it simply ends up in the
+ *  releasing thread's list). Each thread caches at most `max_cached` blocks;
+ *  anything beyond that is returned to the global allocator immediately, as
+ *  is everything which is released after the thread's list has been torn
+ *  down.
+ *
+ *  @tparam BlockSize The size, in bytes, of each block.
+ */
+template<std::size_t BlockSize>
+class FreeListPool {
+public:
+    /// Maximum number of released blocks each thread holds on to
+    static constexpr std::size_t max_cached = 4096;
+
+    /// Size of the blocks handed out by *this
+    static constexpr std::size_t block_size =
+      std::max(BlockSize, sizeof(void*));
+
+    /// Returns a block of at least BlockSize bytes
+    static void* allocate() {
+        auto& s = state_();
+        if(s.m_head == nullptr) return ::operator new(block_size);
+        auto* p  = s.m_head;
+        s.m_head = p->m_next;
+        --s.m_n;
+        return p;
+    }
+
+    /// Returns @p p, which must have come from allocate(), to the pool
+    static void deallocate(void* p) noexcept {
+        if(p == nullptr) return;
+        auto& s = state_();
+        if(s.m_dead || s.m_n == max_cached) {
+            ::operator delete(p);
+            return;
+        }
+        s.m_head = ::new(p) Node{s.m_head};
+        ++s.m_n;
+    }
+
+    /// Number of released blocks the calling thread is holding on to
+    static std::size_t cached() noexcept { return state_().m_n; }
+
+private:
+    /// What a cached block is reinterpreted as
+    struct Node {
+        Node* m_next;
+    };
+
+    /// Per-thread state. Trivially destructible so it outlives Reaper
+    struct State {
+        Node* m_head     = nullptr;
+        std::size_t m_n  = 0;
+        bool m_dead      = false;
+    };
+
+    /// Releases the cached blocks when the owning thread exits
+    struct Reaper {
+        ~Reaper() noexcept {
+            auto& s = state_();
+            while(s.m_head != nullptr) {
+                auto* p  = s.m_head;
+                s.m_head = p->m_next;
+                ::operator delete(p);
+            }
+            s.m_n    = 0;
+            s.m_dead = true;
+        }
+    };
+
+    static State& state_() noexcept {
+        static thread_local State s;
+        static thread_local Reaper r;
+        return s;
+    }
+};
+
+} // namespace chemist::detail_
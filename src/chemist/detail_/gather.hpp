@@ -0,0 +1,49 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file gather.hpp
+ *
+ *  Helpers for copying the elements of a subset of an array, e.g., the
+ *  aliased members of a subset view, into a contiguous array.
+ */
+
+#pragma once
+#include <cstddef>
+#include <span>
+
+namespace chemist::detail_ {
+
+/** @brief Copies the elements @p members of @p p into @p out.
+ *
+ *  After the call `out[i] == p[members[i]]`. Arithmetic types are gathered
+ *  with a loop the compiler can vectorize.
+ *
+ *  @param[in] p The address of the 0-th element of the source array.
+ *  @param[in] members The indices of the elements to copy.
+ *  @param[out] out Where to put the elements. Must hold members.size()
+ *                  elements.
+ *
+ *  @throw None No throw guarantee (assuming assigning a T to a U does not
+ *              throw).
+ */
+template<typename T, typename U>
+void gather(T* p, std::span<const std::size_t> members, U* out) noexcept {
+    const std::size_t n        = members.size();
+    const std::size_t* const m = members.data();
+    for(std::size_t i = 0; i < n; ++i) out[i] = p[m[i]];
+}
+
+} // namespace chemist::detail_
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/** @file strided_pointer.hpp
+ *
+ *  Helpers used by the strided view PIMPLs. Strides are measured in bytes
+ *  (like NumPy's strides) so that a single stride describes every member of an
+ *  array of structures, e.g., the x-coordinate, the charge, and the name of
+ *  the i-th element of an array of `Atom` structs all live at
+ *  `i * sizeof(Atom)` bytes past the corresponding member of the 0-th element.
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace chemist::detail_ {
+
+/** @brief Returns the address of the @p i-th element of a strided array.
+ *
+ *  @tparam T The (possibly const-qualified) type of the elements.
+ *
+ *  @param[in] p The address of the 0-th element.
+ *  @param[in] i The index of the element we want.
+ *  @param[in] stride The distance, in bytes, between consecutive elements.
+ *
+ *  @return The address of the @p i-th element.
+ *
+ *  @throw None No throw guarantee.
+ */
+template<typename T>
+T* strided_pointer(T* p, std::size_t i, std::size_t stride) noexcept {
+    using byte_pointer =
+      std::conditional_t<std::is_const_v<T>, const std::byte*, std::byte*>;
+    return reinterpret_cast<T*>(reinterpret_cast<byte_pointer>(p) + i * stride);
+}
+
+/** @brief Copies @p n elements of a strided array into a contiguous array.
+ *
+ *  If the strided array is actually contiguous this dispatches to std::copy.
+ *
+ *  @param[in] p The address of the 0-th element of the strided array.
+ *  @param[in] stride The distance, in bytes, between consecutive elements.
+ *  @param[in] n The number of elements to copy.
+ *  @param[out] out Where to put the elements. Must hold @p n elements.
+ *
+ *  @throw None No throw guarantee (assuming assigning a T to a U does not
+ *              throw).
+ */
+template<typename T, typename U>
+void strided_copy(T* p, std::size_t stride, std::size_t n, U* out) noexcept {
+    if(stride == sizeof(T)) {
+        std::copy(p, p + n, out);
+        return;
+    }
+    for(std::size_t i = 0; i < n; ++i) out[i] = *strided_pointer(p, i, stride);
+}
+
+/** @brief Compares two strided arrays of @p n elements for value equality.
+ *
+ *  If both arrays are actually contiguous this dispatches to std::equal so
+ *  that the comparison is just as fast as it is for contiguous views.
+ *
+ *  @throw None No throw guarantee (assuming T's operator== does not throw).
+ */
+template<typename T, typename U>
+bool strided_equal(T* plhs, std::size_t lhs_stride, U* prhs,
+                   std::size_t rhs_stride, std::size_t n) noexcept {
+    constexpr auto contiguous = sizeof(T);
+    if(lhs_stride == contiguous && rhs_stride == contiguous)
+        return std::equal(plhs, plhs + n, prhs);
+
+    for(std::size_t i = 0; i < n; ++i)
+        if(!(*strided_pointer(plhs, i, lhs_stride) ==
+             *strided_pointer(prhs, i, rhs_stride)))
+            return false;
+    return true;
+}
+
+} // namespace chemist::detail_
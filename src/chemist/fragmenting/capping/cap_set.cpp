@@ -14,38 +14,83 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <chemist/fragmenting/capping/cap_set.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace chemist::fragmenting {
+namespace {
 
-typename CapSet::index_set_type CapSet::get_cap_indices(
-  const index_set_type& fragment_indices) const {
+using size_type      = typename CapSet::size_type;
+using index_set_type = typename CapSet::index_set_type;
+
+/// Only caps with both an anchor and a replaced index can be needed
+bool is_indexable_(const Cap& cap) noexcept {
+    return cap.has_anchor_index() && cap.has_replaced_index();
+}
+
+/** @brief Finds the caps of a fragment by looking at every cap.
+ *
+ *  @param[in] caps The caps to look at.
+ *  @param[in] contains A callable, which given an index returns true if the
+ *                      index is in the fragment.
+ */
+template<typename CapContainer, typename ContainsType>
+index_set_type scan_caps_(const CapContainer& caps, ContainsType&& contains) {
     index_set_type rv;
-    for(size_type i = 0; i < m_caps_.size(); ++i) {
-        const auto& cap = m_caps_[i];
-        if(cap == Cap{}) continue;
-        auto anchor             = cap.get_anchor_index();
-        auto replaced           = cap.get_replaced_index();
-        const bool has_anchor   = fragment_indices.count(anchor);
-        const bool has_replaced = fragment_indices.count(replaced);
-        const bool broken_bond  = has_anchor && !has_replaced;
-        if(broken_bond) rv.insert(i);
+    for(size_type i = 0; i < caps.size(); ++i) {
+        const auto& cap = caps[i];
+        if(!is_indexable_(cap)) continue;
+        const bool has_anchor   = contains(cap.get_anchor_index());
+        const bool has_replaced = contains(cap.get_replaced_index());
+        if(has_anchor && !has_replaced) rv.insert(rv.end(), i);
     }
     return rv;
 }
 
-template<typename ReturnSetType, typename IndexSetType, typename CapSetType>
-auto cap_nuclei_guts_(IndexSetType&& is, CapSetType&& caps) {
-    if(caps.size() == 0) return ReturnSetType{};
-    auto cap_indices = caps.get_cap_indices(std::forward<IndexSetType>(is));
+/** @brief Finds the caps of a fragment with the anchor index.
+ *
+ *  @param[in] caps The caps @p anchors indexes.
+ *  @param[in] anchors The (anchor, offset) pairs of the caps, sorted.
+ *  @param[in] fragment The indices in the fragment, sorted.
+ *  @param[in] contains A callable, which given an index returns true if the
+ *                      index is in the fragment.
+ */
+template<typename CapContainer, typename IndexType, typename FragmentType,
+         typename ContainsType>
+index_set_type indexed_caps_(const CapContainer& caps, const IndexType& anchors,
+                             const FragmentType& fragment,
+                             ContainsType&& contains) {
+    auto by_anchor = [](const auto& entry, size_type anchor) {
+        return entry.first < anchor;
+    };
+
+    std::vector<size_type> buffer;
+    auto itr = anchors.begin();
+    for(auto anchor : fragment) {
+        // Both are sorted, so the caps of later anchors come after itr
+        itr = std::lower_bound(itr, anchors.end(), anchor, by_anchor);
+        for(; itr != anchors.end() && itr->first == anchor; ++itr) {
+            const auto replaced = caps[itr->second].get_replaced_index();
+            if(!contains(replaced)) buffer.push_back(itr->second);
+        }
+    }
+    std::sort(buffer.begin(), buffer.end());
+    return index_set_type(buffer.begin(), buffer.end());
+}
 
-    // Still No caps? Early abort
+/// Gathers the nuclei of the caps in @p cap_indices into a ReturnSetType
+template<typename ReturnSetType, typename CapContainer>
+ReturnSetType cap_nuclei_guts_(const index_set_type& cap_indices,
+                               CapContainer& caps) {
     if(cap_indices.empty()) return ReturnSetType{};
 
     typename ReturnSetType::reference_container cap_nuclei;
 
     for(auto i : cap_indices) {
-        auto&& cap_i = caps[i];
+        auto&& cap_i = caps.at(i);
         for(decltype(cap_i.size()) j = 0; j < cap_i.size(); ++j)
             cap_nuclei.push_back(cap_i.at(j));
     }
@@ -53,14 +98,120 @@ auto cap_nuclei_guts_(IndexSetType&& is, CapSetType&& caps) {
     return ReturnSetType(std::move(cap_nuclei));
 }
 
+} // namespace
+
+void CapSet::push_back(value_type cap) {
+    // Reserving first means nothing below can throw after cap is added
+    m_anchors_.reserve(m_anchors_.size() + 1);
+    m_caps_.emplace_back(std::move(cap));
+    index_(m_caps_.size() - 1);
+}
+
+void CapSet::set_cap(size_type i, value_type cap) {
+    if(i >= size()) throw std::out_of_range(std::to_string(i) + " >= size()");
+    // Reserving first means nothing below can throw after unindexing cap i
+    m_anchors_.reserve(m_anchors_.size() + 1);
+    unindex_(i);
+    m_caps_[i] = std::move(cap);
+    index_(i);
+}
+
+void CapSet::set_anchor_index(size_type i, size_type anchor) {
+    if(i >= size()) throw std::out_of_range(std::to_string(i) + " >= size()");
+    auto cap = m_caps_[i];
+    cap.set_anchor_index(anchor);
+    set_cap(i, std::move(cap));
+}
+
+void CapSet::set_replaced_index(size_type i, size_type replaced) {
+    if(i >= size()) throw std::out_of_range(std::to_string(i) + " >= size()");
+    auto cap = m_caps_[i];
+    cap.set_replaced_index(replaced);
+    set_cap(i, std::move(cap));
+}
+
+typename CapSet::index_set_type CapSet::get_cap_indices(
+  const index_set_type& fragment_indices) const {
+    auto contains = [&](size_type i) { return fragment_indices.count(i) > 0; };
+    return indexed_caps_(m_caps_, m_anchors_, fragment_indices, contains);
+}
+
+typename CapSet::index_set_type CapSet::get_cap_indices(
+  sorted_indices_type fragment_indices) const {
+    if(!std::is_sorted(fragment_indices.begin(), fragment_indices.end()))
+        throw std::runtime_error("Fragment indices must be sorted");
+    auto contains = [&](size_type i) {
+        return std::binary_search(fragment_indices.begin(),
+                                  fragment_indices.end(), i);
+    };
+    return indexed_caps_(m_caps_, m_anchors_, fragment_indices, contains);
+}
+
+typename CapSet::index_set_type CapSet::get_cap_indices(
+  const index_mask_type& fragment_mask) const {
+    // Every cap is looked at, but each check is O(1) and nothing is sorted
+    auto contains = [&](size_type i) {
+        return i < fragment_mask.size() && fragment_mask[i];
+    };
+    return scan_caps_(m_caps_, contains);
+}
+
 typename CapSet::nuclei_reference CapSet::get_cap_nuclei(
   const index_set_type& fragment_indices) {
-    return cap_nuclei_guts_<nuclei_reference>(fragment_indices, *this);
+    return get_nuclei(get_cap_indices(fragment_indices));
 }
 
 typename CapSet::const_nuclei_reference CapSet::get_cap_nuclei(
   const index_set_type& fragment_indices) const {
-    return cap_nuclei_guts_<const_nuclei_reference>(fragment_indices, *this);
+    return get_nuclei(get_cap_indices(fragment_indices));
+}
+
+typename CapSet::nuclei_reference CapSet::get_cap_nuclei(
+  sorted_indices_type fragment_indices) {
+    return get_nuclei(get_cap_indices(fragment_indices));
+}
+
+typename CapSet::const_nuclei_reference CapSet::get_cap_nuclei(
+  sorted_indices_type fragment_indices) const {
+    return get_nuclei(get_cap_indices(fragment_indices));
+}
+
+typename CapSet::nuclei_reference CapSet::get_nuclei(
+  const index_set_type& cap_indices) {
+    // The nuclei of the caps can be modified through the result, but not the
+    // indices, so m_anchors_ stays valid
+    return cap_nuclei_guts_<nuclei_reference>(cap_indices, m_caps_);
+}
+
+typename CapSet::const_nuclei_reference CapSet::get_nuclei(
+  const index_set_type& cap_indices) const {
+    return cap_nuclei_guts_<const_nuclei_reference>(cap_indices, m_caps_);
+}
+
+void CapSet::reindex_() {
+    anchor_index_type anchors;
+    for(size_type i = 0; i < m_caps_.size(); ++i) {
+        const auto& cap = m_caps_[i];
+        if(is_indexable_(cap)) anchors.emplace_back(cap.get_anchor_index(), i);
+    }
+    std::sort(anchors.begin(), anchors.end());
+    m_anchors_.swap(anchors);
+}
+
+void CapSet::index_(size_type i) {
+    const auto& cap = m_caps_[i];
+    if(!is_indexable_(cap)) return;
+    anchor_entry_type entry(cap.get_anchor_index(), i);
+    auto itr = std::upper_bound(m_anchors_.begin(), m_anchors_.end(), entry);
+    m_anchors_.insert(itr, entry);
+}
+
+void CapSet::unindex_(size_type i) noexcept {
+    const auto& cap = m_caps_[i];
+    if(!is_indexable_(cap)) return;
+    anchor_entry_type entry(cap.get_anchor_index(), i);
+    auto itr = std::lower_bound(m_anchors_.begin(), m_anchors_.end(), entry);
+    if(itr != m_anchors_.end() && *itr == entry) m_anchors_.erase(itr);
 }
 
 } // namespace chemist::fragmenting
@@ -15,6 +15,12 @@
  */
 
 #include <chemist/fragmenting/fragmented_nuclei.hpp>
+#include <algorithm>
+#include <chemist/hashing/hasher.hpp>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <vector>
 
 namespace chemist::fragmenting {
 namespace detail_ {
@@ -54,23 +60,34 @@ public:
     /// Type used for indexing and offsets
     using size_type = typename parent_type::size_type;
 
+    /// Type the caps of a fragment are looked up with
+    using sorted_indices_type = typename cap_set_type::sorted_indices_type;
+
+    /// Returned by find when a nucleus is not in the supersystem
+    static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
     FragmentedNucleiPIMPL() = default;
 
     FragmentedNucleiPIMPL(supersystem_type ss, nucleus_map_type frags,
                           cap_set_type caps) :
       m_supersystem_(std::move(ss)),
       m_frags_(std::move(frags)),
-      m_caps_(std::move(caps)) {}
+      m_caps_(std::move(caps)) {
+        m_sorted_frags_.reserve(m_frags_.size());
+        for(const auto& frag_i : m_frags_)
+            m_sorted_frags_.push_back(sorted_(frag_i));
+    }
 
     supersystem_reference supersystem() { return m_supersystem_; }
     const_supersystem_reference supersystem() const { return m_supersystem_; }
 
-    auto& frag(size_type i) { return m_frags_[i]; }
-
     const auto& frag(size_type i) const { return m_frags_[i]; }
 
     void add_fragment(nucleus_index_set frag) {
+        m_sorted_frags_.reserve(m_frags_.size() + 1);
+        auto sorted_frag = sorted_(frag);
         m_frags_.emplace_back(std::move(frag));
+        m_sorted_frags_.emplace_back(std::move(sorted_frag));
     }
 
     auto& cap_set() { return m_caps_; }
@@ -79,18 +96,55 @@ public:
     size_type size() const noexcept { return m_frags_.size(); }
 
     reference cap_nuclei(size_type i) {
-        auto& frag_i = frag(i);
+        sorted_indices_type frag_i(m_sorted_frags_[i]);
         if constexpr(std::is_same_v<std::decay_t<NucleiType>, NucleiType>) {
-            return cap_set().get_cap_nuclei(frag_i.begin(), frag_i.end());
+            return cap_set().get_cap_nuclei(frag_i);
         } else {
-            return std::as_const(cap_set()).get_cap_nuclei(frag_i.begin(),
-                                                           frag_i.end());
+            return std::as_const(cap_set()).get_cap_nuclei(frag_i);
         }
     }
 
     const_reference cap_nuclei(size_type i) const {
-        const auto& frag_i = frag(i);
-        return cap_set().get_cap_nuclei(frag_i.begin(), frag_i.end());
+        sorted_indices_type frag_i(m_sorted_frags_[i]);
+        return cap_set().get_cap_nuclei(frag_i);
+    }
+
+    /** @brief Finds the offset of @p nucleus in the supersystem.
+     *
+     *  If @p nucleus aliases a nucleus of the supersystem (e.g., it came from
+     *  a view of the supersystem) its offset follows from its address. Other
+     *  nuclei are looked up by their atomic number and position in a hash
+     *  table, which is built the first time it is needed, and candidates are
+     *  confirmed with operator==. Either way the cost does not depend on the
+     *  size of the supersystem.
+     *
+     *  The supersystem can be modified through a mutable reference, which
+     *  leaves the hash table stale. A stale table can only cause misses (hits
+     *  are confirmed), so a miss rebuilds the table and tries again.
+     *
+     *  @return If @p nucleus aliases a nucleus of the supersystem, the offset
+     *          of that nucleus (even if an earlier nucleus has the same
+     *          value). Otherwise, the offset of the first nucleus in the
+     *          supersystem equal to @p nucleus, or npos if there is no such
+     *          nucleus.
+     */
+    template<typename NucleusType>
+    size_type find(const NucleusType& nucleus) {
+        const auto n = m_supersystem_.size();
+        if(n == 0) return npos;
+
+        const auto* begin = std::as_const(m_supersystem_).atomic_number_data();
+        const auto* pZ    = &nucleus.Z();
+        std::less<decltype(begin)> less;
+        if(!less(pZ, begin) && less(pZ, begin + n))
+            return static_cast<size_type>(pZ - begin);
+
+        const bool was_built = !m_next_.empty();
+        if(!was_built) build_index_();
+        auto rv = find_in_index_(nucleus);
+        if(rv != npos || !was_built) return rv;
+        build_index_();
+        return find_in_index_(nucleus);
     }
 
     bool operator==(const FragmentedNucleiPIMPL& rhs) const noexcept {
@@ -99,12 +153,66 @@ public:
     }
 
 private:
+    /// Returns a sorted copy of @p frag
+    static nucleus_index_set sorted_(const nucleus_index_set& frag) {
+        nucleus_index_set rv(frag);
+        std::sort(rv.begin(), rv.end());
+        return rv;
+    }
+
+    /// Type of the key nuclei are hashed under
+    using hash_type = typename hashing::Hasher::hash_type;
+
+    /// Hashes the atomic number and position of @p nucleus
+    template<typename NucleusType>
+    static hash_type key_(const NucleusType& nucleus) noexcept {
+        hashing::Hasher h;
+        h.add(nucleus.Z()).add(nucleus.x()).add(nucleus.y()).add(nucleus.z());
+        return h.digest();
+    }
+
+    /// (Re)builds m_heads_ and m_next_ from the current supersystem
+    void build_index_() {
+        const auto n = m_supersystem_.size();
+        std::unordered_map<hash_type, size_type> heads;
+        std::vector<size_type> next(n, npos);
+        heads.reserve(n);
+        // Going backwards makes each chain run in increasing offset order
+        for(size_type i = n; i-- > 0;) {
+            auto [itr, is_new] = heads.try_emplace(key_(m_supersystem_[i]), i);
+            if(!is_new) {
+                next[i]     = itr->second;
+                itr->second = i;
+            }
+        }
+        m_heads_.swap(heads);
+        m_next_.swap(next);
+    }
+
+    template<typename NucleusType>
+    size_type find_in_index_(const NucleusType& nucleus) const {
+        auto itr = m_heads_.find(key_(nucleus));
+        if(itr == m_heads_.end()) return npos;
+        for(auto i = itr->second; i != npos; i = m_next_[i])
+            if(m_supersystem_[i] == nucleus) return i;
+        return npos;
+    }
+
     /// The supersystem being fragmented
     supersystem_type m_supersystem_;
 
     nucleus_map_type m_frags_;
 
     cap_set_type m_caps_;
+
+    /// m_sorted_frags_[i] is m_frags_[i] sorted, for finding its caps
+    nucleus_map_type m_sorted_frags_;
+
+    /// Maps the key of a nucleus to the first supersystem offset with that key
+    std::unordered_map<hash_type, size_type> m_heads_;
+
+    /// m_next_[i] is the next offset after i with the same key (or npos)
+    std::vector<size_type> m_next_;
 };
 
 } // namespace detail_
@@ -175,16 +283,12 @@ TPARAMS
 void FRAGMENTED_NUCLEI::insert(const_reference nuclei) {
     nucleus_index_set nuclei2;
     nuclei2.reserve(nuclei.size());
-    const auto& ss = this->supersystem();
+    if(!has_pimpl_()) std::make_unique<pimpl_type>().swap(m_pimpl_);
     for(const auto& ni : nuclei) {
-        for(size_type i = 0; i < ss.size(); ++i) {
-            if(ss[i] == ni) {
-                nuclei2.push_back(i);
-                break;
-            }
-            if(i + 1 == ss.size())
-                throw std::runtime_error("Nucleus not in supersystem");
-        }
+        const auto i = m_pimpl_->find(ni);
+        if(i == pimpl_type::npos)
+            throw std::runtime_error("Nucleus not in supersystem");
+        nuclei2.push_back(i);
     }
     insert(std::move(nuclei2));
 }
@@ -290,8 +394,8 @@ typename FRAGMENTED_NUCLEI::const_reference FRAGMENTED_NUCLEI::concatenate_(
     }
 
     const_reference real(this->supersystem(), nuclei);
-    auto caps =
-      m_pimpl_->cap_set().get_cap_nuclei(nuclei.begin(), nuclei.end());
+    const auto& all_caps = std::as_const(*m_pimpl_).cap_set();
+    auto caps = all_caps.get_cap_nuclei(nuclei.begin(), nuclei.end());
 
     if(caps.size() == 0) return real;
 
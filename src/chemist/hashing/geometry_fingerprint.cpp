@@ -0,0 +1,306 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chemist/hashing/geometry_fingerprint.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace chemist::hashing {
+namespace {
+
+using size_type = std::size_t;
+using hash_type = typename Hasher::hash_type;
+
+/// Coordinates of a geometry whose centroid has been moved to the origin
+struct CenteredGeometry {
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+
+    size_type size() const noexcept { return x.size(); }
+
+    /// Appends a point
+    void push_back(double xi, double yi, double zi) {
+        x.push_back(xi);
+        y.push_back(yi);
+        z.push_back(zi);
+    }
+
+    /// Moves the centroid of the points added so far to the origin
+    void center() {
+        const auto n = size();
+        if(n == 0) return;
+        double cx = 0.0, cy = 0.0, cz = 0.0;
+        for(size_type i = 0; i < n; ++i) {
+            cx += x[i];
+            cy += y[i];
+            cz += z[i];
+        }
+        cx /= n;
+        cy /= n;
+        cz /= n;
+        for(size_type i = 0; i < n; ++i) {
+            x[i] -= cx;
+            y[i] -= cy;
+            z[i] -= cz;
+        }
+    }
+};
+
+template<typename T>
+CenteredGeometry centered_(const PointSet<T>& points) {
+    CenteredGeometry rv;
+    const auto* px = points.x_data();
+    const auto* py = points.y_data();
+    const auto* pz = points.z_data();
+    rv.x.assign(px, px + points.size());
+    rv.y.assign(py, py + points.size());
+    rv.z.assign(pz, pz + points.size());
+    rv.center();
+    return rv;
+}
+
+template<typename NucleiType>
+CenteredGeometry centered_nuclei_(const NucleiType& nuclei) {
+    CenteredGeometry rv;
+    for(size_type i = 0; i < nuclei.size(); ++i) {
+        const auto nuke = nuclei[i];
+        rv.push_back(nuke.x(), nuke.y(), nuke.z());
+    }
+    rv.center();
+    return rv;
+}
+
+void check_tolerance_(double tolerance) {
+    if(!(tolerance > 0.0))
+        throw std::runtime_error("Geometry tolerance must be positive");
+}
+
+/// Hashes the coordinates of @p g rounded to multiples of @p tolerance
+void hash_geometry_(Hasher& h, const CenteredGeometry& g, double tolerance,
+                    GeometryInvariance invariance) {
+    check_tolerance_(tolerance);
+    auto quantize = [=](double v) { return std::llround(v / tolerance); };
+
+    const auto n = g.size();
+    h.add(n).add(invariance);
+    if(invariance == GeometryInvariance::translation) {
+        for(size_type i = 0; i < n; ++i) {
+            h.add(quantize(g.x[i])).add(quantize(g.y[i]));
+            h.add(quantize(g.z[i]));
+        }
+        return;
+    }
+
+    // Distances to the centroid and to the next point are rotation invariant
+    for(size_type i = 0; i < n; ++i) {
+        const size_type j = (i + 1) % n;
+        const double dx   = g.x[i] - g.x[j];
+        const double dy   = g.y[i] - g.y[j];
+        const double dz   = g.z[i] - g.z[j];
+        const double r2   = g.x[i] * g.x[i] + g.y[i] * g.y[i] + g.z[i] * g.z[i];
+        const double d2   = dx * dx + dy * dy + dz * dz;
+        h.add(quantize(std::sqrt(r2))).add(quantize(std::sqrt(d2)));
+    }
+}
+
+/// Largest eigenvalue of the symmetric 4 by 4 matrix @p a (cyclic Jacobi)
+double largest_eigenvalue_(std::array<std::array<double, 4>, 4> a) {
+    for(size_type sweep = 0; sweep < 50; ++sweep) {
+        double off = 0.0, diag = 0.0;
+        for(size_type p = 0; p < 4; ++p) {
+            diag += a[p][p] * a[p][p];
+            for(size_type q = p + 1; q < 4; ++q) off += a[p][q] * a[p][q];
+        }
+        if(off <= 1.0E-30 * diag) break;
+
+        for(size_type p = 0; p < 4; ++p) {
+            for(size_type q = p + 1; q < 4; ++q) {
+                if(a[p][q] == 0.0) continue;
+                const double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                const double t     = (theta >= 0.0 ? 1.0 : -1.0) /
+                                 (std::fabs(theta) + std::hypot(theta, 1.0));
+                const double c = 1.0 / std::hypot(t, 1.0);
+                const double s = t * c;
+                for(size_type k = 0; k < 4; ++k) {
+                    const double akp = a[k][p], akq = a[k][q];
+                    a[k][p]          = c * akp - s * akq;
+                    a[k][q]          = s * akp + c * akq;
+                }
+                for(size_type k = 0; k < 4; ++k) {
+                    const double apk = a[p][k], aqk = a[q][k];
+                    a[p][k]          = c * apk - s * aqk;
+                    a[q][k]          = s * apk + c * aqk;
+                }
+            }
+        }
+    }
+    return std::max({a[0][0], a[1][1], a[2][2], a[3][3]});
+}
+
+double rmsd_(const CenteredGeometry& a, const CenteredGeometry& b,
+             GeometryInvariance invariance) {
+    if(a.size() != b.size())
+        throw std::runtime_error("Geometries must have the same size");
+    const auto n = a.size();
+    if(n == 0) return 0.0;
+
+    if(invariance == GeometryInvariance::translation) {
+        double sum = 0.0;
+        for(size_type i = 0; i < n; ++i) {
+            const double dx = a.x[i] - b.x[i];
+            const double dy = a.y[i] - b.y[i];
+            const double dz = a.z[i] - b.z[i];
+            sum += dx * dx + dy * dy + dz * dz;
+        }
+        return std::sqrt(sum / n);
+    }
+
+    // Horn's method: the optimal rotation is the eigenvector of K with the
+    // largest eigenvalue, lambda, and the minimal sum of squared deviations
+    // is e0 - 2 lambda
+    double sxx = 0.0, sxy = 0.0, sxz = 0.0, syx = 0.0, syy = 0.0, syz = 0.0;
+    double szx = 0.0, szy = 0.0, szz = 0.0, e0 = 0.0;
+    for(size_type i = 0; i < n; ++i) {
+        sxx += a.x[i] * b.x[i];
+        sxy += a.x[i] * b.y[i];
+        sxz += a.x[i] * b.z[i];
+        syx += a.y[i] * b.x[i];
+        syy += a.y[i] * b.y[i];
+        syz += a.y[i] * b.z[i];
+        szx += a.z[i] * b.x[i];
+        szy += a.z[i] * b.y[i];
+        szz += a.z[i] * b.z[i];
+        e0 += a.x[i] * a.x[i] + a.y[i] * a.y[i] + a.z[i] * a.z[i];
+        e0 += b.x[i] * b.x[i] + b.y[i] * b.y[i] + b.z[i] * b.z[i];
+    }
+    std::array<std::array<double, 4>, 4> k{
+      {{sxx + syy + szz, syz - szy, szx - sxz, sxy - syx},
+       {syz - szy, sxx - syy - szz, sxy + syx, szx + sxz},
+       {szx - sxz, sxy + syx, -sxx + syy - szz, syz + szy},
+       {sxy - syx, szx + sxz, syz + szy, -sxx - syy + szz}}};
+    const double lambda = largest_eigenvalue_(k);
+    return std::sqrt(std::max(0.0, (e0 - 2.0 * lambda) / n));
+}
+
+/// Hashes @p nuclei exactly, except for the coordinates which are quantized
+template<typename NucleiType>
+void hash_nuclei_(Hasher& h, const NucleiType& nuclei, double tolerance,
+                  GeometryInvariance invariance) {
+    for(size_type i = 0; i < nuclei.size(); ++i) {
+        const auto nuke         = nuclei[i];
+        const std::string& name = nuke.name();
+        h.add(std::string_view(name)).add(nuke.Z()).add(nuke.mass());
+        h.add(nuke.charge());
+    }
+    hash_geometry_(h, centered_nuclei_(nuclei), tolerance, invariance);
+}
+
+template<typename LHSType, typename RHSType>
+bool same_nuclei_(const LHSType& lhs, const RHSType& rhs, double tolerance,
+                  GeometryInvariance invariance) {
+    if(lhs.size() != rhs.size()) return false;
+    for(size_type i = 0; i < lhs.size(); ++i) {
+        const auto l = lhs[i];
+        const auto r = rhs[i];
+        if(l.name() != r.name() || l.Z() != r.Z()) return false;
+        if(l.mass() != r.mass() || l.charge() != r.charge()) return false;
+    }
+    const auto lhs_geom = centered_nuclei_(lhs);
+    const auto rhs_geom = centered_nuclei_(rhs);
+    return rmsd_(lhs_geom, rhs_geom, invariance) <= tolerance;
+}
+
+} // namespace
+
+// -- Fingerprints -------------------------------------------------------------
+
+template<typename T>
+hash_type geometry_fingerprint(const PointSet<T>& points, double tolerance,
+                               GeometryInvariance invariance) {
+    Hasher h;
+    hash_geometry_(h, centered_(points), tolerance, invariance);
+    return h.digest();
+}
+
+hash_type geometry_fingerprint(const Nuclei& nuclei, double tolerance,
+                               GeometryInvariance invariance) {
+    Hasher h;
+    hash_nuclei_(h, nuclei, tolerance, invariance);
+    return h.digest();
+}
+
+hash_type geometry_fingerprint(const Molecule& molecule, double tolerance,
+                               GeometryInvariance invariance) {
+    Hasher h;
+    h.add(molecule.size());
+    if(molecule.size()) {
+        h.add(molecule.charge()).add(molecule.multiplicity());
+        hash_nuclei_(h, molecule.nuclei(), tolerance, invariance);
+    } else {
+        check_tolerance_(tolerance);
+    }
+    return h.digest();
+}
+
+// -- Comparisons --------------------------------------------------------------
+
+template<typename T>
+double geometry_rmsd(const PointSet<T>& lhs, const PointSet<T>& rhs,
+                     GeometryInvariance invariance) {
+    return rmsd_(centered_(lhs), centered_(rhs), invariance);
+}
+
+template<typename T>
+bool same_geometry(const PointSet<T>& lhs, const PointSet<T>& rhs,
+                   double tolerance, GeometryInvariance invariance) {
+    if(lhs.size() != rhs.size()) return false;
+    return geometry_rmsd(lhs, rhs, invariance) <= tolerance;
+}
+
+bool same_geometry(const Nuclei& lhs, const Nuclei& rhs, double tolerance,
+                   GeometryInvariance invariance) {
+    return same_nuclei_(lhs, rhs, tolerance, invariance);
+}
+
+bool same_geometry(const Molecule& lhs, const Molecule& rhs, double tolerance,
+                   GeometryInvariance invariance) {
+    if(lhs.size() != rhs.size()) return false;
+    if(lhs.size() == 0) return true;
+    if(lhs.charge() != rhs.charge()) return false;
+    if(lhs.multiplicity() != rhs.multiplicity()) return false;
+    return same_nuclei_(lhs.nuclei(), rhs.nuclei(), tolerance, invariance);
+}
+
+#define INSTANTIATE(T)                                                        \
+    template hash_type geometry_fingerprint(const PointSet<T>&, double,       \
+                                            GeometryInvariance);              \
+    template double geometry_rmsd(const PointSet<T>&, const PointSet<T>&,     \
+                                  GeometryInvariance);                        \
+    template bool same_geometry(const PointSet<T>&, const PointSet<T>&,       \
+                                double, GeometryInvariance)
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+
+#undef INSTANTIATE
+
+} // namespace chemist::hashing
@@ -0,0 +1,369 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chemist/hashing/hashing.hpp>
+
+namespace chemist::hashing {
+namespace {
+
+/// Feeds the first @p n points stored in the columns @p x, @p y, @p z to @p h
+template<typename T>
+void hash_points_(Hasher& h, const T* x, const T* y, const T* z,
+                  std::size_t n) {
+    for(std::size_t i = 0; i < n; ++i) h.add(x[i]).add(y[i]).add(z[i]);
+}
+
+/// Feeds the size and then each element of @p object to @p h
+template<typename ContainerType>
+void hash_elements_(Hasher& h, const ContainerType& object) {
+    h.add(object.size());
+    for(std::size_t i = 0; i < object.size(); ++i) hash_append(h, object[i]);
+}
+
+/// Feeds a charges object, whose state is stored as columns, to @p h
+template<typename ChargesType>
+void hash_charge_columns_(Hasher& h, const ChargesType& object) {
+    const auto n = object.size();
+    h.add(n);
+    if(n == 0) return;
+    const auto& points = object.point_set();
+    const auto x       = points.x_column();
+    const auto y       = points.y_column();
+    const auto z       = points.z_column();
+    const auto q       = object.charge_column();
+    for(std::size_t i = 0; i < n; ++i)
+        h.add(x[i]).add(y[i]).add(z[i]).add(q[i]);
+}
+
+} // namespace
+
+// -- Points and point charges -------------------------------------------------
+
+void hash_append(Hasher& h, const Nucleus& object) {
+    const std::string& name = object.name();
+    h.add(std::string_view(name)).add(object.Z()).add(object.mass());
+    h.add(object.x()).add(object.y()).add(object.z()).add(object.charge());
+}
+
+// -- Containers of points and point charges -----------------------------------
+
+template<typename T>
+void hash_append(Hasher& h, const PointSet<T>& object) {
+    h.add(object.size());
+    hash_points_(h, object.x_data(), object.y_data(), object.z_data(),
+                 object.size());
+}
+
+template<typename PointSetType>
+void hash_append(Hasher& h, const PointSetView<PointSetType>& object) {
+    if(!object.is_contiguous()) return hash_elements_(h, object);
+    h.add(object.size());
+    if(object.empty()) return;
+    hash_points_(h, object.x_column().data(), object.y_column().data(),
+                 object.z_column().data(), object.size());
+}
+
+template<typename T>
+void hash_append(Hasher& h, const Charges<T>& object) {
+    hash_charge_columns_(h, object);
+}
+
+template<typename ChargesType>
+void hash_append(Hasher& h, const ChargesView<ChargesType>& object) {
+    if(!object.is_contiguous()) return hash_elements_(h, object);
+    hash_charge_columns_(h, object);
+}
+
+void hash_append(Hasher& h, const Nuclei& object) {
+    const auto n = object.size();
+    h.add(n);
+    if(n == 0) return;
+
+    // Reads each column directly instead of making a NucleusView per nucleus
+    const auto names   = object.name_data();
+    const auto zs      = object.atomic_number_data();
+    const auto masses  = object.mass_data();
+    const auto charges = object.charges();
+    const auto points  = charges.point_set();
+    const auto x       = points.x_column();
+    const auto y       = points.y_column();
+    const auto z       = points.z_column();
+    const auto q       = charges.charge_column();
+    for(std::size_t i = 0; i < n; ++i) {
+        const std::string& name = names[i];
+        h.add(std::string_view(name)).add(zs[i]).add(masses[i]);
+        h.add(x[i]).add(y[i]).add(z[i]).add(q[i]);
+    }
+}
+
+template<typename NucleiType>
+void hash_append(Hasher& h, const NucleiView<NucleiType>& object) {
+    hash_elements_(h, object);
+}
+
+// -- Atoms, molecules, and chemical systems -----------------------------------
+
+void hash_append(Hasher& h, const Atom& object) {
+    hash_append(h, object.nucleus());
+    h.add(object.n_electrons());
+}
+
+namespace {
+
+template<typename MoleculeType>
+void hash_molecule_(Hasher& h, const MoleculeType& object) {
+    h.add(object.size());
+    if(object.size() == 0) return;
+    hash_append(h, object.nuclei());
+    h.add(object.charge()).add(object.multiplicity());
+}
+
+} // namespace
+
+void hash_append(Hasher& h, const Molecule& object) {
+    hash_molecule_(h, object);
+}
+
+template<typename MoleculeType>
+void hash_append(Hasher& h, const MoleculeView<MoleculeType>& object) {
+    hash_molecule_(h, object);
+}
+
+void hash_append(Hasher& h, const ChemicalSystem& object) {
+    hash_append(h, object.molecule());
+}
+
+template<typename ChemicalSystemType>
+void hash_append(Hasher& h,
+                 const ChemicalSystemView<ChemicalSystemType>& object) {
+    hash_append(h, object.molecule());
+}
+
+// -- Basis sets ---------------------------------------------------------------
+
+namespace {
+
+template<typename PrimitiveType>
+void hash_primitive_(Hasher& h, const PrimitiveType& object) {
+    h.add(object.is_null());
+    if(object.is_null()) return;
+    hash_append(h, object.center());
+    h.add(object.coefficient()).add(object.exponent());
+}
+
+template<typename CGType>
+void hash_cg_(Hasher& h, const CGType& object) {
+    h.add(object.is_null());
+    if(object.is_null()) return;
+    hash_append(h, object.center());
+    h.add(object.size());
+    for(std::size_t i = 0; i < object.size(); ++i) {
+        const auto prim = object[i];
+        h.add(prim.coefficient()).add(prim.exponent());
+    }
+}
+
+template<typename ShellType>
+void hash_shell_(Hasher& h, const ShellType& object) {
+    h.add(object.is_null());
+    if(object.is_null()) return;
+    h.add(object.pure()).add(object.l());
+    hash_append(h, object.contracted_gaussian());
+}
+
+template<typename AtomicBasisSetType>
+void hash_atomic_basis_set_(Hasher& h, const AtomicBasisSetType& object) {
+    h.add(object.is_null());
+    if(object.is_null()) return;
+    // The name and atomic number are optional
+    const auto& name = object.basis_set_name();
+    const auto& z    = object.atomic_number();
+    h.add(name.has_value());
+    if(name.has_value()) h.add(std::string_view(*name));
+    h.add(z.has_value());
+    if(z.has_value()) h.add(*z);
+    hash_append(h, object.center());
+    hash_elements_(h, object);
+}
+
+} // namespace
+
+template<typename T>
+void hash_append(Hasher& h, const basis_set::Primitive<T>& object) {
+    hash_primitive_(h, object);
+}
+
+template<typename PrimitiveType>
+void hash_append(Hasher& h,
+                 const basis_set::PrimitiveView<PrimitiveType>& object) {
+    hash_primitive_(h, object);
+}
+
+template<typename PrimitiveType>
+void hash_append(Hasher& h,
+                 const basis_set::ContractedGaussian<PrimitiveType>& object) {
+    hash_cg_(h, object);
+}
+
+template<typename CGType>
+void hash_append(Hasher& h,
+                 const basis_set::ContractedGaussianView<CGType>& object) {
+    hash_cg_(h, object);
+}
+
+template<typename CGType>
+void hash_append(Hasher& h, const basis_set::Shell<CGType>& object) {
+    hash_shell_(h, object);
+}
+
+template<typename ShellType>
+void hash_append(Hasher& h, const basis_set::ShellView<ShellType>& object) {
+    hash_shell_(h, object);
+}
+
+template<typename ShellType>
+void hash_append(Hasher& h,
+                 const basis_set::AtomicBasisSet<ShellType>& object) {
+    hash_atomic_basis_set_(h, object);
+}
+
+template<typename AtomicBasisSetType>
+void hash_append(
+  Hasher& h, const basis_set::AtomicBasisSetView<AtomicBasisSetType>& object) {
+    hash_atomic_basis_set_(h, object);
+}
+
+template<typename AtomicBasisSetType>
+void hash_append(Hasher& h,
+                 const basis_set::AOBasisSet<AtomicBasisSetType>& object) {
+    hash_elements_(h, object);
+}
+
+// -- Fragments ----------------------------------------------------------------
+
+void hash_append(Hasher& h, const fragmenting::Cap& object) {
+    h.add(object.has_anchor_index());
+    if(object.has_anchor_index()) h.add(object.get_anchor_index());
+    h.add(object.has_replaced_index());
+    if(object.has_replaced_index()) h.add(object.get_replaced_index());
+    h.add(object.size());
+    for(std::size_t i = 0; i < object.size(); ++i) hash_append(h, object.at(i));
+}
+
+void hash_append(Hasher& h, const fragmenting::CapSet& object) {
+    hash_elements_(h, object);
+}
+
+template<typename NucleiType>
+void hash_append(Hasher& h,
+                 const fragmenting::FragmentedNuclei<NucleiType>& object) {
+    hash_append(h, object.supersystem());
+    // Fragmenting an empty supersystem compares equal regardless of the
+    // fragments, so only the supersystem contributes to the hash
+    if(object.supersystem().size() == 0) return;
+    h.add(object.size());
+    for(std::size_t i = 0; i < object.size(); ++i) {
+        const auto members = object.nuclear_indices(i);
+        h.add(members.size()).add_range(members.data(), members.size());
+    }
+    hash_append(h, object.cap_set());
+}
+
+template<typename MoleculeType>
+void hash_append(Hasher& h,
+                 const fragmenting::FragmentedMolecule<MoleculeType>& object) {
+    hash_append(h, object.supersystem());
+    if(object.supersystem().size() == 0) return;
+    hash_append(h, object.fragmented_nuclei());
+    for(std::size_t i = 0; i < object.size(); ++i) {
+        const auto fragment = object[i];
+        h.add(fragment.charge()).add(fragment.multiplicity());
+    }
+}
+
+template<typename ChemicalSystemType>
+void hash_append(
+  Hasher& h,
+  const fragmenting::FragmentedChemicalSystem<ChemicalSystemType>& object) {
+    hash_append(h, object.supersystem());
+    h.add(object.size());
+    for(std::size_t i = 0; i < object.size(); ++i) hash_append(h, object[i]);
+}
+
+// -- Explicit instantiations --------------------------------------------------
+
+#define INSTANTIATE(TYPE) template void hash_append(Hasher&, const TYPE&)
+
+INSTANTIATE(PointSet<float>);
+INSTANTIATE(PointSet<double>);
+INSTANTIATE(PointSetView<PointSet<float>>);
+INSTANTIATE(PointSetView<const PointSet<float>>);
+INSTANTIATE(PointSetView<PointSet<double>>);
+INSTANTIATE(PointSetView<const PointSet<double>>);
+INSTANTIATE(Charges<float>);
+INSTANTIATE(Charges<double>);
+INSTANTIATE(ChargesView<Charges<float>>);
+INSTANTIATE(ChargesView<const Charges<float>>);
+INSTANTIATE(ChargesView<Charges<double>>);
+INSTANTIATE(ChargesView<const Charges<double>>);
+INSTANTIATE(NucleiView<Nuclei>);
+INSTANTIATE(NucleiView<const Nuclei>);
+INSTANTIATE(MoleculeView<Molecule>);
+INSTANTIATE(MoleculeView<const Molecule>);
+INSTANTIATE(ChemicalSystemView<ChemicalSystem>);
+INSTANTIATE(ChemicalSystemView<const ChemicalSystem>);
+
+INSTANTIATE(basis_set::PrimitiveD);
+INSTANTIATE(basis_set::PrimitiveF);
+INSTANTIATE(basis_set::PrimitiveView<basis_set::PrimitiveD>);
+INSTANTIATE(basis_set::PrimitiveView<const basis_set::PrimitiveD>);
+INSTANTIATE(basis_set::PrimitiveView<basis_set::PrimitiveF>);
+INSTANTIATE(basis_set::PrimitiveView<const basis_set::PrimitiveF>);
+INSTANTIATE(basis_set::ContractedGaussianD);
+INSTANTIATE(basis_set::ContractedGaussianF);
+INSTANTIATE(
+  basis_set::ContractedGaussianView<basis_set::ContractedGaussianD>);
+INSTANTIATE(
+  basis_set::ContractedGaussianView<const basis_set::ContractedGaussianD>);
+INSTANTIATE(
+  basis_set::ContractedGaussianView<basis_set::ContractedGaussianF>);
+INSTANTIATE(
+  basis_set::ContractedGaussianView<const basis_set::ContractedGaussianF>);
+INSTANTIATE(basis_set::ShellD);
+INSTANTIATE(basis_set::ShellF);
+INSTANTIATE(basis_set::ShellView<basis_set::ShellD>);
+INSTANTIATE(basis_set::ShellView<const basis_set::ShellD>);
+INSTANTIATE(basis_set::ShellView<basis_set::ShellF>);
+INSTANTIATE(basis_set::ShellView<const basis_set::ShellF>);
+INSTANTIATE(basis_set::AtomicBasisSetD);
+INSTANTIATE(basis_set::AtomicBasisSetF);
+INSTANTIATE(basis_set::AtomicBasisSetView<basis_set::AtomicBasisSetD>);
+INSTANTIATE(basis_set::AtomicBasisSetView<const basis_set::AtomicBasisSetD>);
+INSTANTIATE(basis_set::AtomicBasisSetView<basis_set::AtomicBasisSetF>);
+INSTANTIATE(basis_set::AtomicBasisSetView<const basis_set::AtomicBasisSetF>);
+INSTANTIATE(basis_set::AOBasisSetD);
+INSTANTIATE(basis_set::AOBasisSetF);
+
+INSTANTIATE(fragmenting::FragmentedNuclei<Nuclei>);
+INSTANTIATE(fragmenting::FragmentedNuclei<const Nuclei>);
+INSTANTIATE(fragmenting::FragmentedMolecule<Molecule>);
+INSTANTIATE(fragmenting::FragmentedMolecule<const Molecule>);
+INSTANTIATE(fragmenting::FragmentedChemicalSystem<ChemicalSystem>);
+INSTANTIATE(fragmenting::FragmentedChemicalSystem<const ChemicalSystem>);
+
+#undef INSTANTIATE
+
+} // namespace chemist::hashing
@@ -15,6 +15,7 @@
  */
 
 #include "detail_/molecule_pimpl.hpp"
+#include <chemist/detail_/permutation.hpp>
 #include <chemist/molecule/molecule_class.hpp>
 #include <iostream> //For std::endl
 
@@ -142,6 +143,27 @@ void Molecule::push_back(atom_type atom) {
     set_charge_();
 }
 
+void Molecule::permute(const permutation_type& p) {
+    detail_::check_permutation(p, size());
+    if(has_pimpl_()) m_pimpl_->nuclei().permute(p);
+}
+
+typename Molecule::permutation_type Molecule::reorder(
+  SpaceFillingCurve curve) {
+    if(!has_pimpl_()) return permutation_type{};
+    return m_pimpl_->nuclei().reorder(curve);
+}
+
+void Molecule::transform(const affine_type& f) noexcept {
+    if(has_pimpl_()) m_pimpl_->nuclei().transform(f);
+}
+
+Molecule Molecule::transformed(const affine_type& f) const {
+    Molecule rv(*this);
+    rv.transform(f);
+    return rv;
+}
+
 // -- Utility methods ----------------------------------------------------------
 
 void Molecule::swap(Molecule& other) noexcept { m_pimpl_.swap(other.m_pimpl_); }
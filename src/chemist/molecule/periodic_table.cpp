@@ -0,0 +1,60 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chemist/molecule/periodic_table.hpp>
+#include <utility>
+
+namespace chemist {
+namespace {
+
+/// Wraps @p nuclei in a Molecule with the default multiplicity
+Molecule make_molecule_(Nuclei nuclei, Molecule::charge_type charge) {
+    using multiplicity_type = typename Molecule::multiplicity_type;
+
+    long n_electrons = -long(charge);
+    for(const auto& nuke : nuclei) n_electrons += nuke.Z();
+
+    multiplicity_type multiplicity = (n_electrons % 2) ? 2 : 1;
+    if(nuclei.size() == 1 && charge == 0)
+        multiplicity = element(nuclei[0].Z()).multiplicity;
+
+    return Molecule(charge, multiplicity, std::move(nuclei));
+}
+
+} // namespace
+
+Molecule make_molecule(std::span<const Element::atomic_number_type> Zs,
+                       std::span<const double> x, std::span<const double> y,
+                       std::span<const double> z,
+                       Molecule::charge_type charge) {
+    return make_molecule_(make_nuclei(Zs, x, y, z), charge);
+}
+
+Molecule make_molecule(std::span<const std::string_view> symbols,
+                       std::span<const double> x, std::span<const double> y,
+                       std::span<const double> z,
+                       Molecule::charge_type charge) {
+    return make_molecule_(make_nuclei(symbols, x, y, z), charge);
+}
+
+Molecule make_molecule(std::span<const std::string> symbols,
+                       std::span<const double> x, std::span<const double> y,
+                       std::span<const double> z,
+                       Molecule::charge_type charge) {
+    return make_molecule_(make_nuclei(symbols, x, y, z), charge);
+}
+
+} // namespace chemist
@@ -15,7 +15,9 @@
  */
 
 #pragma once
+#include "../../detail_/gather.hpp"
 #include "nuclei_view_pimpl.hpp"
+#include <vector>
 
 namespace chemist::detail_ {
 
@@ -63,6 +65,9 @@ public:
     /// Type of a pointer to the base of the PIMPL
     using typename base_type::pimpl_pointer;
 
+    /// Type used to hold the indices of a subset of the nuclei
+    using typename base_type::member_list_type;
+
     /** @brief Aliases an empty Nuclei object.
      *
      *  The default ctor will create a PIMPL which aliases an empty Nuclei
@@ -157,6 +162,24 @@ protected:
 
     size_type size_() const noexcept override { return m_charges_.size(); }
 
+    atomic_number_pointer atomic_number_data_() const noexcept override {
+        return m_patomic_numbers_;
+    }
+
+    mass_pointer mass_data_() const noexcept override { return m_pmasses_; }
+
+    /// Copies the columns straight out of the aliased arrays
+    nuclei_type as_nuclei_() const override {
+        const auto n = size_();
+        return nuclei_type(m_charges_.as_charges(),
+                           {m_pnames_, m_pnames_ + n},
+                           {m_patomic_numbers_, m_patomic_numbers_ + n},
+                           {m_pmasses_, m_pmasses_ + n});
+    }
+
+    /// Gathers the members straight out of the aliased arrays
+    nuclei_type gather_(const member_list_type& members) const override;
+
     bool are_equal_(const base_type& other) const noexcept override {
         return base_type::template are_equal_impl_<my_type>(other);
     }
@@ -179,6 +202,35 @@ private:
 // -- Out of line definitions
 // -----------------------------------------------------------------------------
 
+template<typename NucleiType>
+typename ContiguousNucleiView<NucleiType>::nuclei_type
+ContiguousNucleiView<NucleiType>::gather_(
+  const member_list_type& members) const {
+    using charges_type = typename nuclei_type::charge_set_type;
+    using coord_type   = typename charges_type::coord_type;
+    using charge_type  = typename charges_type::charge_type;
+
+    // The charges may not be contiguous even though the other columns are
+    if(!m_charges_.is_contiguous()) return base_type::gather_(members);
+
+    const auto n = members.size();
+    std::vector<typename nuclei_type::name_type> names(n);
+    std::vector<typename nuclei_type::atomic_number_type> Zs(n);
+    std::vector<typename nuclei_type::mass_type> masses(n);
+    std::vector<coord_type> x(n), y(n), z(n);
+    std::vector<charge_type> qs(n);
+    const auto points = m_charges_.point_set();
+    gather(m_pnames_, members, names.data());
+    gather(m_patomic_numbers_, members, Zs.data());
+    gather(m_pmasses_, members, masses.data());
+    gather(points.x_column().data(), members, x.data());
+    gather(points.y_column().data(), members, y.data());
+    gather(points.z_column().data(), members, z.data());
+    gather(m_charges_.charge_column().data(), members, qs.data());
+    return nuclei_type(charges_type(x, y, z, qs), std::move(names),
+                       std::move(Zs), std::move(masses));
+}
+
 template<typename NucleiType>
 bool ContiguousNucleiView<NucleiType>::operator==(
   const ContiguousNucleiView& rhs) const noexcept {
@@ -15,7 +15,10 @@
  */
 
 #pragma once
+#include <chemist/detail_/permutation.hpp>
 #include <chemist/nucleus/nuclei.hpp>
+#include <chemist/point/space_filling_curve.hpp>
+#include <stdexcept>
 #include <vector>
 
 namespace chemist::detail_ {
@@ -46,7 +49,9 @@ public:
     using charge_set_reference = typename parent_type::charge_set_reference;
     using const_charge_set_reference =
       typename parent_type::const_charge_set_reference;
-    using size_type = typename parent_type::size_type;
+    using size_type        = typename parent_type::size_type;
+    using permutation_type = typename parent_type::permutation_type;
+    using affine_type      = typename parent_type::affine_type;
     ///@}
 
     /// Reuse Nucleus types
@@ -56,6 +61,55 @@ public:
     using mass_type          = typename value_type::mass_type;
     ///@}
 
+    /// Creates a PIMPL for an empty Nuclei object
+    NucleiPIMPL() = default;
+
+    /// Creates a PIMPL which takes ownership of the provided columns
+    NucleiPIMPL(charge_set_type charges, std::vector<name_type> names,
+                std::vector<atomic_number_type> Zs,
+                std::vector<mass_type> masses) {
+        const auto n = charges.size();
+        if(names.size() != n || Zs.size() != n || masses.size() != n)
+            throw std::runtime_error("Must provide one name, atomic number, "
+                                     "and mass per charge");
+        m_charges_ = std::move(charges);
+        m_names_   = std::move(names);
+        m_Zs_      = std::move(Zs);
+        m_mass_    = std::move(masses);
+    }
+
+    /// Implements reserve
+    void reserve(size_type n) {
+        m_charges_.reserve(n);
+        m_names_.reserve(n);
+        m_Zs_.reserve(n);
+        m_mass_.reserve(n);
+    }
+
+    /// Implements permute, assumes @p p has been checked
+    void permute(const permutation_type& p) {
+        auto names  = m_names_;
+        auto Zs     = m_Zs_;
+        auto masses = m_mass_;
+        apply_permutation(names, p);
+        apply_permutation(Zs, p);
+        apply_permutation(masses, p);
+        m_charges_.permute(p);
+        m_names_ = std::move(names);
+        m_Zs_    = std::move(Zs);
+        m_mass_  = std::move(masses);
+    }
+
+    /// Implements reorder
+    permutation_type reorder(SpaceFillingCurve curve) {
+        auto p = space_filling_curve_order(m_charges_.point_set(), curve);
+        permute(p);
+        return p;
+    }
+
+    /// Implements transform
+    void transform(const affine_type& f) noexcept { m_charges_.transform(f); }
+
     /// Implements push_back
     void push_back(value_type q) {
         m_names_.push_back(q.name());
@@ -15,6 +15,7 @@
  */
 
 #pragma once
+#include "../../detail_/gather.hpp"
 #include "nuclei_view_pimpl.hpp"
 
 namespace chemist::detail_ {
@@ -132,6 +133,18 @@ protected:
     /// Impelments size
     size_type size_() const noexcept override { return m_members_.size(); }
 
+    /// Lets the supersystem copy our members, in bulk
+    nuclei_type as_nuclei_() const override {
+        return m_nuclei_.as_nuclei(m_members_);
+    }
+
+    /// Maps @p members to the supersystem and lets it copy them
+    nuclei_type gather_(const member_list_type& members) const override {
+        member_list_type super_members(members.size());
+        gather(m_members_.data(), members, super_members.data());
+        return m_nuclei_.as_nuclei(super_members);
+    }
+
     /// Implements are_equal
     bool are_equal_(const base_type& rhs) const noexcept override {
         return base_type::template are_equal_impl_<NucleiSubset>(rhs);
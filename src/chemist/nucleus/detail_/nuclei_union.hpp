@@ -16,7 +16,9 @@
 
 #pragma once
 #include "nuclei_view_pimpl.hpp"
+#include <algorithm>
 #include <cassert>
+#include <vector>
 
 namespace chemist::detail_ {
 
@@ -29,6 +31,10 @@ namespace chemist::detail_ {
  *  if they were a single NucleiView object, but don't want to rearrange the
  *  underlying state.
  *
+ *  The views in the union can not change after construction, so *this
+ *  caches the offset of each view's first nucleus. Retrieving a nucleus is
+ *  then a binary search over the views and the size is a look up.
+ *
  *  @warning At present, the resulting union can contain duplicates. This is
  *           consistent with the Nuclei class itself which allows duplicates.
  */
@@ -70,10 +76,14 @@ public:
      *  @param[in] nuclei The aliased Nuclei objects to form the members of
      *                    *this.
      *
-     *  @throw None No throw guarantee.
+     *  @throw std::bad_alloc if there is a problem allocating the offsets.
+     *                        Strong throw guarantee.
      */
     explicit NucleiUnion(nuclei_view_container nuclei) :
-      m_nuclei_(std::move(nuclei)) {}
+      m_nuclei_(std::move(nuclei)), m_offsets_(m_nuclei_.size() + 1, 0) {
+        for(size_type j = 0; j < m_nuclei_.size(); ++j)
+            m_offsets_[j + 1] = m_offsets_[j] + m_nuclei_[j].size();
+    }
 
     /** @brief Creates a new view containing copies of the views in @p other.
      *
@@ -133,8 +143,18 @@ protected:
     }
 
 private:
+    /// Returns the index of the view holding nucleus @p i
+    size_type view_index_(size_type i) const noexcept {
+        // The first offset greater than i is one past the view holding i
+        auto itr = std::upper_bound(m_offsets_.begin(), m_offsets_.end(), i);
+        return (itr - m_offsets_.begin()) - 1;
+    }
+
     /// The actual nuclei
     nuclei_view_container m_nuclei_;
+
+    /// Element j is the index of m_nuclei_[j][0], last element is the size
+    std::vector<size_type> m_offsets_;
 };
 
 template<typename NucleiType>
@@ -152,33 +172,22 @@ bool NucleiUnion<NucleiType>::operator==(
 template<typename NucleiType>
 typename NucleiUnion<NucleiType>::reference NucleiUnion<NucleiType>::get_nuke_(
   size_type i) {
-    // Trying to return from the loop yields a compiler warning, about missing
-    // return type, so we move the return outside the loop.
-    size_type j = 0;
-    for(; j < m_nuclei_.size(); ++j) {
-        if(m_nuclei_[j].size() > i) break;
-        i -= m_nuclei_[j].size();
-    }
-    return m_nuclei_[j][i];
+    const auto j = view_index_(i);
+    return m_nuclei_[j][i - m_offsets_[j]];
 }
 
 template<typename NucleiType>
 typename NucleiUnion<NucleiType>::const_reference
 NucleiUnion<NucleiType>::get_nuke_(size_type i) const {
-    size_type j = 0;
-    for(; j < m_nuclei_.size(); ++j) {
-        if(m_nuclei_[j].size() > i) break;
-        i -= m_nuclei_[j].size();
-    }
-    return m_nuclei_[j][i];
+    const auto j = view_index_(i);
+    return m_nuclei_[j][i - m_offsets_[j]];
 }
 
 template<typename NucleiType>
 typename NucleiUnion<NucleiType>::size_type NucleiUnion<NucleiType>::size_()
   const noexcept {
-    size_type total_size = 0;
-    for(auto& nuclei_i : m_nuclei_) total_size += nuclei_i.size();
-    return total_size;
+    // Default constructed unions have no offsets
+    return m_offsets_.empty() ? 0 : m_offsets_.back();
 }
 
 } // namespace chemist::detail_
@@ -17,6 +17,8 @@
 #pragma once
 #include <cassert>
 #include <chemist/nucleus/nuclei_view.hpp>
+#include <numeric>
+#include <vector>
 
 namespace chemist::detail_ {
 
@@ -60,9 +62,18 @@ public:
     /// Class holding traits of the Nucleus objects
     using nucleus_traits = typename parent_type::nucleus_traits;
 
+    /// Type of a pointer to a nucleus's atomic number
+    using atomic_number_pointer = typename parent_type::atomic_number_pointer;
+
+    /// Type of a pointer to a nucleus's mass
+    using mass_pointer = typename parent_type::mass_pointer;
+
     /// Type nuclei_view_type uses for indexing
     using size_type = typename parent_type::size_type;
 
+    /// Type used to hold the indices of a subset of the nuclei
+    using member_list_type = typename parent_type::member_list_type;
+
     /// No-op because *this has no state
     NucleiViewPIMPL() noexcept = default;
 
@@ -137,6 +148,45 @@ public:
      */
     size_type size() const noexcept { return size_(); }
 
+    /** @brief Addresses of the first atomic number and the first mass.
+     *
+     *  These are implemented by atomic_number_data_ and mass_data_. Derived
+     *  classes only override them if the respective values are contiguous.
+     *
+     *  @return A pointer to the first value, or a null pointer if the values
+     *          are not contiguous.
+     *
+     *  @throw None No throw guarantee.
+     */
+    ///@{
+    atomic_number_pointer atomic_number_data() const noexcept {
+        return atomic_number_data_();
+    }
+    mass_pointer mass_data() const noexcept { return mass_data_(); }
+    ///@}
+
+    /** @brief Copies all, or the nuclei @p members, of *this into a Nuclei.
+     *
+     *  These are implemented by as_nuclei_ and gather_ respectively. The
+     *  default implementations copy the nuclei one at a time into columns,
+     *  which are then handed to the Nuclei object in bulk. Derived classes
+     *  with direct access to the columns should override them.
+     *
+     *  @param[in] members The indices of the nuclei to copy. Assumed to be
+     *                     in the range [0, size()).
+     *
+     *  @return A Nuclei object with a deep copy of the requested nuclei.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the return.
+     *                        Strong throw guarantee.
+     */
+    ///@{
+    nuclei_type as_nuclei() const { return as_nuclei_(); }
+    nuclei_type as_nuclei(const member_list_type& members) const {
+        return gather_(members);
+    }
+    ///@}
+
     /** @brief Polymorphic value equality.
      *
      *  This method will traverse the class hierarchy of *this ensuring that
@@ -163,6 +213,24 @@ protected:
     /// Derived class overrides to implement size
     virtual size_type size_() const noexcept = 0;
 
+    /// Derived class overrides if its atomic numbers are contiguous
+    virtual atomic_number_pointer atomic_number_data_() const noexcept {
+        return nullptr;
+    }
+
+    /// Derived class overrides if its masses are contiguous
+    virtual mass_pointer mass_data_() const noexcept { return nullptr; }
+
+    /// Derived class overrides if it can copy faster than gather_ can
+    virtual nuclei_type as_nuclei_() const {
+        member_list_type all(size_());
+        std::iota(all.begin(), all.end(), size_type{0});
+        return gather_(all);
+    }
+
+    /// Derived class overrides if it can copy faster than one at a time
+    virtual nuclei_type gather_(const member_list_type& members) const;
+
     /// Derived class overrides to implement are_equal
     virtual bool are_equal_(const NucleiViewPIMPL& rhs) const noexcept = 0;
 };
@@ -171,6 +239,33 @@ protected:
 // -- Out of line definitions
 // -----------------------------------------------------------------------------
 
+template<typename NucleiType>
+typename NucleiViewPIMPL<NucleiType>::nuclei_type
+NucleiViewPIMPL<NucleiType>::gather_(const member_list_type& members) const {
+    using charges_type = typename nuclei_type::charge_set_type;
+    using coord_type   = typename charges_type::coord_type;
+    using charge_type  = typename charges_type::charge_type;
+
+    const auto n = members.size();
+    std::vector<typename nuclei_type::name_type> names(n);
+    std::vector<typename nuclei_type::atomic_number_type> Zs(n);
+    std::vector<typename nuclei_type::mass_type> masses(n);
+    std::vector<coord_type> x(n), y(n), z(n);
+    std::vector<charge_type> qs(n);
+    for(size_type i = 0; i < n; ++i) {
+        const auto nuke = get_nuke_(members[i]);
+        names[i]        = nuke.name();
+        Zs[i]           = nuke.Z();
+        masses[i]       = nuke.mass();
+        x[i]            = nuke.x();
+        y[i]            = nuke.y();
+        z[i]            = nuke.z();
+        qs[i]           = nuke.charge();
+    }
+    return nuclei_type(charges_type(x, y, z, qs), std::move(names),
+                       std::move(Zs), std::move(masses));
+}
+
 template<typename NucleiType>
 template<typename DerivedType>
 bool NucleiViewPIMPL<NucleiType>::are_equal_impl_(
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chemist/nucleus/interned_name.hpp>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+namespace chemist {
+namespace {
+
+/// Hashes std::string and std::string_view alike, so lookups don't allocate
+struct NameHash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view name) const noexcept {
+        return std::hash<std::string_view>{}(name);
+    }
+};
+
+/** @brief The process-wide symbol table backing InternedName.
+ *
+ *  Elements of an std::unordered_set never move, so the addresses of the
+ *  entries can serve as the handles. Lookups of existing names, by far the
+ *  common case, only take a shared lock and are done with the caller's
+ *  std::string_view, i.e., without copying the name.
+ */
+struct NameTable {
+    std::shared_mutex mutex;
+    std::unordered_set<std::string, NameHash, std::equal_to<>> names;
+};
+
+/// The table is intentionally leaked so names outlive static destructors
+NameTable& table() {
+    static auto* ptable = new NameTable;
+    return *ptable;
+}
+
+/// The empty name is kept out of the table so making it can't allocate.
+/// Default constructing a std::string is constant initialization, so this
+/// is usable from other translation units' static initializers
+const std::string empty_name;
+
+const std::string* intern(std::string_view name) {
+    if(name.empty()) return &empty_name;
+    auto& t = table();
+    {
+        std::shared_lock lock(t.mutex);
+        auto itr = t.names.find(name);
+        if(itr != t.names.end()) return &*itr;
+    }
+    std::unique_lock lock(t.mutex);
+    return &*t.names.emplace(name).first;
+}
+
+} // namespace
+
+InternedName::InternedName() noexcept : m_pname_(&empty_name) {}
+
+InternedName::InternedName(std::string_view name) : m_pname_(intern(name)) {}
+
+typename InternedName::size_type InternedName::table_size() noexcept {
+    auto& t = table();
+    std::shared_lock lock(t.mutex);
+    return t.names.size();
+}
+
+} // namespace chemist
@@ -0,0 +1,292 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../point_charge/detail_/coulomb_kernel.hpp"
+#include <chemist/nucleus/nuclear_repulsion.hpp>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace chemist {
+namespace {
+
+using size_type = std::size_t;
+
+/// Number of nuclei below which threading costs more than it saves
+constexpr size_type parallel_threshold = 256;
+
+/// The point charge piece of some nuclei, stored as arrays
+struct NucleiArrays {
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+    std::vector<double> q;
+
+    size_type size() const noexcept { return q.size(); }
+
+    /// Appends @p nuclei, which are stored contiguously
+    void append(const Nuclei& nuclei) {
+        const auto charges = nuclei.charges();
+        const detail_::SoACharges<double> soa(charges);
+        const auto n       = soa.size();
+        const auto& points = soa.points();
+        x.insert(x.end(), points.x(), points.x() + n);
+        y.insert(y.end(), points.y(), points.y() + n);
+        z.insert(z.end(), points.z(), points.z() + n);
+        q.insert(q.end(), soa.q(), soa.q() + n);
+    }
+
+    /// Appends the nuclei aliased by @p nuclei, one nucleus at a time
+    template<typename NucleiType>
+    void append(const NucleiView<NucleiType>& nuclei) {
+        for(const auto& nuke : nuclei) {
+            x.push_back(nuke.x());
+            y.push_back(nuke.y());
+            z.push_back(nuke.z());
+            q.push_back(nuke.charge());
+        }
+    }
+};
+
+/** @brief The range of nuclei nucleus @p i interacts with.
+ *
+ *  For the total repulsion every nucleus interacts with every nucleus (the
+ *  kernels skip pairs at zero distance, which includes the nucleus itself).
+ *  For the interaction between fragments, nuclei [0, @p n_a) interact with
+ *  nuclei [@p n_a, @p n) and vice versa.
+ */
+template<bool Interaction>
+std::pair<size_type, size_type> partners_(size_type i, size_type n_a,
+                                          size_type n) noexcept {
+    if constexpr(Interaction) {
+        if(i < n_a) return {n_a, n};
+        return {0, n_a};
+    }
+    return {0, n};
+}
+
+template<bool Interaction>
+double energy_(const NucleiArrays& a, size_type n_a) {
+    const size_type n = a.size();
+    // For the total energy each pair is visited once, i.e., i < j
+    const size_type n_rows = Interaction ? n_a : n;
+    const double rc2       = std::numeric_limits<double>::infinity();
+    double e               = 0.0;
+
+#pragma omp parallel for reduction(+ : e) schedule(dynamic, 16) \
+  if(n >= parallel_threshold)
+    for(size_type i = 0; i < n_rows; ++i) {
+        const size_type j_begin = Interaction ? n_a : i + 1;
+        double v = 0.0, fx = 0.0, fy = 0.0, fz = 0.0;
+        detail_::coulomb_sum<false>(a.x[i], a.y[i], a.z[i], a.x.data(),
+                                    a.y.data(), a.z.data(), a.q.data(),
+                                    j_begin, n, rc2, 0.0, v, fx, fy, fz);
+        e += a.q[i] * v;
+    }
+    return e;
+}
+
+template<bool Interaction>
+std::vector<double> gradient_(const NucleiArrays& a, size_type n_a) {
+    const size_type n = a.size();
+    const double rc2  = std::numeric_limits<double>::infinity();
+    std::vector<double> rv(3 * n, 0.0);
+
+    // The gradient for nucleus i is -Q_i times the field of its partners
+#pragma omp parallel for schedule(static) if(n >= parallel_threshold)
+    for(size_type i = 0; i < n; ++i) {
+        const auto [j_begin, j_end] = partners_<Interaction>(i, n_a, n);
+        double v = 0.0, fx = 0.0, fy = 0.0, fz = 0.0;
+        detail_::coulomb_sum<true>(a.x[i], a.y[i], a.z[i], a.x.data(),
+                                   a.y.data(), a.z.data(), a.q.data(), j_begin,
+                                   j_end, rc2, 0.0, v, fx, fy, fz);
+        rv[3 * i]     = -a.q[i] * fx;
+        rv[3 * i + 1] = -a.q[i] * fy;
+        rv[3 * i + 2] = -a.q[i] * fz;
+    }
+    return rv;
+}
+
+template<bool Interaction>
+std::vector<double> hessian_(const NucleiArrays& a, size_type n_a) {
+    const size_type n  = a.size();
+    const size_type ld = 3 * n;
+    std::vector<double> rv(ld * ld, 0.0);
+    const double* const x = a.x.data();
+    const double* const y = a.y.data();
+    const double* const z = a.z.data();
+    const double* const q = a.q.data();
+
+    // Each thread writes the three rows of its nuclei. For i != j the block
+    // is -Q_iQ_j(3dd^T - r^2 I)/r^5 and the diagonal block is minus the sum
+    // of the off-diagonal blocks in its row (translational invariance).
+#pragma omp parallel for schedule(static) if(n >= parallel_threshold)
+    for(size_type i = 0; i < n; ++i) {
+        const auto [j_begin, j_end] = partners_<Interaction>(i, n_a, n);
+        double* const h0 = rv.data() + 3 * i * ld;
+        double* const h1 = h0 + ld;
+        double* const h2 = h1 + ld;
+        double xx = 0.0, xy = 0.0, xz = 0.0, yy = 0.0, yz = 0.0, zz = 0.0;
+#pragma omp simd reduction(+ : xx, xy, xz, yy, yz, zz)
+        for(size_type j = j_begin; j < j_end; ++j) {
+            const double dx   = x[i] - x[j];
+            const double dy   = y[i] - y[j];
+            const double dz   = z[i] - z[j];
+            const double r2   = dx * dx + dy * dy + dz * dz;
+            const bool use    = r2 > 0.0;
+            const double inv2 = 1.0 / (use ? r2 : 1.0);
+            const double inv  = std::sqrt(inv2);
+            const double c1   = use ? -q[i] * q[j] * inv * inv2 : 0.0;
+            const double c3   = 3.0 * c1 * inv2;
+            const double hxx  = c3 * dx * dx - c1;
+            const double hxy  = c3 * dx * dy;
+            const double hxz  = c3 * dx * dz;
+            const double hyy  = c3 * dy * dy - c1;
+            const double hyz  = c3 * dy * dz;
+            const double hzz  = c3 * dz * dz - c1;
+            h0[3 * j]         = hxx;
+            h0[3 * j + 1]     = hxy;
+            h0[3 * j + 2]     = hxz;
+            h1[3 * j]         = hxy;
+            h1[3 * j + 1]     = hyy;
+            h1[3 * j + 2]     = hyz;
+            h2[3 * j]         = hxz;
+            h2[3 * j + 1]     = hyz;
+            h2[3 * j + 2]     = hzz;
+            xx -= hxx;
+            xy -= hxy;
+            xz -= hxz;
+            yy -= hyy;
+            yz -= hyz;
+            zz -= hzz;
+        }
+        h0[3 * i]     = xx;
+        h0[3 * i + 1] = xy;
+        h0[3 * i + 2] = xz;
+        h1[3 * i]     = xy;
+        h1[3 * i + 1] = yy;
+        h1[3 * i + 2] = yz;
+        h2[3 * i]     = xz;
+        h2[3 * i + 1] = yz;
+        h2[3 * i + 2] = zz;
+    }
+    return rv;
+}
+
+/// Gathers @p nuclei into arrays
+template<typename NucleiType>
+NucleiArrays gather_(const NucleiType& nuclei) {
+    NucleiArrays rv;
+    rv.append(nuclei);
+    return rv;
+}
+
+/// Gathers @p lhs followed by @p rhs into arrays, also returns size of lhs
+template<typename LHSType, typename RHSType>
+std::pair<NucleiArrays, size_type> gather_(const LHSType& lhs,
+                                           const RHSType& rhs) {
+    NucleiArrays rv;
+    rv.append(lhs);
+    const size_type n_a = rv.size();
+    rv.append(rhs);
+    return {std::move(rv), n_a};
+}
+
+} // namespace
+
+// -- Nuclei overloads ---------------------------------------------------------
+
+double nuclear_repulsion_energy(const Nuclei& nuclei) {
+    return energy_<false>(gather_(nuclei), 0);
+}
+
+std::vector<double> nuclear_repulsion_gradient(const Nuclei& nuclei) {
+    return gradient_<false>(gather_(nuclei), 0);
+}
+
+std::vector<double> nuclear_repulsion_hessian(const Nuclei& nuclei) {
+    return hessian_<false>(gather_(nuclei), 0);
+}
+
+// -- NucleiView overloads -----------------------------------------------------
+
+template<typename NucleiType>
+double nuclear_repulsion_energy(const NucleiView<NucleiType>& nuclei) {
+    return energy_<false>(gather_(nuclei), 0);
+}
+
+template<typename NucleiType>
+std::vector<double> nuclear_repulsion_gradient(
+  const NucleiView<NucleiType>& nuclei) {
+    return gradient_<false>(gather_(nuclei), 0);
+}
+
+template<typename NucleiType>
+std::vector<double> nuclear_repulsion_hessian(
+  const NucleiView<NucleiType>& nuclei) {
+    return hessian_<false>(gather_(nuclei), 0);
+}
+
+// -- Interaction-only kernels -------------------------------------------------
+
+template<typename NucleiType1, typename NucleiType2>
+double nuclear_interaction_energy(const NucleiView<NucleiType1>& lhs,
+                                  const NucleiView<NucleiType2>& rhs) {
+    const auto [a, n_a] = gather_(lhs, rhs);
+    return energy_<true>(a, n_a);
+}
+
+template<typename NucleiType1, typename NucleiType2>
+std::vector<double> nuclear_interaction_gradient(
+  const NucleiView<NucleiType1>& lhs, const NucleiView<NucleiType2>& rhs) {
+    const auto [a, n_a] = gather_(lhs, rhs);
+    return gradient_<true>(a, n_a);
+}
+
+template<typename NucleiType1, typename NucleiType2>
+std::vector<double> nuclear_interaction_hessian(
+  const NucleiView<NucleiType1>& lhs, const NucleiView<NucleiType2>& rhs) {
+    const auto [a, n_a] = gather_(lhs, rhs);
+    return hessian_<true>(a, n_a);
+}
+
+#define INSTANTIATE_VIEW(NucleiType)                                          \
+    template double nuclear_repulsion_energy(const NucleiView<NucleiType>&);  \
+    template std::vector<double> nuclear_repulsion_gradient(                  \
+      const NucleiView<NucleiType>&);                                         \
+    template std::vector<double> nuclear_repulsion_hessian(                   \
+      const NucleiView<NucleiType>&)
+
+#define INSTANTIATE_INTERACTION(NucleiType1, NucleiType2)                     \
+    template double nuclear_interaction_energy(                               \
+      const NucleiView<NucleiType1>&, const NucleiView<NucleiType2>&);        \
+    template std::vector<double> nuclear_interaction_gradient(                \
+      const NucleiView<NucleiType1>&, const NucleiView<NucleiType2>&);        \
+    template std::vector<double> nuclear_interaction_hessian(                 \
+      const NucleiView<NucleiType1>&, const NucleiView<NucleiType2>&)
+
+INSTANTIATE_VIEW(Nuclei);
+INSTANTIATE_VIEW(const Nuclei);
+INSTANTIATE_INTERACTION(Nuclei, Nuclei);
+INSTANTIATE_INTERACTION(Nuclei, const Nuclei);
+INSTANTIATE_INTERACTION(const Nuclei, Nuclei);
+INSTANTIATE_INTERACTION(const Nuclei, const Nuclei);
+
+#undef INSTANTIATE_INTERACTION
+#undef INSTANTIATE_VIEW
+
+} // namespace chemist
@@ -29,6 +29,12 @@ Nuclei::Nuclei(std::initializer_list<value_type> qs) :
     for(const auto& x : qs) push_back(x);
 }
 
+Nuclei::Nuclei(charge_set_type charges, std::vector<name_type> names,
+               std::vector<atomic_number_type> Zs,
+               std::vector<mass_type> masses) :
+  m_pimpl_(std::make_unique<pimpl_type>(std::move(charges), std::move(names),
+                                        std::move(Zs), std::move(masses))) {}
+
 Nuclei::Nuclei(const Nuclei& other) :
   m_pimpl_(other.has_pimpl_() ? std::make_unique<pimpl_type>(*other.m_pimpl_) :
                                 nullptr) {}
@@ -51,6 +57,31 @@ void Nuclei::push_back(value_type q) {
     m_pimpl_->push_back(std::move(q));
 }
 
+void Nuclei::reserve(size_type n) {
+    if(!has_pimpl_()) m_pimpl_ = std::make_unique<pimpl_type>();
+    m_pimpl_->reserve(n);
+}
+
+void Nuclei::permute(const permutation_type& p) {
+    detail_::check_permutation(p, size());
+    if(has_pimpl_()) m_pimpl_->permute(p);
+}
+
+typename Nuclei::permutation_type Nuclei::reorder(SpaceFillingCurve curve) {
+    if(!has_pimpl_()) return permutation_type{};
+    return m_pimpl_->reorder(curve);
+}
+
+void Nuclei::transform(const affine_type& f) noexcept {
+    if(has_pimpl_()) m_pimpl_->transform(f);
+}
+
+Nuclei Nuclei::transformed(const affine_type& f) const {
+    Nuclei rv(*this);
+    rv.transform(f);
+    return rv;
+}
+
 typename Nuclei::charge_set_reference Nuclei::charges() {
     return has_pimpl_() ? m_pimpl_->as_charges() : charge_set_reference{};
 }
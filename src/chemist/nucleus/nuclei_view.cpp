@@ -19,7 +19,9 @@
 #include "detail_/nuclei_union.hpp"
 #include "detail_/nuclei_view_pimpl.hpp"
 #include "detail_/nucleus_view_list.hpp"
+#include "detail_/strided_nuclei_view.hpp"
 #include <numeric>
+#include <stdexcept>
 
 namespace chemist {
 
@@ -45,6 +47,13 @@ NUCLEI_VIEW::NucleiView(charges_reference charges, name_pointer pnames,
   NucleiView(std::make_unique<detail_::ContiguousNucleiView<NucleiType>>(
     charges, pnames, patomic_numbers, pmasses)) {}
 
+TPARAMS
+NUCLEI_VIEW::NucleiView(charges_reference charges, name_pointer pnames,
+                        atomic_number_pointer patomic_numbers,
+                        mass_pointer pmasses, size_type stride) :
+  NucleiView(std::make_unique<detail_::StridedNucleiView<NucleiType>>(
+    charges, pnames, patomic_numbers, pmasses, stride)) {}
+
 TPARAMS
 NUCLEI_VIEW::NucleiView(NucleiView supersystem, member_list_type members) :
   NucleiView(std::make_unique<detail_::NucleiSubset<NucleiType>>(
@@ -89,9 +98,23 @@ void NUCLEI_VIEW::swap(NucleiView& other) noexcept {
 
 TPARAMS
 typename NUCLEI_VIEW::nuclei_type NUCLEI_VIEW::as_nuclei() const {
-    nuclei_type rv;
-    for(const auto& ni : *this) rv.push_back(ni.as_nucleus());
-    return rv;
+    return this->empty() ? nuclei_type{} : m_pimpl_->as_nuclei();
+}
+
+TPARAMS
+typename NUCLEI_VIEW::nuclei_type NUCLEI_VIEW::as_nuclei(
+  const member_list_type& members) const {
+    for(auto i : members)
+        if(i >= this->size())
+            throw std::out_of_range("Members must be in the range [0, size())");
+    return members.empty() ? nuclei_type{} : m_pimpl_->as_nuclei(members);
+}
+
+TPARAMS
+bool NUCLEI_VIEW::is_contiguous() const noexcept {
+    if(this->empty()) return true;
+    return m_pimpl_->atomic_number_data() != nullptr &&
+           m_pimpl_->mass_data() != nullptr;
 }
 
 TPARAMS
@@ -140,6 +163,21 @@ bool NUCLEI_VIEW::has_pimpl_() const noexcept {
     return static_cast<bool>(m_pimpl_);
 }
 
+TPARAMS
+typename NUCLEI_VIEW::atomic_number_pointer
+NUCLEI_VIEW::atomic_number_column_data_() const {
+    if(!is_contiguous())
+        throw std::runtime_error("The aliased nuclei are not contiguous");
+    return this->empty() ? nullptr : m_pimpl_->atomic_number_data();
+}
+
+TPARAMS
+typename NUCLEI_VIEW::mass_pointer NUCLEI_VIEW::mass_column_data_() const {
+    if(!is_contiguous())
+        throw std::runtime_error("The aliased nuclei are not contiguous");
+    return this->empty() ? nullptr : m_pimpl_->mass_data();
+}
+
 #undef NUCLEI_VIEW
 #undef TPARAMS
 
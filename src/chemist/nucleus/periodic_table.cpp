@@ -0,0 +1,99 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chemist/nucleus/periodic_table.hpp>
+#include <utility>
+#include <vector>
+
+namespace chemist {
+namespace {
+
+using atomic_number_type = typename Element::atomic_number_type;
+
+/// Builds the Nuclei whose i-th nucleus is element @p get_element(i)
+template<typename FxnType>
+Nuclei make_nuclei_(std::size_t n, FxnType&& get_element,
+                    std::span<const double> x, std::span<const double> y,
+                    std::span<const double> z) {
+    using charge_type = typename Nuclei::charge_set_type::charge_type;
+
+    if(x.size() != n || y.size() != n || z.size() != n)
+        throw std::runtime_error("Must provide one element per coordinate");
+
+    std::vector<Nuclei::name_type> names;
+    std::vector<atomic_number_type> Zs;
+    std::vector<Nuclei::mass_type> masses;
+    std::vector<charge_type> qs;
+    names.reserve(n);
+    Zs.reserve(n);
+    masses.reserve(n);
+    qs.reserve(n);
+    for(std::size_t i = 0; i < n; ++i) {
+        const Element& e = get_element(i);
+        names.emplace_back(e.symbol);
+        Zs.push_back(e.Z);
+        masses.push_back(e.mass_au());
+        qs.push_back(charge_type(e.Z));
+    }
+
+    typename Nuclei::charge_set_type charges(x, y, z, qs);
+    return Nuclei(std::move(charges), std::move(names), std::move(Zs),
+                  std::move(masses));
+}
+
+template<typename StringType>
+Nuclei make_nuclei_(std::span<const StringType> symbols,
+                    std::span<const double> x, std::span<const double> y,
+                    std::span<const double> z) {
+    auto get_element = [&](std::size_t i) -> const Element& {
+        return element(std::string_view(symbols[i]));
+    };
+    return make_nuclei_(symbols.size(), get_element, x, y, z);
+}
+
+} // namespace
+
+Nucleus make_nucleus(atomic_number_type Z, double x, double y, double z) {
+    const auto& e = element(Z);
+    return Nucleus(e.symbol, e.Z, e.mass_au(), x, y, z);
+}
+
+Nucleus make_nucleus(std::string_view symbol, double x, double y, double z) {
+    return make_nucleus(atomic_number(symbol), x, y, z);
+}
+
+Nuclei make_nuclei(std::span<const atomic_number_type> Zs,
+                   std::span<const double> x, std::span<const double> y,
+                   std::span<const double> z) {
+    auto get_element = [&](std::size_t i) -> const Element& {
+        return element(Zs[i]);
+    };
+    return make_nuclei_(Zs.size(), get_element, x, y, z);
+}
+
+Nuclei make_nuclei(std::span<const std::string_view> symbols,
+                   std::span<const double> x, std::span<const double> y,
+                   std::span<const double> z) {
+    return make_nuclei_(symbols, x, y, z);
+}
+
+Nuclei make_nuclei(std::span<const std::string> symbols,
+                   std::span<const double> x, std::span<const double> y,
+                   std::span<const double> z) {
+    return make_nuclei_(symbols, x, y, z);
+}
+
+} // namespace chemist
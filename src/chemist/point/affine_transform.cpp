@@ -0,0 +1,163 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chemist/point/affine_transform.hpp>
+#include <cmath>
+#include <stdexcept>
+
+namespace chemist {
+namespace {
+
+/// Number of points below which threading costs more than it saves
+constexpr std::size_t parallel_threshold = std::size_t(1) << 15;
+
+} // namespace
+
+#define TPARAMS template<typename T>
+#define AFFINE_TRANSFORM AffineTransform<T>
+
+// -- Ctors --------------------------------------------------------------------
+
+TPARAMS
+AFFINE_TRANSFORM::AffineTransform() noexcept :
+  AffineTransform({1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0},
+                  {0.0, 0.0, 0.0}) {}
+
+TPARAMS
+AFFINE_TRANSFORM::AffineTransform(matrix_type A, vector_type t) noexcept :
+  m_A_(A), m_t_(t) {}
+
+TPARAMS
+AFFINE_TRANSFORM AFFINE_TRANSFORM::translation(vector_type t) noexcept {
+    return AffineTransform(AffineTransform().linear_part(), t);
+}
+
+TPARAMS
+AFFINE_TRANSFORM AFFINE_TRANSFORM::rotation(matrix_type R) noexcept {
+    return AffineTransform(R, {0.0, 0.0, 0.0});
+}
+
+TPARAMS
+AFFINE_TRANSFORM AFFINE_TRANSFORM::rotation_about(vector_type axis,
+                                                  coord_type angle) {
+    const auto norm =
+      std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    if(norm == coord_type(0.0))
+        throw std::runtime_error("Rotation axis can not be the zero vector");
+
+    // Rodrigues' formula: R = cI + s[k]_x + (1 - c)kk^T
+    const coord_type kx = axis[0] / norm;
+    const coord_type ky = axis[1] / norm;
+    const coord_type kz = axis[2] / norm;
+    const coord_type c  = std::cos(angle);
+    const coord_type s  = std::sin(angle);
+    const coord_type v  = coord_type(1.0) - c;
+
+    const coord_type vx = v * kx;
+    const coord_type vy = v * ky;
+    const coord_type vz = v * kz;
+
+    return rotation({c + vx * kx, vx * ky - s * kz, vx * kz + s * ky,
+                     vy * kx + s * kz, c + vy * ky, vy * kz - s * kx,
+                     vz * kx - s * ky, vz * ky + s * kx, c + vz * kz});
+}
+
+// -- Accessors ----------------------------------------------------------------
+
+TPARAMS
+bool AFFINE_TRANSFORM::is_translation() const noexcept {
+    return m_A_ == AffineTransform().linear_part();
+}
+
+// -- Applying the transformation ----------------------------------------------
+
+TPARAMS
+typename AFFINE_TRANSFORM::point_type AFFINE_TRANSFORM::operator()(
+  const point_type& r) const {
+    point_type rv;
+    apply(1, &r.x(), &r.y(), &r.z(), &rv.x(), &rv.y(), &rv.z());
+    return rv;
+}
+
+TPARAMS
+void AFFINE_TRANSFORM::apply(size_type n, const_coord_pointer x,
+                             const_coord_pointer y, const_coord_pointer z,
+                             coord_pointer ox, coord_pointer oy,
+                             coord_pointer oz) const noexcept {
+    // Copy the parameters into locals so the compiler can keep them in
+    // registers (the output arrays could, as far as it knows, alias *this)
+    const coord_type tx = m_t_[0];
+    const coord_type ty = m_t_[1];
+    const coord_type tz = m_t_[2];
+
+    if(is_translation()) {
+#pragma omp parallel for simd schedule(static) if(n >= parallel_threshold)
+        for(size_type i = 0; i < n; ++i) {
+            ox[i] = x[i] + tx;
+            oy[i] = y[i] + ty;
+            oz[i] = z[i] + tz;
+        }
+        return;
+    }
+
+    const coord_type a00 = m_A_[0], a01 = m_A_[1], a02 = m_A_[2];
+    const coord_type a10 = m_A_[3], a11 = m_A_[4], a12 = m_A_[5];
+    const coord_type a20 = m_A_[6], a21 = m_A_[7], a22 = m_A_[8];
+
+    // Each iteration reads all three coordinates before writing any of them,
+    // so the loop is also correct when transforming in place
+#pragma omp parallel for simd schedule(static) if(n >= parallel_threshold)
+    for(size_type i = 0; i < n; ++i) {
+        const coord_type xi = x[i];
+        const coord_type yi = y[i];
+        const coord_type zi = z[i];
+        ox[i]               = a00 * xi + a01 * yi + a02 * zi + tx;
+        oy[i]               = a10 * xi + a11 * yi + a12 * zi + ty;
+        oz[i]               = a20 * xi + a21 * yi + a22 * zi + tz;
+    }
+}
+
+// -- Utility methods ----------------------------------------------------------
+
+TPARAMS
+AFFINE_TRANSFORM AFFINE_TRANSFORM::operator*(
+  const AffineTransform& rhs) const noexcept {
+    // (A1, t1) * (A2, t2) = (A1 A2, A1 t2 + t1)
+    matrix_type A{};
+    vector_type t{};
+    const auto& B = rhs.m_A_;
+    for(size_type i = 0; i < 3; ++i) {
+        for(size_type j = 0; j < 3; ++j)
+            for(size_type k = 0; k < 3; ++k)
+                A[i * 3 + j] += m_A_[i * 3 + k] * B[k * 3 + j];
+        t[i] = m_t_[i];
+        for(size_type k = 0; k < 3; ++k) t[i] += m_A_[i * 3 + k] * rhs.m_t_[k];
+    }
+    return AffineTransform(A, t);
+}
+
+TPARAMS
+bool AFFINE_TRANSFORM::operator==(const AffineTransform& rhs) const noexcept {
+    return m_A_ == rhs.m_A_ && m_t_ == rhs.m_t_;
+}
+
+#undef AFFINE_TRANSFORM
+#undef TPARAMS
+
+template class AffineTransform<float>;
+template class AffineTransform<double>;
+
+} // namespace chemist
@@ -21,6 +21,7 @@
  *  thus the API of the PointPIMPL class is subject to change at any time.
  */
 #pragma once
+#include "../../detail_/free_list_pool.hpp"
 #include "chemist/point/point.hpp"
 #include <array>
 #include <stdexcept>
@@ -35,6 +36,13 @@ namespace chemist::detail_ {
  *  This class is responsible for holding the Point class's state and decoupling
  *  the storage mechanism from the Point class's API.
  *
+ *  Point objects are created in very large numbers (often as temporaries), so
+ *  PointPIMPL objects are allocated from a thread-local FreeListPool rather
+ *  than directly from the global allocator. In the steady state creating and
+ *  destroying a Point thus performs no heap allocation, while the PIMPL still
+ *  lives at a fixed address (which is what allows moves to preserve
+ *  references to a Point's coordinates).
+ *
  *  @tparam T The type used for holding the point's coordinates. Assumed to be
  *            a non-cv qualified POD of floating-point variety.
  */
@@ -171,6 +179,19 @@ public:
      */
     const_reference coord(size_type i) const;
 
+    /// Allocation goes through the pool (see class description)
+    ///@{
+    static void* operator new(std::size_t n) {
+        if(n != sizeof(PointPIMPL)) return ::operator new(n);
+        return FreeListPool<sizeof(PointPIMPL)>::allocate();
+    }
+
+    static void operator delete(void* p, std::size_t n) noexcept {
+        if(n != sizeof(PointPIMPL)) return ::operator delete(p);
+        FreeListPool<sizeof(PointPIMPL)>::deallocate(p);
+    }
+    ///@}
+
 private:
     /// Encapsulates throwing if the bounds check fails
     void check_index_(size_type i) const;
@@ -50,6 +50,9 @@ public:
     /// Type of a pointer to PIMPL's API
     using typename base_type::pimpl_pointer;
 
+    /// Type of a pointer to a read-only PIMPL
+    using typename base_type::const_pimpl_pointer;
+
     /** @brief Creates an empty PointSet.
      *
      *  The object resulting from this ctor is capable of implementing an
@@ -105,6 +108,13 @@ protected:
         return std::make_unique<my_type>(*this);
     }
 
+    const_pimpl_pointer as_const_() const override {
+        using point_set_type   = typename base_type::point_set_type;
+        using const_pimpl_type = PointSetContiguous<const point_set_type>;
+        return std::make_unique<const_pimpl_type>(m_n_points_, m_px_, m_py_,
+                                                  m_pz_);
+    }
+
     size_type size_() const noexcept override { return m_n_points_; }
 
     reference at_(size_type i) override {
@@ -115,6 +125,10 @@ protected:
         return const_reference(m_px_[i], m_py_[i], m_pz_[i]);
     }
 
+    coord_pointer coord_data_(size_type xyz) const noexcept override {
+        return xyz == 0 ? m_px_ : (xyz == 1 ? m_py_ : m_pz_);
+    }
+
 private:
     /// The number of points in *this
     size_type m_n_points_ = 0;
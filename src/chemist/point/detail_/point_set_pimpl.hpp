@@ -15,12 +15,20 @@
  */
 
 #pragma once
+#include <chemist/detail_/aligned_array.hpp>
+#include <chemist/detail_/permutation.hpp>
 #include <chemist/point/point_set.hpp>
-#include <vector>
+#include <memory>
+#include <span>
+#include <stdexcept>
 
 namespace chemist::detail_ {
 
 /** @brief Implements a PointSet<T> instance.
+ *
+ *  The coordinates are stored as three AlignedArray objects, so each
+ *  coordinate array starts on a `simd_alignment` byte boundary and is
+ *  zero-padded out to a whole number of SIMD registers.
  *
  *  @tparam T The type used for the Point's coordinates. Assumed to be either
  *            double or float.
@@ -40,8 +48,46 @@ public:
     using coord_pointer       = typename parent_type::coord_pointer;
     using const_coord_pointer = typename parent_type::const_coord_pointer;
     using size_type           = typename parent_type::size_type;
+    using coord_type          = typename parent_type::coord_type;
     ///@}
 
+    /// Alignment, in bytes, of the coordinate arrays
+    static constexpr size_type alignment = simd_alignment;
+
+    /// Creates an empty PointSet
+    PointSetPIMPL() = default;
+
+    /// Implements creating a PointSet from arrays of coordinates
+    PointSetPIMPL(std::span<const coord_type> x, std::span<const coord_type> y,
+                  std::span<const coord_type> z) :
+      m_x_(x), m_y_(y), m_z_(z) {
+        if(x.size() == y.size() && x.size() == z.size()) return;
+        throw std::runtime_error("x, y, and z must be the same length");
+    }
+
+    /// Implements converting @p n points stored as @p U to @p T
+    template<typename U>
+    PointSetPIMPL(size_type n, const U* x, const U* y, const U* z) :
+      m_x_(x, x + n), m_y_(y, y + n), m_z_(z, z + n) {}
+
+    /// Implements PointSet<T>::reserve
+    void reserve(size_type n) {
+        m_x_.reserve(n);
+        m_y_.reserve(n);
+        m_z_.reserve(n);
+    }
+
+    /// Implements PointSet<T>::permute, assumes @p p has been checked
+    void permute(const permutation_type& p) {
+        array_type x(m_x_), y(m_y_), z(m_z_);
+        apply_permutation(x, p);
+        apply_permutation(y, p);
+        apply_permutation(z, p);
+        m_x_ = std::move(x);
+        m_y_ = std::move(y);
+        m_z_ = std::move(z);
+    }
+
     /// Implements adding a Point<T> to the PointSet<T>
     void push_back(value_type point) {
         m_x_.push_back(point.x());
@@ -51,41 +97,50 @@ public:
 
     /// Implements retrieving a read/write reference to a Point<T>
     reference operator[](size_type i) {
-        return reference(m_x_.at(i), m_y_.at(i), m_z_.at(i));
+        return reference(m_x_[i], m_y_[i], m_z_[i]);
     }
 
     /// Implements retrieving a read-only reference to a Point<T>
     const_reference operator[](size_type i) const {
-        return const_reference(m_x_.at(i), m_y_.at(i), m_z_.at(i));
+        return const_reference(m_x_[i], m_y_[i], m_z_[i]);
     }
 
     coord_pointer x_data() noexcept {
-        return size() != 0 ? m_x_.data() : nullptr;
+        return size() != 0 ? std::assume_aligned<alignment>(m_x_.data()) :
+                             nullptr;
     }
 
     const_coord_pointer x_data() const noexcept {
-        return size() != 0 ? m_x_.data() : nullptr;
+        return size() != 0 ? std::assume_aligned<alignment>(m_x_.data()) :
+                             nullptr;
     }
 
     coord_pointer y_data() noexcept {
-        return size() != 0 ? m_y_.data() : nullptr;
+        return size() != 0 ? std::assume_aligned<alignment>(m_y_.data()) :
+                             nullptr;
     }
 
     const_coord_pointer y_data() const noexcept {
-        return size() != 0 ? m_y_.data() : nullptr;
+        return size() != 0 ? std::assume_aligned<alignment>(m_y_.data()) :
+                             nullptr;
     }
 
     coord_pointer z_data() noexcept {
-        return size() != 0 ? m_z_.data() : nullptr;
+        return size() != 0 ? std::assume_aligned<alignment>(m_z_.data()) :
+                             nullptr;
     }
 
     const_coord_pointer z_data() const noexcept {
-        return size() != 0 ? m_z_.data() : nullptr;
+        return size() != 0 ? std::assume_aligned<alignment>(m_z_.data()) :
+                             nullptr;
     }
 
     /// Implements PointSet<T>::size()
     size_type size() const noexcept { return m_x_.size(); }
 
+    /// Implements PointSet<T>::padded_size()
+    size_type padded_size() const noexcept { return m_x_.padded_size(); }
+
     /// Implements most of PointSet<T>::operator==
     bool operator==(const PointSetPIMPL<T>& rhs) const noexcept {
         return std::tie(m_x_, m_y_, m_z_) ==
@@ -93,17 +148,17 @@ public:
     }
 
 private:
-    /// Type of coordinate, should be T, but from Point<T> for consistency
-    using coord_type = typename value_type::coord_type;
+    /// Type used to store a column of coordinates
+    using array_type = AlignedArray<coord_type>;
 
     /// All the x-coordinates
-    std::vector<coord_type> m_x_;
+    array_type m_x_;
 
     /// All the y-coordinates
-    std::vector<coord_type> m_y_;
+    array_type m_y_;
 
     /// All the z-coordinates
-    std::vector<coord_type> m_z_;
+    array_type m_z_;
 };
 
 } // namespace chemist::detail_
@@ -0,0 +1,219 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "../../detail_/strided_pointer.hpp"
+#include "point_set_view_pimpl.hpp"
+#include <memory>
+#include <tuple>
+#include <vector>
+
+namespace chemist::detail_ {
+
+/** @brief Implements a PointSetView by holding pointers to strided memory.
+ *
+ *  This PIMPL is used to alias coordinates which live in someone else's
+ *  buffer, but which are not stored as three contiguous arrays. The typical
+ *  example is an array-of-structures (AoS) layout, e.g., an interleaved
+ *  `x0, y0, z0, x1, y1, z1, ...` buffer or an array of structs with `x`, `y`,
+ *  and `z` members. For such buffers the i-th x-coordinate lives
+ *  `i * stride` bytes past the 0-th x-coordinate (and similarly for y and z).
+ *
+ *  @tparam PointSetType Type *this is a view of.
+ */
+template<typename PointSetType>
+class PointSetStrided : public PointSetViewPIMPL<PointSetType> {
+private:
+    /// Type *this derives from
+    using base_type = PointSetViewPIMPL<PointSetType>;
+
+    /// Type of *this
+    using my_type = PointSetStrided<PointSetType>;
+
+public:
+    /// Type of a pointer to a coordinate
+    using coord_pointer = typename base_type::point_traits_type::coord_pointer;
+
+    /// Type used for indexing and offsets
+    using typename base_type::size_type;
+
+    /// Type of the owning container *this can be copied to
+    using typename base_type::point_set_type;
+
+    /// Type of a coordinate, without cv-qualifiers
+    using typename base_type::coord_type;
+
+    /// Type used for a mutable reference to a Point
+    using typename base_type::reference;
+
+    /// Type used for a read-only reference to a Point
+    using typename base_type::const_reference;
+
+    /// Type of a pointer to PIMPL's API
+    using typename base_type::pimpl_pointer;
+
+    /// Type of a pointer to a read-only PIMPL
+    using typename base_type::const_pimpl_pointer;
+
+    /** @brief Creates an empty PointSet.
+     *
+     *  The object resulting from this ctor is capable of implementing an
+     *  empty PointSet.
+     *
+     *  @throw None No throw guarantee.
+     */
+    PointSetStrided() = default;
+
+    /** @brief Creates a PointSet which aliases @p n_points strided points.
+     *
+     *  @param[in] n_points The number of points to be managed by *this.
+     *  @param[in] px A pointer to the x-coordinate of the 0-th point.
+     *  @param[in] py A pointer to the y-coordinate of the 0-th point.
+     *  @param[in] pz A pointer to the z-coordinate of the 0-th point.
+     *  @param[in] stride The distance, in bytes, between the i-th and the
+     *                    (i+1)-th value of each coordinate, i.e., the
+     *                    x-coordinate of the i-th point is assumed to be at
+     *                    address `(char*)px + i * stride`.
+     *
+     *  @throw None No throw guarantee.
+     */
+    PointSetStrided(size_type n_points, coord_pointer px, coord_pointer py,
+                    coord_pointer pz, size_type stride) :
+      m_n_points_(n_points),
+      m_px_(px),
+      m_py_(py),
+      m_pz_(pz),
+      m_stride_(stride) {}
+
+    /** @brief Makes a shallow copy of another PointSetStrided
+     *
+     *  @param[in] other The instance to copy.
+     *
+     *  @throw None No throw guarantee.
+     */
+    PointSetStrided(const PointSetStrided& other) = default;
+
+    /// Defaulted no throw dtor
+    ~PointSetStrided() noexcept = default;
+
+    /** @brief Compares for equality.
+     *
+     *  Like PointSetContiguous::operator== this compares the aliased points,
+     *  not whether the views alias the same memory. If both objects alias the
+     *  same addresses with the same stride the comparison is O(1); if both
+     *  are actually contiguous the values are compared with std::equal.
+     */
+    bool operator==(const PointSetStrided& rhs) const noexcept;
+
+protected:
+    bool are_equal_(const base_type& other) const noexcept override {
+        return base_type::template are_equal_impl_<my_type>(other);
+    }
+
+    pimpl_pointer clone_() const override {
+        return std::make_unique<my_type>(*this);
+    }
+
+    const_pimpl_pointer as_const_() const override {
+        using const_pimpl_type = PointSetStrided<const point_set_type>;
+        return std::make_unique<const_pimpl_type>(m_n_points_, m_px_, m_py_,
+                                                  m_pz_, m_stride_);
+    }
+
+    size_type size_() const noexcept override { return m_n_points_; }
+
+    reference at_(size_type i) override {
+        return reference(*x_(i), *y_(i), *z_(i));
+    }
+
+    const_reference at_(size_type i) const override {
+        return const_reference(*x_(i), *y_(i), *z_(i));
+    }
+
+    /// A stride of one coordinate means the columns are contiguous after all
+    coord_pointer coord_data_(size_type xyz) const noexcept override {
+        if(m_stride_ != sizeof(*m_px_)) return nullptr;
+        return xyz == 0 ? m_px_ : (xyz == 1 ? m_py_ : m_pz_);
+    }
+
+    /// Copies the columns out of the strided arrays
+    point_set_type as_point_set_() const override {
+        std::vector<coord_type> x(m_n_points_), y(m_n_points_), z(m_n_points_);
+        strided_copy(m_px_, m_stride_, m_n_points_, x.data());
+        strided_copy(m_py_, m_stride_, m_n_points_, y.data());
+        strided_copy(m_pz_, m_stride_, m_n_points_, z.data());
+        return point_set_type(x, y, z);
+    }
+
+private:
+    /// Addresses of the i-th point's coordinates
+    ///@{
+    coord_pointer x_(size_type i) const noexcept {
+        return strided_pointer(m_px_, i, m_stride_);
+    }
+    coord_pointer y_(size_type i) const noexcept {
+        return strided_pointer(m_py_, i, m_stride_);
+    }
+    coord_pointer z_(size_type i) const noexcept {
+        return strided_pointer(m_pz_, i, m_stride_);
+    }
+    ///@}
+
+    /// The number of points in *this
+    size_type m_n_points_ = 0;
+
+    /// The address of the first point's x-coordinate
+    coord_pointer m_px_ = nullptr;
+
+    /// The address of the first point's y-coordinate
+    coord_pointer m_py_ = nullptr;
+
+    /// The address of the first point's z-coordinate
+    coord_pointer m_pz_ = nullptr;
+
+    /// The distance, in bytes, between consecutive points
+    size_type m_stride_ = 0;
+};
+
+// -----------------------------------------------------------------------------
+// -- Out of line implementations
+// -----------------------------------------------------------------------------
+
+template<typename PointSetType>
+bool PointSetStrided<PointSetType>::operator==(
+  const PointSetStrided& rhs) const noexcept {
+    // Must have the same number of points to be equal
+    if(m_n_points_ != rhs.m_n_points_) return false;
+
+    // If there's zero points the addresses may be junk and we don't want to
+    // compare them, so short circuit if empty
+    if(m_n_points_ == 0) return true;
+
+    // Try to short circuit if the addresses and layout are the same
+    const auto plhs = std::tie(m_px_, m_py_, m_pz_, m_stride_);
+    const auto prhs = std::tie(rhs.m_px_, rhs.m_py_, rhs.m_pz_, rhs.m_stride_);
+    if(plhs == prhs) return true;
+
+    // Now we have to actually compare the values
+    const auto n = m_n_points_;
+    const auto s = m_stride_;
+    const auto t = rhs.m_stride_;
+    return strided_equal(m_px_, s, rhs.m_px_, t, n) &&
+           strided_equal(m_py_, s, rhs.m_py_, t, n) &&
+           strided_equal(m_pz_, s, rhs.m_pz_, t, n);
+}
+
+} // namespace chemist::detail_
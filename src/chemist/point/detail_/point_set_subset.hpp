@@ -0,0 +1,168 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "../../detail_/gather.hpp"
+#include "point_set_view_pimpl.hpp"
+#include <memory>
+#include <vector>
+
+namespace chemist::detail_ {
+
+/** @brief Implements a PointSetView that is a subset of another PointSet.
+ *
+ *  This PIMPL stores a view of the supersystem and the indices of the points
+ *  in *this. The indices need not be sorted, so this PIMPL can also be used
+ *  to present the points of the supersystem in a different order, e.g., to
+ *  present a PointSet which was sorted along a space-filling curve in its
+ *  original order.
+ *
+ *  @tparam PointSetType Type *this is a view of.
+ */
+template<typename PointSetType>
+class PointSetSubset : public PointSetViewPIMPL<PointSetType> {
+private:
+    /// Type *this derives from
+    using base_type = PointSetViewPIMPL<PointSetType>;
+
+    /// Type of *this
+    using my_type = PointSetSubset<PointSetType>;
+
+public:
+    /// The type *this is implementing
+    using typename base_type::parent_type;
+
+    /// Type used for indexing and offsets
+    using typename base_type::size_type;
+
+    /// Type of the owning container *this can be copied to
+    using typename base_type::point_set_type;
+
+    /// Type of a coordinate, without cv-qualifiers
+    using typename base_type::coord_type;
+
+    /// Type used for a mutable reference to a Point
+    using typename base_type::reference;
+
+    /// Type used for a read-only reference to a Point
+    using typename base_type::const_reference;
+
+    /// Type of a pointer to PIMPL's API
+    using typename base_type::pimpl_pointer;
+
+    /// Type of a pointer to a read-only PIMPL
+    using typename base_type::const_pimpl_pointer;
+
+    /// Type used to hold the indices of the points in *this
+    using member_list_type = typename parent_type::member_list_type;
+
+    /// Makes a null subset
+    PointSetSubset() = default;
+
+    /** @brief Creates a view which is a subset of @p supersystem
+     *
+     *  @param[in] supersystem A view which aliases the supersystem.
+     *  @param[in] members Which points in @p supersystem should be included in
+     *                     the subset. Values in @p members should be in the
+     *                     range [0, supersystem.size()).
+     *
+     *  @throw None No throw guarantee.
+     */
+    PointSetSubset(parent_type supersystem, member_list_type members) :
+      m_points_(std::move(supersystem)), m_members_(std::move(members)) {}
+
+    /** @brief Makes a shallow copy of another PointSetSubset
+     *
+     *  The indices are deep copied, but the supersystem is aliased.
+     *
+     *  @param[in] other The instance to copy.
+     *
+     *  @throw std::bad_alloc if there is a problem copying the indices. Strong
+     *                        throw guarantee.
+     */
+    PointSetSubset(const PointSetSubset& other) = default;
+
+    /// Defaulted no throw dtor
+    ~PointSetSubset() noexcept = default;
+
+    /** @brief Compares for equality.
+     *
+     *  Like the other PIMPLs this compares the aliased points. They are
+     *  compared one by one, even if the supersystems are the same, because
+     *  different indices may select equal points.
+     */
+    bool operator==(const PointSetSubset& rhs) const noexcept;
+
+protected:
+    bool are_equal_(const base_type& other) const noexcept override {
+        return base_type::template are_equal_impl_<my_type>(other);
+    }
+
+    pimpl_pointer clone_() const override {
+        return std::make_unique<my_type>(*this);
+    }
+
+    const_pimpl_pointer as_const_() const override {
+        using const_view_type  = PointSetView<const point_set_type>;
+        using const_pimpl_type = PointSetSubset<const point_set_type>;
+        return std::make_unique<const_pimpl_type>(const_view_type(m_points_),
+                                                  m_members_);
+    }
+
+    size_type size_() const noexcept override { return m_members_.size(); }
+
+    reference at_(size_type i) override { return m_points_[m_members_[i]]; }
+
+    const_reference at_(size_type i) const override {
+        return m_points_[m_members_[i]];
+    }
+
+    /// Gathers the members straight from the supersystem's columns if it can
+    point_set_type as_point_set_() const override {
+        if(m_points_.empty() || !m_points_.is_contiguous())
+            return base_type::as_point_set_();
+
+        const auto n = m_members_.size();
+        std::vector<coord_type> x(n), y(n), z(n);
+        gather(m_points_.x_column().data(), m_members_, x.data());
+        gather(m_points_.y_column().data(), m_members_, y.data());
+        gather(m_points_.z_column().data(), m_members_, z.data());
+        return point_set_type(x, y, z);
+    }
+
+private:
+    /// The supersystem
+    parent_type m_points_;
+
+    /// The indices in *this
+    member_list_type m_members_;
+};
+
+// -----------------------------------------------------------------------------
+// -- Out of line implementations
+// -----------------------------------------------------------------------------
+
+template<typename PointSetType>
+bool PointSetSubset<PointSetType>::operator==(
+  const PointSetSubset& rhs) const noexcept {
+    if(this->size() != rhs.size()) return false;
+    for(size_type i = 0; i < this->size(); ++i)
+        if((*this)[i] != rhs[i]) return false;
+
+    return true;
+}
+
+} // namespace chemist::detail_
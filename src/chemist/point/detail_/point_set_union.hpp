@@ -0,0 +1,210 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "point_set_view_pimpl.hpp"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace chemist::detail_ {
+
+/** @brief Implements a PointSetView that is a union of PointSetView objects.
+ *
+ *  This PIMPL is the PointSet analog of NucleiUnion. It allows one or more
+ *  PointSetView objects to be used as a single PointSetView, without copying
+ *  the aliased points. The views in the union can not change after
+ *  construction, so *this caches the offset of each view's first point and
+ *  retrieving a point is a binary search over the views.
+ *
+ *  @warning Like NucleiUnion, the resulting union can contain duplicates.
+ *
+ *  @tparam PointSetType Type *this is a view of.
+ */
+template<typename PointSetType>
+class PointSetUnion : public PointSetViewPIMPL<PointSetType> {
+private:
+    /// Type *this derives from
+    using base_type = PointSetViewPIMPL<PointSetType>;
+
+    /// Type of *this
+    using my_type = PointSetUnion<PointSetType>;
+
+public:
+    /// The type *this is implementing
+    using typename base_type::parent_type;
+
+    /// Type used for indexing and offsets
+    using typename base_type::size_type;
+
+    /// Type of the owning container *this can be copied to
+    using typename base_type::point_set_type;
+
+    /// Type of a coordinate, without cv-qualifiers
+    using typename base_type::coord_type;
+
+    /// Type used for a mutable reference to a Point
+    using typename base_type::reference;
+
+    /// Type used for a read-only reference to a Point
+    using typename base_type::const_reference;
+
+    /// Type of a pointer to PIMPL's API
+    using typename base_type::pimpl_pointer;
+
+    /// Type of a pointer to a read-only PIMPL
+    using typename base_type::const_pimpl_pointer;
+
+    /// Type of a container filled with PointSetView objects
+    using point_set_view_container =
+      typename parent_type::point_set_view_container;
+
+    /// Makes an empty union
+    PointSetUnion() = default;
+
+    /** @brief Aliases the union of the PointSet objects aliased by @p points.
+     *
+     *  The i-th point of *this is the i-th point of the views in @p points,
+     *  taken in order.
+     *
+     *  @param[in] points The aliased PointSet objects to form the members of
+     *                    *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the offsets.
+     *                        Strong throw guarantee.
+     */
+    explicit PointSetUnion(point_set_view_container points) :
+      m_points_(std::move(points)), m_offsets_(m_points_.size() + 1, 0) {
+        for(size_type j = 0; j < m_points_.size(); ++j)
+            m_offsets_[j + 1] = m_offsets_[j] + m_points_[j].size();
+    }
+
+    /** @brief Makes a shallow copy of another PointSetUnion
+     *
+     *  The views are copied, but continue to alias the same points.
+     *
+     *  @param[in] other The instance to copy.
+     *
+     *  @throw std::bad_alloc if there is a problem copying the views. Strong
+     *                        throw guarantee.
+     */
+    PointSetUnion(const PointSetUnion& other) = default;
+
+    /// Defaulted no throw dtor
+    ~PointSetUnion() noexcept = default;
+
+    /** @brief Compares for equality.
+     *
+     *  Like the other PIMPLs this compares the aliased points, not how the
+     *  points are partitioned among the views in the union.
+     */
+    bool operator==(const PointSetUnion& rhs) const noexcept;
+
+protected:
+    bool are_equal_(const base_type& other) const noexcept override {
+        return base_type::template are_equal_impl_<my_type>(other);
+    }
+
+    pimpl_pointer clone_() const override {
+        return std::make_unique<my_type>(*this);
+    }
+
+    const_pimpl_pointer as_const_() const override {
+        using const_view_type  = PointSetView<const point_set_type>;
+        using const_pimpl_type = PointSetUnion<const point_set_type>;
+        typename const_view_type::point_set_view_container points(
+          m_points_.begin(), m_points_.end());
+        return std::make_unique<const_pimpl_type>(std::move(points));
+    }
+
+    size_type size_() const noexcept override {
+        // Default constructed unions have no offsets
+        return m_offsets_.empty() ? 0 : m_offsets_.back();
+    }
+
+    reference at_(size_type i) override {
+        const auto j = view_index_(i);
+        return m_points_[j][i - m_offsets_[j]];
+    }
+
+    const_reference at_(size_type i) const override {
+        const auto j = view_index_(i);
+        return m_points_[j][i - m_offsets_[j]];
+    }
+
+    /// Copies each view's points into the columns, in bulk when possible
+    point_set_type as_point_set_() const override;
+
+private:
+    /// Returns the index of the view holding point @p i
+    size_type view_index_(size_type i) const noexcept {
+        // The first offset greater than i is one past the view holding i
+        auto itr = std::upper_bound(m_offsets_.begin(), m_offsets_.end(), i);
+        return (itr - m_offsets_.begin()) - 1;
+    }
+
+    /// The views whose union is *this
+    point_set_view_container m_points_;
+
+    /// Element j is the index of m_points_[j][0], last element is the size
+    std::vector<size_type> m_offsets_;
+};
+
+// -----------------------------------------------------------------------------
+// -- Out of line implementations
+// -----------------------------------------------------------------------------
+
+template<typename PointSetType>
+bool PointSetUnion<PointSetType>::operator==(
+  const PointSetUnion& rhs) const noexcept {
+    if(this->size() != rhs.size()) return false;
+    if(this->size() == 0) return true;
+
+    for(size_type i = 0; i < this->size(); ++i)
+        if((*this)[i] != rhs[i]) return false;
+
+    return true;
+}
+
+template<typename PointSetType>
+typename PointSetUnion<PointSetType>::point_set_type
+PointSetUnion<PointSetType>::as_point_set_() const {
+    const auto n = size_();
+    std::vector<coord_type> x(n), y(n), z(n);
+    for(size_type j = 0; j < m_points_.size(); ++j) {
+        const auto& view  = m_points_[j];
+        const auto offset = m_offsets_[j];
+        if(view.empty()) continue;
+        if(view.is_contiguous()) {
+            std::copy(view.x_column().begin(), view.x_column().end(),
+                      x.begin() + offset);
+            std::copy(view.y_column().begin(), view.y_column().end(),
+                      y.begin() + offset);
+            std::copy(view.z_column().begin(), view.z_column().end(),
+                      z.begin() + offset);
+            continue;
+        }
+        for(size_type i = 0; i < view.size(); ++i) {
+            const auto ri = view[i];
+            x[offset + i] = ri.x();
+            y[offset + i] = ri.y();
+            z[offset + i] = ri.z();
+        }
+    }
+    return point_set_type(x, y, z);
+}
+
+} // namespace chemist::detail_
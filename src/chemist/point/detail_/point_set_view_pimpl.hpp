@@ -17,6 +17,8 @@
 #pragma once
 #include <cassert>
 #include <chemist/point/point_set_view.hpp>
+#include <span>
+#include <vector>
 
 namespace chemist::detail_ {
 
@@ -38,9 +40,15 @@ public:
     /// Type *this implements
     using parent_type = PointSetView<PointSetType>;
 
+    /// Type of the PointSet being aliased, without cv-qualifiers
+    using point_set_type = typename parent_type::point_set_type;
+
     /// Type of pointer the parent uses to hold *this
     using pimpl_pointer = typename parent_type::pimpl_pointer;
 
+    /// Type of a pointer to a PIMPL implementing a read-only view
+    using const_pimpl_pointer = typename parent_type::const_pimpl_pointer;
+
     /// Type defining the types associated with a Point in *this
     using point_traits_type = typename parent_type::point_traits_type;
 
@@ -53,6 +61,12 @@ public:
     /// Type of a read-only reference to an element in *this
     using const_reference = typename parent_type::const_reference;
 
+    /// Type of a pointer to a coordinate
+    using coord_pointer = typename parent_type::coord_pointer;
+
+    /// Type of a coordinate, without cv-qualifiers
+    using coord_type = typename point_set_type::coord_type;
+
     /// No-op default ctor
     PointSetViewPIMPL() = default;
 
@@ -74,6 +88,9 @@ public:
     /// Shallow polymorhic copy
     pimpl_pointer clone() const { return clone_(); }
 
+    /// Shallow polymorphic copy which only allows read-only access
+    const_pimpl_pointer as_const() const { return as_const_(); }
+
     /// Returns the number of elements in *this
     size_type size() const noexcept { return size_(); }
 
@@ -88,6 +105,15 @@ public:
         return are_equal_(other);
     }
 
+    /// Address of the first coordinate of component @p xyz if the aliased
+    /// coordinates are stored contiguously, otherwise a null pointer
+    coord_pointer coord_data(size_type xyz) const noexcept {
+        return coord_data_(xyz);
+    }
+
+    /// Copies the aliased points into a new PointSet
+    point_set_type as_point_set() const { return as_point_set_(); }
+
 protected:
     /// Derived classes should implement are_equal_ by calling this method and
     /// setting DerivedType to their type.
@@ -100,6 +126,9 @@ protected:
     /// Derived class overwrites to implement clone
     virtual pimpl_pointer clone_() const = 0;
 
+    /// Derived class overwrites to implement as_const
+    virtual const_pimpl_pointer as_const_() const = 0;
+
     /// Derived class overwrites to implement size
     virtual size_type size_() const noexcept = 0;
 
@@ -108,12 +137,42 @@ protected:
 
     /// Derived class overwrites to implement read-only element access
     virtual const_reference at_(size_type i) const = 0;
+
+    /// Derived class overwrites if its coordinates can be contiguous
+    virtual coord_pointer coord_data_(size_type) const noexcept {
+        return nullptr;
+    }
+
+    /// Derived class overwrites if it can copy faster than point-by-point
+    virtual point_set_type as_point_set_() const;
 };
 
 // -----------------------------------------------------------------------------
 // -- Out of line definitions
 // -----------------------------------------------------------------------------
 
+template<typename PointSetType>
+typename PointSetViewPIMPL<PointSetType>::point_set_type
+PointSetViewPIMPL<PointSetType>::as_point_set_() const {
+    const auto n = size_();
+    if(coord_data_(0) != nullptr) {
+        using span_type = std::span<const coord_type>;
+        return point_set_type(span_type(coord_data_(0), n),
+                              span_type(coord_data_(1), n),
+                              span_type(coord_data_(2), n));
+    }
+
+    // Fill the columns and then hand them to the PointSet all at once
+    std::vector<coord_type> x(n), y(n), z(n);
+    for(size_type i = 0; i < n; ++i) {
+        const auto ri = at_(i);
+        x[i]          = ri.x();
+        y[i]          = ri.y();
+        z[i]          = ri.z();
+    }
+    return point_set_type(x, y, z);
+}
+
 template<typename PointSetType>
 template<typename DerivedType>
 bool PointSetViewPIMPL<PointSetType>::are_equal_impl_(
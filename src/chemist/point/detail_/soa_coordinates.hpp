@@ -0,0 +1,105 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <chemist/point/point_set.hpp>
+#include <chemist/point/point_set_view.hpp>
+#include <vector>
+
+namespace chemist::detail_ {
+
+/** @brief Read-only structure-of-arrays view of a set of coordinates.
+ *
+ *  The geometry kernels are written in terms of three contiguous arrays (one
+ *  per Cartesian component). PointSet objects already store their state that
+ *  way, so wrapping them is free, as is wrapping contiguous PointSetView
+ *  objects. For other PointSetView objects the coordinates are gathered into
+ *  buffers owned by *this. Either way, the kernels only ever see `size()` and
+ *  the three pointers.
+ *
+ *  @tparam T The floating-point type of the coordinates.
+ */
+template<typename T>
+class SoACoordinates {
+public:
+    /// Type used for indexing and offsets
+    using size_type = std::size_t;
+
+    /// Type of a read-only pointer to a coordinate
+    using const_coord_pointer = const T*;
+
+    /// Wraps the arrays of @p points, no copy is made
+    explicit SoACoordinates(const PointSet<T>& points) :
+      m_n_(points.size()),
+      m_px_(points.x_data()),
+      m_py_(points.y_data()),
+      m_pz_(points.z_data()) {}
+
+    /// Wraps the columns of @p points if it is contiguous, otherwise gathers
+    /// the coordinates aliased by @p points into *this
+    template<typename PointSetType>
+    explicit SoACoordinates(const PointSetView<PointSetType>& points) :
+      m_n_(points.size()) {
+        if(points.is_contiguous()) {
+            m_px_ = points.x_column().data();
+            m_py_ = points.y_column().data();
+            m_pz_ = points.z_column().data();
+            return;
+        }
+        m_buffer_.resize(3 * m_n_);
+        auto* px = m_buffer_.data();
+        auto* py = px + m_n_;
+        auto* pz = py + m_n_;
+        for(size_type i = 0; i < m_n_; ++i) {
+            const auto r_i = points[i];
+            px[i]          = r_i.x();
+            py[i]          = r_i.y();
+            pz[i]          = r_i.z();
+        }
+        m_px_ = px;
+        m_py_ = py;
+        m_pz_ = pz;
+    }
+
+    /// Copying would leave the pointers aliasing the original buffer
+    SoACoordinates(const SoACoordinates&) = delete;
+
+    /// Number of points
+    size_type size() const noexcept { return m_n_; }
+
+    /// Pointers to the first x-, y-, and z-coordinate respectively
+    ///@{
+    const_coord_pointer x() const noexcept { return m_px_; }
+    const_coord_pointer y() const noexcept { return m_py_; }
+    const_coord_pointer z() const noexcept { return m_pz_; }
+    ///@}
+
+private:
+    /// The number of points
+    size_type m_n_ = 0;
+
+    /// Storage for gathered coordinates (empty if *this wraps a PointSet)
+    std::vector<T> m_buffer_;
+
+    /// Pointers to the three coordinate arrays
+    ///@{
+    const_coord_pointer m_px_ = nullptr;
+    const_coord_pointer m_py_ = nullptr;
+    const_coord_pointer m_pz_ = nullptr;
+    ///@}
+};
+
+} // namespace chemist::detail_
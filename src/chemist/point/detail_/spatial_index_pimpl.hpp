@@ -0,0 +1,496 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "soa_coordinates.hpp"
+#include <algorithm>
+#include <array>
+#include <chemist/point/spatial_index.hpp>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace chemist::detail_ {
+
+/** @brief Implements SpatialIndex with a k-d tree.
+ *
+ *  The tree is built by recursively splitting the points at the median of
+ *  the coordinate with the largest extent, until at most `leaf_size` points
+ *  remain. Every node stores the bounding box of its points and queries prune
+ *  with those boxes (not the splitting planes), which is what allows update()
+ *  to simply refit the boxes.
+ *
+ *  The nodes are stored in pre-order, so the left child of node `i` is node
+ *  `i + 1`. Since the split is always at the midpoint of the range, the
+ *  shape of the tree only depends on the number of points and the index of
+ *  every node is known before the tree is built. That lets the two halves be
+ *  built concurrently.
+ *
+ *  The coordinates are stored in tree order, i.e., the points of each leaf
+ *  are contiguous, and `m_index_` maps back to the original indices. Each
+ *  node also records its parent, so update() only has to walk from the leaves
+ *  holding the moved points towards the root.
+ *
+ *  @tparam T The floating-point type of the coordinates.
+ */
+template<typename T>
+class SpatialIndexPIMPL {
+public:
+    /// Type *this implements
+    using parent_type = SpatialIndex<T>;
+
+    /// Reuse parent's types
+    ///@{
+    using size_type         = typename parent_type::size_type;
+    using index_list_type   = typename parent_type::index_list_type;
+    using batch_result_type = typename parent_type::batch_result_type;
+    using pair_list_type    = typename parent_type::pair_list_type;
+    ///@}
+
+    /// Type of the coordinates passed to *this
+    using coordinates_type = SoACoordinates<T>;
+
+    /// Maximum number of points in a leaf
+    static constexpr size_type leaf_size = 16;
+
+    /// Number of points below which building a subtree is not threaded
+    static constexpr size_type parallel_threshold = 4096;
+
+    /// Number of queries below which a batch is not threaded
+    static constexpr size_type batch_threshold = 256;
+
+    /// Creates an index of zero points
+    SpatialIndexPIMPL() = default;
+
+    /// Implements building a SpatialIndex
+    explicit SpatialIndexPIMPL(const coordinates_type& points) :
+      m_x_(points.x(), points.x() + points.size()),
+      m_y_(points.y(), points.y() + points.size()),
+      m_z_(points.z(), points.z() + points.size()),
+      m_index_(points.size()) {
+        std::iota(m_index_.begin(), m_index_.end(), size_type{0});
+        build_();
+    }
+
+    /// Implements SpatialIndex::update
+    void update(const coordinates_type& points,
+                const index_list_type& changed);
+
+    /// Implements SpatialIndex::rebuild
+    void rebuild();
+
+    /// Implements SpatialIndex::size
+    size_type size() const noexcept { return m_index_.size(); }
+
+    /// Implements SpatialIndex::radius_query for one point
+    index_list_type radius_query(T x, T y, T z, T radius) const;
+
+    /// Implements SpatialIndex::nearest_neighbors for one point
+    index_list_type nearest_neighbors(T x, T y, T z, size_type k) const;
+
+    /// Implements SpatialIndex::radius_query for a batch of points
+    batch_result_type radius_query(const coordinates_type& queries,
+                                   T radius) const;
+
+    /// Implements SpatialIndex::nearest_neighbors for a batch of points
+    batch_result_type nearest_neighbors(const coordinates_type& queries,
+                                        size_type k) const;
+
+    /// Implements SpatialIndex::neighbor_pairs
+    pair_list_type neighbor_pairs(T radius) const;
+
+private:
+    /// A node of the tree
+    struct Node {
+        /// Opposite corners of the node's bounding box
+        std::array<T, 3> lo;
+        std::array<T, 3> hi;
+
+        /// The points in the node are [begin, end) in tree order
+        size_type begin;
+        size_type end;
+
+        /// Index of the right child (the left child is this node + 1), or 0
+        /// if this node is a leaf
+        size_type right;
+
+        /// Index of the parent, or no_parent for the root
+        size_type parent;
+
+        bool is_leaf() const noexcept { return right == 0; }
+    };
+
+    /// Type used to track the best k candidates of a k-NN query
+    using candidate_type = std::pair<T, size_type>;
+
+    /// Value of Node::parent for the root
+    static constexpr size_type no_parent =
+      std::numeric_limits<size_type>::max();
+
+    /// Number of nodes in a tree holding @p n points
+    static size_type count_nodes_(size_type n) noexcept {
+        if(n <= leaf_size) return 1;
+        const size_type n_left = n / 2;
+        return 1 + count_nodes_(n_left) + count_nodes_(n - n_left);
+    }
+
+    /// Builds the tree from scratch. Coordinates must be in m_index_ order
+    void build_();
+
+    /// Builds node @p node, whose parent is @p parent, from the points
+    /// [begin, end) of m_index_
+    void build_node_(size_type node, size_type parent, size_type begin,
+                     size_type end, const std::array<const T*, 3>& r);
+
+    /// Recomputes the bounding box of leaf @p nd from its points (in tree
+    /// order), returns true if the box changed
+    bool fit_leaf_(Node& nd) const noexcept;
+
+    /// Recomputes the bounding box of internal node @p node from its
+    /// children, returns true if the box changed
+    bool fit_node_(size_type node) noexcept;
+
+    /// Squared distance from (x, y, z) to the bounding box of @p nd
+    static T box_distance2_(const Node& nd, T x, T y, T z) noexcept {
+        const std::array<T, 3> r{x, y, z};
+        T rv = 0;
+        for(size_type q = 0; q < 3; ++q) {
+            const T d = std::max({nd.lo[q] - r[q], T{0}, r[q] - nd.hi[q]});
+            rv += d * d;
+        }
+        return rv;
+    }
+
+    /// Squared distance from (x, y, z) to the point at position @p p
+    T distance2_(size_type p, T x, T y, T z) const noexcept {
+        const T dx = m_x_[p] - x;
+        const T dy = m_y_[p] - y;
+        const T dz = m_z_[p] - z;
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    /// Recursive part of the k-NN search
+    void knn_(size_type node, T x, T y, T z, size_type k,
+              std::vector<candidate_type>& heap) const;
+
+    /// The coordinates, in tree order
+    ///@{
+    std::vector<T> m_x_;
+    std::vector<T> m_y_;
+    std::vector<T> m_z_;
+    ///@}
+
+    /// m_index_[p] is the original index of the point at position p
+    index_list_type m_index_;
+
+    /// m_position_[i] is the position of the i-th point
+    index_list_type m_position_;
+
+    /// m_leaf_[p] is the leaf holding the point at position p
+    index_list_type m_leaf_;
+
+    /// The nodes of the tree in pre-order, node 0 is the root
+    std::vector<Node> m_nodes_;
+};
+
+// -----------------------------------------------------------------------------
+// -- Out of line implementations
+// -----------------------------------------------------------------------------
+
+template<typename T>
+void SpatialIndexPIMPL<T>::build_() {
+    const size_type n = size();
+    m_nodes_.assign(n ? count_nodes_(n) : 0, Node{});
+    m_leaf_.assign(n, 0);
+    m_position_.assign(n, 0);
+    if(n == 0) return;
+
+    // The build shuffles m_index_, so it reads coordinates in original order
+    std::vector<T> buffer(3 * n);
+    for(size_type p = 0; p < n; ++p) {
+        buffer[m_index_[p]]         = m_x_[p];
+        buffer[n + m_index_[p]]     = m_y_[p];
+        buffer[2 * n + m_index_[p]] = m_z_[p];
+    }
+    std::iota(m_index_.begin(), m_index_.end(), size_type{0});
+    const std::array<const T*, 3> r{buffer.data(), buffer.data() + n,
+                                    buffer.data() + 2 * n};
+
+#pragma omp parallel if(n >= parallel_threshold)
+#pragma omp single
+    build_node_(0, no_parent, 0, n, r);
+
+    // Store the coordinates in tree order
+    for(size_type p = 0; p < n; ++p) {
+        const auto i   = m_index_[p];
+        m_x_[p]        = r[0][i];
+        m_y_[p]        = r[1][i];
+        m_z_[p]        = r[2][i];
+        m_position_[i] = p;
+    }
+}
+
+template<typename T>
+void SpatialIndexPIMPL<T>::build_node_(size_type node, size_type parent,
+                                       size_type begin, size_type end,
+                                       const std::array<const T*, 3>& r) {
+    auto& nd  = m_nodes_[node];
+    nd.begin  = begin;
+    nd.end    = end;
+    nd.right  = 0;
+    nd.parent = parent;
+    for(size_type q = 0; q < 3; ++q) {
+        nd.lo[q] = std::numeric_limits<T>::max();
+        nd.hi[q] = std::numeric_limits<T>::lowest();
+        for(size_type p = begin; p < end; ++p) {
+            nd.lo[q] = std::min(nd.lo[q], r[q][m_index_[p]]);
+            nd.hi[q] = std::max(nd.hi[q], r[q][m_index_[p]]);
+        }
+    }
+
+    if(end - begin <= leaf_size) {
+        for(size_type p = begin; p < end; ++p) m_leaf_[p] = node;
+        return;
+    }
+
+    // Split at the median of the widest dimension
+    size_type dim = 0;
+    for(size_type q = 1; q < 3; ++q)
+        if(nd.hi[q] - nd.lo[q] > nd.hi[dim] - nd.lo[dim]) dim = q;
+    const size_type mid = begin + (end - begin) / 2;
+    const T* rq         = r[dim];
+    std::nth_element(
+      m_index_.begin() + begin, m_index_.begin() + mid, m_index_.begin() + end,
+      [rq](size_type i, size_type j) { return rq[i] < rq[j]; });
+
+    const size_type left  = node + 1;
+    const size_type right = left + count_nodes_(mid - begin);
+    nd.right              = right;
+
+#pragma omp task if(end - begin >= parallel_threshold)
+    build_node_(left, node, begin, mid, r);
+    build_node_(right, node, mid, end, r);
+}
+
+template<typename T>
+bool SpatialIndexPIMPL<T>::fit_leaf_(Node& nd) const noexcept {
+    const auto lo = nd.lo;
+    const auto hi = nd.hi;
+    for(size_type q = 0; q < 3; ++q) {
+        const auto& rq = q == 0 ? m_x_ : (q == 1 ? m_y_ : m_z_);
+        const auto [pmin, pmax] =
+          std::minmax_element(rq.begin() + nd.begin, rq.begin() + nd.end);
+        nd.lo[q] = *pmin;
+        nd.hi[q] = *pmax;
+    }
+    return nd.lo != lo || nd.hi != hi;
+}
+
+template<typename T>
+bool SpatialIndexPIMPL<T>::fit_node_(size_type node) noexcept {
+    auto& nd      = m_nodes_[node];
+    const auto lo = nd.lo;
+    const auto hi = nd.hi;
+    const auto& l = m_nodes_[node + 1];
+    const auto& r = m_nodes_[nd.right];
+    for(size_type q = 0; q < 3; ++q) {
+        nd.lo[q] = std::min(l.lo[q], r.lo[q]);
+        nd.hi[q] = std::max(l.hi[q], r.hi[q]);
+    }
+    return nd.lo != lo || nd.hi != hi;
+}
+
+template<typename T>
+void SpatialIndexPIMPL<T>::update(const coordinates_type& points,
+                                  const index_list_type& changed) {
+    if(points.size() != size())
+        throw std::runtime_error("Number of points does not match the index");
+    for(const auto i : changed)
+        if(i >= size()) throw std::out_of_range("Point index out of range");
+
+    // Refitting a mostly-moved tree is slower than rebuilding it
+    const bool do_rebuild = 2 * changed.size() > size();
+
+    index_list_type dirty;
+    if(!do_rebuild) dirty.reserve(changed.size());
+
+    for(const auto i : changed) {
+        const auto p = m_position_[i];
+        m_x_[p]      = points.x()[i];
+        m_y_[p]      = points.y()[i];
+        m_z_[p]      = points.z()[i];
+        if(!do_rebuild) dirty.push_back(m_leaf_[p]);
+    }
+
+    if(do_rebuild) {
+        build_();
+        return;
+    }
+
+    std::sort(dirty.begin(), dirty.end());
+    dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+
+    // Walk up from each refit leaf. Once a box comes out unchanged nothing
+    // above it can change either, so each walk is at most the tree's depth
+    // and usually much shorter. The order of the walks doesn't matter: every
+    // refit reads the current boxes of both children.
+    for(const auto leaf : dirty) {
+        if(!fit_leaf_(m_nodes_[leaf])) continue;
+        auto node = m_nodes_[leaf].parent;
+        while(node != no_parent && fit_node_(node))
+            node = m_nodes_[node].parent;
+    }
+}
+
+template<typename T>
+void SpatialIndexPIMPL<T>::rebuild() {
+    build_();
+}
+
+template<typename T>
+typename SpatialIndexPIMPL<T>::index_list_type
+SpatialIndexPIMPL<T>::radius_query(T x, T y, T z, T radius) const {
+    index_list_type rv;
+    if(size() == 0 || radius < T{0}) return rv;
+    const T r2 = radius * radius;
+
+    // The tree depth is at most log2(size()), so this can't overflow
+    std::array<size_type, 2 * std::numeric_limits<size_type>::digits> stack;
+    size_type n_stack = 0;
+    stack[n_stack++]  = 0;
+    while(n_stack) {
+        const auto node = stack[--n_stack];
+        const auto& nd  = m_nodes_[node];
+        if(box_distance2_(nd, x, y, z) > r2) continue;
+        if(!nd.is_leaf()) {
+            stack[n_stack++] = nd.right;
+            stack[n_stack++] = node + 1;
+            continue;
+        }
+        for(size_type p = nd.begin; p < nd.end; ++p)
+            if(distance2_(p, x, y, z) <= r2) rv.push_back(m_index_[p]);
+    }
+    std::sort(rv.begin(), rv.end());
+    return rv;
+}
+
+template<typename T>
+void SpatialIndexPIMPL<T>::knn_(size_type node, T x, T y, T z, size_type k,
+                                std::vector<candidate_type>& heap) const {
+    const auto& nd = m_nodes_[node];
+    if(heap.size() == k && box_distance2_(nd, x, y, z) > heap.front().first)
+        return;
+
+    if(nd.is_leaf()) {
+        for(size_type p = nd.begin; p < nd.end; ++p) {
+            candidate_type c{distance2_(p, x, y, z), m_index_[p]};
+            if(heap.size() < k) {
+                heap.push_back(c);
+                std::push_heap(heap.begin(), heap.end());
+            } else if(c < heap.front()) {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = c;
+                std::push_heap(heap.begin(), heap.end());
+            }
+        }
+        return;
+    }
+
+    // Visit the closer child first so the farther one is more likely pruned
+    size_type near = node + 1;
+    size_type far  = nd.right;
+    if(box_distance2_(m_nodes_[far], x, y, z) <
+       box_distance2_(m_nodes_[near], x, y, z))
+        std::swap(near, far);
+    knn_(near, x, y, z, k, heap);
+    knn_(far, x, y, z, k, heap);
+}
+
+template<typename T>
+typename SpatialIndexPIMPL<T>::index_list_type
+SpatialIndexPIMPL<T>::nearest_neighbors(T x, T y, T z, size_type k) const {
+    k = std::min(k, size());
+    if(k == 0) return index_list_type{};
+
+    std::vector<candidate_type> heap;
+    heap.reserve(k);
+    knn_(0, x, y, z, k, heap);
+    std::sort_heap(heap.begin(), heap.end());
+
+    index_list_type rv(heap.size());
+    for(size_type i = 0; i < heap.size(); ++i) rv[i] = heap[i].second;
+    return rv;
+}
+
+template<typename T>
+typename SpatialIndexPIMPL<T>::batch_result_type
+SpatialIndexPIMPL<T>::radius_query(const coordinates_type& queries,
+                                   T radius) const {
+    const size_type n = queries.size();
+    const auto* px    = queries.x();
+    const auto* py    = queries.y();
+    const auto* pz    = queries.z();
+    batch_result_type rv(n);
+
+#pragma omp parallel for schedule(dynamic, 64) if(n >= batch_threshold)
+    for(size_type i = 0; i < n; ++i)
+        rv[i] = radius_query(px[i], py[i], pz[i], radius);
+
+    return rv;
+}
+
+template<typename T>
+typename SpatialIndexPIMPL<T>::batch_result_type
+SpatialIndexPIMPL<T>::nearest_neighbors(const coordinates_type& queries,
+                                        size_type k) const {
+    const size_type n = queries.size();
+    const auto* px    = queries.x();
+    const auto* py    = queries.y();
+    const auto* pz    = queries.z();
+    batch_result_type rv(n);
+
+#pragma omp parallel for schedule(dynamic, 64) if(n >= batch_threshold)
+    for(size_type i = 0; i < n; ++i)
+        rv[i] = nearest_neighbors(px[i], py[i], pz[i], k);
+
+    return rv;
+}
+
+template<typename T>
+typename SpatialIndexPIMPL<T>::pair_list_type
+SpatialIndexPIMPL<T>::neighbor_pairs(T radius) const {
+    const size_type n = size();
+    batch_result_type neighbors(n);
+
+#pragma omp parallel for schedule(dynamic, 64) if(n >= batch_threshold)
+    for(size_type i = 0; i < n; ++i) {
+        const auto p = m_position_[i];
+        neighbors[i] = radius_query(m_x_[p], m_y_[p], m_z_[p], radius);
+    }
+
+    // Each list is sorted, so keeping j > i in order of i yields sorted pairs
+    pair_list_type rv;
+    for(size_type i = 0; i < n; ++i) {
+        const auto& nbrs = neighbors[i];
+        auto j = std::upper_bound(nbrs.begin(), nbrs.end(), i);
+        for(; j != nbrs.end(); ++j) rv.emplace_back(i, *j);
+    }
+    return rv;
+}
+
+} // namespace chemist::detail_
@@ -15,6 +15,7 @@
  */
 
 #include "detail_/point_set_pimpl.hpp"
+#include <chemist/point/space_filling_curve.hpp>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -35,6 +36,17 @@ POINT_SET::PointSet(std::initializer_list<value_type> points) :
     for(const auto& x : points) m_pimpl_->push_back(x);
 }
 
+TEMPLATE_PARAMS
+POINT_SET::PointSet(std::span<const coord_type> x,
+                    std::span<const coord_type> y,
+                    std::span<const coord_type> z) :
+  PointSet(std::make_unique<pimpl_type>(x, y, z)) {}
+
+TEMPLATE_PARAMS
+POINT_SET::PointSet(const other_precision_type& other) :
+  PointSet(std::make_unique<pimpl_type>(other.size(), other.x_data(),
+                                        other.y_data(), other.z_data())) {}
+
 TEMPLATE_PARAMS
 POINT_SET::PointSet(pimpl_pointer pimpl) noexcept :
   m_pimpl_(std::move(pimpl)) {}
@@ -66,6 +78,40 @@ void POINT_SET::push_back(value_type r) {
     m_pimpl_->push_back(std::move(r));
 }
 
+TEMPLATE_PARAMS
+void POINT_SET::reserve(size_type n) {
+    if(!has_pimpl_()) m_pimpl_ = std::make_unique<pimpl_type>();
+    m_pimpl_->reserve(n);
+}
+
+TEMPLATE_PARAMS
+void POINT_SET::permute(const permutation_type& p) {
+    detail_::check_permutation(p, this->size());
+    if(has_pimpl_()) m_pimpl_->permute(p);
+}
+
+TEMPLATE_PARAMS
+typename POINT_SET::permutation_type POINT_SET::reorder(
+  SpaceFillingCurve curve) {
+    auto p = space_filling_curve_order(*this, curve);
+    permute(p);
+    return p;
+}
+
+TEMPLATE_PARAMS
+void POINT_SET::transform(const affine_type& f) noexcept {
+    if(!has_pimpl_()) return;
+    auto n = this->size();
+    f.apply(n, x_data(), y_data(), z_data(), x_data(), y_data(), z_data());
+}
+
+TEMPLATE_PARAMS
+POINT_SET POINT_SET::transformed(const affine_type& f) const {
+    PointSet rv(*this);
+    rv.transform(f);
+    return rv;
+}
+
 // -- Accessors ----------------------------------------------------------------
 
 TEMPLATE_PARAMS
@@ -98,6 +144,11 @@ typename POINT_SET::const_coord_pointer POINT_SET::z_data() const noexcept {
     return has_pimpl_() ? m_pimpl_->z_data() : nullptr;
 }
 
+TEMPLATE_PARAMS
+typename POINT_SET::size_type POINT_SET::padded_size() const noexcept {
+    return has_pimpl_() ? m_pimpl_->padded_size() : 0;
+}
+
 // -- Private ------------------------------------------------------------------
 
 TEMPLATE_PARAMS
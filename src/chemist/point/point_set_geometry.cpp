@@ -0,0 +1,401 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "detail_/soa_coordinates.hpp"
+#include <chemist/point/point_set_geometry.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace chemist {
+namespace {
+
+using size_type = std::size_t;
+
+/// Number of points per tile, 3 * 256 doubles fit comfortably in L1
+constexpr size_type tile_size = 256;
+
+/// Number of pairs below which threading costs more than it saves
+constexpr size_type parallel_threshold = size_type(1) << 16;
+
+/// Number of tiles needed to cover @p n points
+constexpr size_type n_tiles(size_type n) noexcept {
+    return (n + tile_size - 1) / tile_size;
+}
+
+/** @brief Loops over all pairs of points in @p lhs and @p rhs in tiles.
+ *
+ *  For each point i of @p lhs and each tile of @p rhs, @p fxn is called with
+ *  the coordinates of i, the bounds of the tile, and i's row index. @p fxn is
+ *  expected to contain the innermost (vectorizable) loop.
+ */
+template<typename T, typename FxnType>
+void tiled_pair_loop(const detail_::SoACoordinates<T>& lhs,
+                     const detail_::SoACoordinates<T>& rhs, FxnType&& fxn) {
+    const size_type n    = lhs.size();
+    const size_type m    = rhs.size();
+    const size_type n_ti = n_tiles(n);
+    const size_type n_tj = n_tiles(m);
+    const auto* const px = lhs.x();
+    const auto* const py = lhs.y();
+    const auto* const pz = lhs.z();
+
+#pragma omp parallel for collapse(2) schedule(static) \
+  if(n * m >= parallel_threshold)
+    for(size_type ti = 0; ti < n_ti; ++ti) {
+        for(size_type tj = 0; tj < n_tj; ++tj) {
+            const size_type i_end   = std::min(n, (ti + 1) * tile_size);
+            const size_type j_begin = tj * tile_size;
+            const size_type j_end   = std::min(m, j_begin + tile_size);
+            for(size_type i = ti * tile_size; i < i_end; ++i)
+                fxn(i, px[i], py[i], pz[i], j_begin, j_end);
+        }
+    }
+}
+
+template<typename T>
+std::vector<T> distance_matrix_(const detail_::SoACoordinates<T>& lhs,
+                                const detail_::SoACoordinates<T>& rhs) {
+    const size_type m = rhs.size();
+    std::vector<T> rv(lhs.size() * m);
+    auto* const prv   = rv.data();
+    const auto* qx    = rhs.x();
+    const auto* qy    = rhs.y();
+    const auto* qz    = rhs.z();
+
+    auto kernel = [=](size_type i, T xi, T yi, T zi, size_type j_begin,
+                      size_type j_end) {
+        T* const row = prv + i * m;
+#pragma omp simd
+        for(size_type j = j_begin; j < j_end; ++j) {
+            const T dx = xi - qx[j];
+            const T dy = yi - qy[j];
+            const T dz = zi - qz[j];
+            row[j]     = std::sqrt(dx * dx + dy * dy + dz * dz);
+        }
+    };
+    tiled_pair_loop(lhs, rhs, kernel);
+    return rv;
+}
+
+template<typename T>
+neighbor_mask_type neighbor_mask_(const detail_::SoACoordinates<T>& lhs,
+                                  const detail_::SoACoordinates<T>& rhs,
+                                  T cutoff) {
+    const size_type m = rhs.size();
+    neighbor_mask_type rv(lhs.size() * m);
+    auto* const prv = rv.data();
+    const auto* qx  = rhs.x();
+    const auto* qy  = rhs.y();
+    const auto* qz  = rhs.z();
+    const T r2      = cutoff * cutoff;
+
+    auto kernel = [=](size_type i, T xi, T yi, T zi, size_type j_begin,
+                      size_type j_end) {
+        auto* const row = prv + i * m;
+#pragma omp simd
+        for(size_type j = j_begin; j < j_end; ++j) {
+            const T dx = xi - qx[j];
+            const T dy = yi - qy[j];
+            const T dz = zi - qz[j];
+            row[j]     = (dx * dx + dy * dy + dz * dz) <= r2;
+        }
+    };
+    tiled_pair_loop(lhs, rhs, kernel);
+    return rv;
+}
+
+template<typename T>
+std::vector<T> distances_(T x, T y, T z,
+                          const detail_::SoACoordinates<T>& points) {
+    const size_type n = points.size();
+    std::vector<T> rv(n);
+    auto* const prv = rv.data();
+    const auto* qx  = points.x();
+    const auto* qy  = points.y();
+    const auto* qz  = points.z();
+
+#pragma omp parallel for simd schedule(static) if(n >= parallel_threshold)
+    for(size_type i = 0; i < n; ++i) {
+        const T dx = x - qx[i];
+        const T dy = y - qy[i];
+        const T dz = z - qz[i];
+        prv[i]     = std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+    return rv;
+}
+
+template<typename T>
+neighbor_mask_type neighbor_mask_(T x, T y, T z,
+                                  const detail_::SoACoordinates<T>& points,
+                                  T cutoff) {
+    const size_type n = points.size();
+    neighbor_mask_type rv(n);
+    auto* const prv = rv.data();
+    const auto* qx  = points.x();
+    const auto* qy  = points.y();
+    const auto* qz  = points.z();
+    const T r2      = cutoff * cutoff;
+
+#pragma omp parallel for simd schedule(static) if(n >= parallel_threshold)
+    for(size_type i = 0; i < n; ++i) {
+        const T dx = x - qx[i];
+        const T dy = y - qy[i];
+        const T dz = z - qz[i];
+        prv[i]     = (dx * dx + dy * dy + dz * dz) <= r2;
+    }
+    return rv;
+}
+
+/** @brief Pads the single-precision screen so it never rejects a neighbor.
+ *
+ *  Rounding the coordinates to float, and computing the squared distance in
+ *  float, perturbs the distance by at most a few float epsilons times the
+ *  sum of the magnitudes of the coordinates involved. The pad is a generous
+ *  multiple of that bound. It is cheap enough to evaluate per pair inside
+ *  the vectorized loop.
+ */
+inline float screen_pad(float abs_sum, float cutoff) noexcept {
+    constexpr float eps = std::numeric_limits<float>::epsilon();
+    return 4.0f * eps * (abs_sum + cutoff);
+}
+
+/// Throws if @p points and @p screen do not hold the same number of points
+void assert_same_size(const PointSet<double>& points,
+                      const PointSet<float>& screen) {
+    if(points.size() == screen.size()) return;
+    throw std::runtime_error("Screen must have the same number of points");
+}
+
+} // namespace
+
+// -- PointSet overloads -------------------------------------------------------
+
+template<typename T>
+std::vector<T> distance_matrix(const PointSet<T>& points) {
+    detail_::SoACoordinates<T> soa(points);
+    return distance_matrix_(soa, soa);
+}
+
+template<typename T>
+std::vector<T> distance_matrix(const PointSet<T>& lhs, const PointSet<T>& rhs) {
+    detail_::SoACoordinates<T> lhs_soa(lhs);
+    detail_::SoACoordinates<T> rhs_soa(rhs);
+    return distance_matrix_(lhs_soa, rhs_soa);
+}
+
+template<typename T>
+std::vector<T> distances(const Point<T>& r, const PointSet<T>& points) {
+    detail_::SoACoordinates<T> soa(points);
+    return distances_(r.x(), r.y(), r.z(), soa);
+}
+
+template<typename T>
+neighbor_mask_type neighbor_mask(const Point<T>& r, const PointSet<T>& points,
+                                 T cutoff) {
+    detail_::SoACoordinates<T> soa(points);
+    return neighbor_mask_(r.x(), r.y(), r.z(), soa, cutoff);
+}
+
+template<typename T>
+neighbor_mask_type neighbor_mask(const PointSet<T>& lhs,
+                                 const PointSet<T>& rhs, T cutoff) {
+    detail_::SoACoordinates<T> lhs_soa(lhs);
+    detail_::SoACoordinates<T> rhs_soa(rhs);
+    return neighbor_mask_(lhs_soa, rhs_soa, cutoff);
+}
+
+// -- Mixed-precision overloads ------------------------------------------------
+
+neighbor_mask_type neighbor_mask(const Point<double>& r,
+                                 const PointSet<double>& points,
+                                 const PointSet<float>& screen, double cutoff) {
+    assert_same_size(points, screen);
+    detail_::SoACoordinates<float> soa(screen);
+    const size_type n = soa.size();
+    neighbor_mask_type rv(n);
+    auto* const prv = rv.data();
+    const auto* qx  = soa.x();
+    const auto* qy  = soa.y();
+    const auto* qz  = soa.z();
+
+    // Pass 1: screen in single precision
+    const float x    = r.x();
+    const float y    = r.y();
+    const float z    = r.z();
+    const float c    = cutoff;
+    const float r_ab = std::fabs(x) + std::fabs(y) + std::fabs(z);
+
+#pragma omp parallel for simd schedule(static) if(n >= parallel_threshold)
+    for(size_type i = 0; i < n; ++i) {
+        const float dx  = x - qx[i];
+        const float dy  = y - qy[i];
+        const float dz  = z - qz[i];
+        const float ab  = r_ab + std::fabs(qx[i]) + std::fabs(qy[i]) +
+                         std::fabs(qz[i]);
+        const float c_i = c + screen_pad(ab, c);
+        prv[i]          = (dx * dx + dy * dy + dz * dz) <= c_i * c_i;
+    }
+
+    // Pass 2: recheck the survivors in double precision
+    const auto* px  = points.x_data();
+    const auto* py  = points.y_data();
+    const auto* pz  = points.z_data();
+    const double r2 = cutoff * cutoff;
+
+#pragma omp parallel for schedule(static) if(n >= parallel_threshold)
+    for(size_type i = 0; i < n; ++i) {
+        if(!prv[i]) continue;
+        const double dx = r.x() - px[i];
+        const double dy = r.y() - py[i];
+        const double dz = r.z() - pz[i];
+        prv[i]          = (dx * dx + dy * dy + dz * dz) <= r2;
+    }
+    return rv;
+}
+
+neighbor_mask_type neighbor_mask(const PointSet<double>& lhs,
+                                 const PointSet<float>& lhs_screen,
+                                 const PointSet<double>& rhs,
+                                 const PointSet<float>& rhs_screen,
+                                 double cutoff) {
+    assert_same_size(lhs, lhs_screen);
+    assert_same_size(rhs, rhs_screen);
+    detail_::SoACoordinates<float> lhs_soa(lhs_screen);
+    detail_::SoACoordinates<float> rhs_soa(rhs_screen);
+    const size_type m = rhs_soa.size();
+    neighbor_mask_type rv(lhs_soa.size() * m);
+    auto* const prv = rv.data();
+    const auto* qx  = rhs_soa.x();
+    const auto* qy  = rhs_soa.y();
+    const auto* qz  = rhs_soa.z();
+    const auto* px  = lhs.x_data();
+    const auto* py  = lhs.y_data();
+    const auto* pz  = lhs.z_data();
+    const auto* dqx = rhs.x_data();
+    const auto* dqy = rhs.y_data();
+    const auto* dqz = rhs.z_data();
+    const float c   = cutoff;
+    const double r2 = cutoff * cutoff;
+
+    // Screens a tile of a row in single precision, then rechecks the
+    // survivors (while the tile is still in cache) in double precision
+    auto kernel = [=](size_type i, float xi, float yi, float zi,
+                      size_type j_begin, size_type j_end) {
+        auto* const row  = prv + i * m;
+        const float i_ab = std::fabs(xi) + std::fabs(yi) + std::fabs(zi);
+#pragma omp simd
+        for(size_type j = j_begin; j < j_end; ++j) {
+            const float dx  = xi - qx[j];
+            const float dy  = yi - qy[j];
+            const float dz  = zi - qz[j];
+            const float ab  = i_ab + std::fabs(qx[j]) + std::fabs(qy[j]) +
+                             std::fabs(qz[j]);
+            const float c_j = c + screen_pad(ab, c);
+            row[j]          = (dx * dx + dy * dy + dz * dz) <= c_j * c_j;
+        }
+        for(size_type j = j_begin; j < j_end; ++j) {
+            if(!row[j]) continue;
+            const double dx = px[i] - dqx[j];
+            const double dy = py[i] - dqy[j];
+            const double dz = pz[i] - dqz[j];
+            row[j]          = (dx * dx + dy * dy + dz * dz) <= r2;
+        }
+    };
+    tiled_pair_loop(lhs_soa, rhs_soa, kernel);
+    return rv;
+}
+
+// -- PointSetView overloads ---------------------------------------------------
+
+#define TPARAMS template<typename PointSetType>
+#define VIEW PointSetView<PointSetType>
+#define COORD typename VIEW::value_type::coord_type
+
+TPARAMS
+auto distance_matrix(const VIEW& points) -> std::vector<COORD> {
+    detail_::SoACoordinates<COORD> soa(points);
+    return distance_matrix_(soa, soa);
+}
+
+TPARAMS
+auto distance_matrix(const VIEW& lhs, const VIEW& rhs) -> std::vector<COORD> {
+    detail_::SoACoordinates<COORD> lhs_soa(lhs);
+    detail_::SoACoordinates<COORD> rhs_soa(rhs);
+    return distance_matrix_(lhs_soa, rhs_soa);
+}
+
+TPARAMS
+auto distances(const typename VIEW::value_type& r, const VIEW& points)
+  -> std::vector<COORD> {
+    detail_::SoACoordinates<COORD> soa(points);
+    return distances_(r.x(), r.y(), r.z(), soa);
+}
+
+TPARAMS
+neighbor_mask_type neighbor_mask(const typename VIEW::value_type& r,
+                                 const VIEW& points, COORD cutoff) {
+    detail_::SoACoordinates<COORD> soa(points);
+    return neighbor_mask_(r.x(), r.y(), r.z(), soa, cutoff);
+}
+
+TPARAMS
+neighbor_mask_type neighbor_mask(const VIEW& lhs, const VIEW& rhs,
+                                 COORD cutoff) {
+    detail_::SoACoordinates<COORD> lhs_soa(lhs);
+    detail_::SoACoordinates<COORD> rhs_soa(rhs);
+    return neighbor_mask_(lhs_soa, rhs_soa, cutoff);
+}
+
+#undef COORD
+#undef VIEW
+#undef TPARAMS
+
+// -- Explicit instantiations --------------------------------------------------
+
+#define INSTANTIATE_POINT_SET(T)                                               \
+    template std::vector<T> distance_matrix(const PointSet<T>&);               \
+    template std::vector<T> distance_matrix(const PointSet<T>&,                \
+                                            const PointSet<T>&);               \
+    template std::vector<T> distances(const Point<T>&, const PointSet<T>&);    \
+    template neighbor_mask_type neighbor_mask(const Point<T>&,                 \
+                                              const PointSet<T>&, T);          \
+    template neighbor_mask_type neighbor_mask(const PointSet<T>&,              \
+                                              const PointSet<T>&, T)
+
+#define INSTANTIATE_VIEW(T, PointSetType)                                      \
+    template std::vector<T> distance_matrix(const PointSetView<PointSetType>&); \
+    template std::vector<T> distance_matrix(const PointSetView<PointSetType>&,  \
+                                            const PointSetView<PointSetType>&); \
+    template std::vector<T> distances(const Point<T>&,                         \
+                                      const PointSetView<PointSetType>&);      \
+    template neighbor_mask_type neighbor_mask(                                 \
+      const Point<T>&, const PointSetView<PointSetType>&, T);                  \
+    template neighbor_mask_type neighbor_mask(                                 \
+      const PointSetView<PointSetType>&, const PointSetView<PointSetType>&, T)
+
+INSTANTIATE_POINT_SET(float);
+INSTANTIATE_POINT_SET(double);
+INSTANTIATE_VIEW(float, PointSet<float>);
+INSTANTIATE_VIEW(float, const PointSet<float>);
+INSTANTIATE_VIEW(double, PointSet<double>);
+INSTANTIATE_VIEW(double, const PointSet<double>);
+
+#undef INSTANTIATE_VIEW
+#undef INSTANTIATE_POINT_SET
+
+} // namespace chemist
@@ -15,6 +15,11 @@
  */
 
 #include "detail_/point_set_contiguous.hpp"
+#include "detail_/point_set_strided.hpp"
+#include "detail_/point_set_subset.hpp"
+#include "detail_/point_set_union.hpp"
+#include <algorithm>
+#include <stdexcept>
 #include <utility>
 
 namespace chemist {
@@ -39,6 +44,24 @@ POINT_SET_VIEW::PointSetView(size_type n_points, coord_pointer px,
   m_pimpl_(std::make_unique<detail_::PointSetContiguous<PointSetType>>(
     n_points, px, py, pz)) {}
 
+TPARAMS
+POINT_SET_VIEW::PointSetView(size_type n_points, coord_pointer px,
+                             coord_pointer py, coord_pointer pz,
+                             size_type stride) :
+  m_pimpl_(std::make_unique<detail_::PointSetStrided<PointSetType>>(
+    n_points, px, py, pz, stride)) {}
+
+TPARAMS
+POINT_SET_VIEW::PointSetView(PointSetView supersystem,
+                             member_list_type members) :
+  m_pimpl_(std::make_unique<detail_::PointSetSubset<PointSetType>>(
+    std::move(supersystem), std::move(members))) {}
+
+TPARAMS
+POINT_SET_VIEW::PointSetView(point_set_view_container members) :
+  m_pimpl_(std::make_unique<detail_::PointSetUnion<PointSetType>>(
+    std::move(members))) {}
+
 TPARAMS
 POINT_SET_VIEW::PointSetView(pimpl_pointer pimpl) noexcept :
   m_pimpl_(std::move(pimpl)) {}
@@ -89,8 +112,59 @@ bool POINT_SET_VIEW::operator!=(const PointSetView& rhs) const noexcept {
 
 TPARAMS
 typename POINT_SET_VIEW::point_set_type POINT_SET_VIEW::as_point_set() const {
-    point_set_type rv;
-    for(const auto& x : *this) rv.push_back(x.as_point());
+    return empty() ? point_set_type{} : m_pimpl_->as_point_set();
+}
+
+TPARAMS
+bool POINT_SET_VIEW::is_contiguous() const noexcept {
+    return empty() || m_pimpl_->coord_data(0) != nullptr;
+}
+
+TPARAMS
+void POINT_SET_VIEW::transform(const affine_type& f)
+  requires(!std::is_const_v<PointSetType>)
+{
+    using coord_type = typename affine_type::coord_type;
+
+    if(is_contiguous()) {
+        auto x = x_column();
+        auto y = y_column();
+        auto z = z_column();
+        f.apply(x.size(), x.data(), y.data(), z.data(), x.data(), y.data(),
+                z.data());
+        return;
+    }
+
+    // Number of points per tile, the three buffers fit comfortably in L1
+    constexpr size_type tile_size = 256;
+    coord_type x[tile_size];
+    coord_type y[tile_size];
+    coord_type z[tile_size];
+
+    const size_type n = size_();
+    for(size_type begin = 0; begin < n; begin += tile_size) {
+        const size_type m = std::min(tile_size, n - begin);
+        for(size_type i = 0; i < m; ++i) {
+            auto r = at_(begin + i);
+            x[i]   = r.x();
+            y[i]   = r.y();
+            z[i]   = r.z();
+        }
+        f.apply(m, x, y, z, x, y, z);
+        for(size_type i = 0; i < m; ++i) {
+            auto r = at_(begin + i);
+            r.x()  = x[i];
+            r.y()  = y[i];
+            r.z()  = z[i];
+        }
+    }
+}
+
+TPARAMS
+typename POINT_SET_VIEW::point_set_type POINT_SET_VIEW::transformed(
+  const affine_type& f) const {
+    auto rv = as_point_set();
+    rv.transform(f);
     return rv;
 }
 
@@ -107,6 +181,14 @@ typename POINT_SET_VIEW::pimpl_pointer POINT_SET_VIEW::clone_pimpl_() const {
     return has_pimpl_() ? m_pimpl_->clone() : pimpl_pointer{};
 }
 
+TPARAMS
+PointSetView<const typename POINT_SET_VIEW::point_set_type>
+POINT_SET_VIEW::as_const_() const {
+    using const_view_type = PointSetView<const point_set_type>;
+    if(!has_pimpl_()) return const_view_type{};
+    return const_view_type(m_pimpl_->as_const());
+}
+
 TPARAMS
 typename POINT_SET_VIEW::reference POINT_SET_VIEW::at_(size_type i) {
     return m_pimpl_->operator[](i);
@@ -123,6 +205,14 @@ typename POINT_SET_VIEW::size_type POINT_SET_VIEW::size_() const noexcept {
     return has_pimpl_() ? m_pimpl_->size() : 0;
 }
 
+TPARAMS
+typename POINT_SET_VIEW::coord_pointer POINT_SET_VIEW::column_data_(
+  size_type xyz) const {
+    if(!is_contiguous())
+        throw std::runtime_error("The aliased coordinates are not contiguous");
+    return empty() ? nullptr : m_pimpl_->coord_data(xyz);
+}
+
 #undef POINT_SET_VIEW
 #undef TPARAMS
 
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "detail_/soa_coordinates.hpp"
+#include <algorithm>
+#include <array>
+#include <chemist/detail_/permutation.hpp>
+#include <chemist/point/space_filling_curve.hpp>
+#include <cstdint>
+#include <utility>
+
+namespace chemist {
+namespace {
+
+using size_type = std::size_t;
+using key_type  = std::uint64_t;
+
+/// Bits per dimension, 3 * 21 = 63 bits fit in a 64-bit key
+constexpr unsigned int n_bits = 21;
+
+/// Largest lattice coordinate
+constexpr std::uint32_t max_cell = (std::uint32_t(1) << n_bits) - 1;
+
+/// Spreads the low 21 bits of @p v so there are two zero bits between each
+key_type spread_bits(std::uint32_t v) noexcept {
+    key_type x = v & max_cell;
+    x          = (x | (x << 32)) & 0x1f00000000ffffULL;
+    x          = (x | (x << 16)) & 0x1f0000ff0000ffULL;
+    x          = (x | (x << 8)) & 0x100f00f00f00f00fULL;
+    x          = (x | (x << 4)) & 0x10c30c30c30c30c3ULL;
+    x          = (x | (x << 2)) & 0x1249249249249249ULL;
+    return x;
+}
+
+/// Interleaves the bits of the lattice coordinates, @p r[0] most significant
+key_type interleave(const std::array<std::uint32_t, 3>& r) noexcept {
+    return (spread_bits(r[0]) << 2) | (spread_bits(r[1]) << 1) |
+           spread_bits(r[2]);
+}
+
+/** @brief Computes the Hilbert index of lattice point @p r.
+ *
+ *  This is Skilling's algorithm ("Programming the Hilbert curve", AIP Conf.
+ *  Proc. 707, 381 (2004)). It transforms the coordinates in place into the
+ *  "transposed" Hilbert index, whose interleaved bits are the index.
+ */
+key_type hilbert_key(std::array<std::uint32_t, 3> r) noexcept {
+    constexpr std::uint32_t m = std::uint32_t(1) << (n_bits - 1);
+
+    // Inverse undo
+    for(std::uint32_t q = m; q > 1; q >>= 1) {
+        const std::uint32_t p = q - 1;
+        for(std::size_t i = 0; i < 3; ++i) {
+            if(r[i] & q) {
+                r[0] ^= p;
+            } else {
+                const std::uint32_t t = (r[0] ^ r[i]) & p;
+                r[0] ^= t;
+                r[i] ^= t;
+            }
+        }
+    }
+
+    // Gray encode
+    r[1] ^= r[0];
+    r[2] ^= r[1];
+    std::uint32_t t = 0;
+    for(std::uint32_t q = m; q > 1; q >>= 1)
+        if(r[2] & q) t ^= q - 1;
+    for(auto& ri : r) ri ^= t;
+
+    return interleave(r);
+}
+
+/// Maps each point to its lattice cell and sorts the points by curve index
+template<typename T>
+detail_::permutation_type curve_order(const detail_::SoACoordinates<T>& soa,
+                                      SpaceFillingCurve curve) {
+    const size_type n = soa.size();
+    detail_::permutation_type rv(n);
+    if(n == 0) return rv;
+
+    const std::array<const T*, 3> pr{soa.x(), soa.y(), soa.z()};
+
+    // Bounding box and the scale factors mapping it onto the lattice
+    std::array<T, 3> lo, scale;
+    for(size_type q = 0; q < 3; ++q) {
+        const auto [pmin, pmax] = std::minmax_element(pr[q], pr[q] + n);
+        const T width           = *pmax - *pmin;
+        lo[q]                   = *pmin;
+        scale[q] = width > T{0} ? T(max_cell) / width : T{0};
+    }
+
+    std::vector<std::pair<key_type, size_type>> keys(n);
+    for(size_type i = 0; i < n; ++i) {
+        std::array<std::uint32_t, 3> r;
+        for(size_type q = 0; q < 3; ++q) {
+            const T x = (pr[q][i] - lo[q]) * scale[q];
+            r[q]      = std::min(std::uint32_t(x), max_cell);
+        }
+        const auto key = curve == SpaceFillingCurve::hilbert ? hilbert_key(r) :
+                                                               interleave(r);
+        keys[i]        = {key, i};
+    }
+
+    // N.b. sorting on (key, index) keeps ties in their original order
+    std::sort(keys.begin(), keys.end());
+    for(size_type i = 0; i < n; ++i) rv[i] = keys[i].second;
+    return rv;
+}
+
+} // namespace
+
+template<typename T>
+std::vector<std::size_t> space_filling_curve_order(const PointSet<T>& points,
+                                                   SpaceFillingCurve curve) {
+    detail_::SoACoordinates<T> soa(points);
+    return curve_order(soa, curve);
+}
+
+template<typename PointSetType>
+std::vector<std::size_t> space_filling_curve_order(
+  const PointSetView<PointSetType>& points, SpaceFillingCurve curve) {
+    using point_type = typename PointSetView<PointSetType>::value_type;
+    detail_::SoACoordinates<typename point_type::coord_type> soa(points);
+    return curve_order(soa, curve);
+}
+
+std::vector<std::size_t> inverse_permutation(
+  const std::vector<std::size_t>& p) {
+    detail_::check_permutation(p, p.size());
+    std::vector<std::size_t> rv(p.size());
+    for(size_type i = 0; i < p.size(); ++i) rv[p[i]] = i;
+    return rv;
+}
+
+#define INSTANTIATE(T)                                                         \
+    template std::vector<std::size_t> space_filling_curve_order(               \
+      const PointSet<T>&, SpaceFillingCurve);                                  \
+    template std::vector<std::size_t> space_filling_curve_order(               \
+      const PointSetView<PointSet<T>>&, SpaceFillingCurve);                    \
+    template std::vector<std::size_t> space_filling_curve_order(               \
+      const PointSetView<const PointSet<T>>&, SpaceFillingCurve)
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+
+#undef INSTANTIATE
+
+} // namespace chemist
@@ -0,0 +1,160 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "detail_/spatial_index_pimpl.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace chemist {
+
+#define TPARAMS template<typename T>
+#define SPATIAL_INDEX SpatialIndex<T>
+
+// -- Ctors, assignment, and dtor ----------------------------------------------
+
+TPARAMS
+SPATIAL_INDEX::SpatialIndex() noexcept = default;
+
+TPARAMS
+SPATIAL_INDEX::SpatialIndex(const point_set_type& points) :
+  m_pimpl_(std::make_unique<pimpl_type>(detail_::SoACoordinates<T>(points))) {
+}
+
+TPARAMS
+template<typename PointSetType>
+SPATIAL_INDEX::SpatialIndex(const PointSetView<PointSetType>& points) :
+  m_pimpl_(std::make_unique<pimpl_type>(detail_::SoACoordinates<T>(points))) {
+}
+
+TPARAMS
+SPATIAL_INDEX::SpatialIndex(const SpatialIndex& other) :
+  m_pimpl_(other.has_pimpl_() ? std::make_unique<pimpl_type>(*other.m_pimpl_) :
+                                nullptr) {}
+
+TPARAMS
+SPATIAL_INDEX::SpatialIndex(SpatialIndex&& other) noexcept = default;
+
+TPARAMS
+SPATIAL_INDEX& SPATIAL_INDEX::operator=(const SpatialIndex& rhs) {
+    SpatialIndex(rhs).m_pimpl_.swap(m_pimpl_);
+    return *this;
+}
+
+TPARAMS
+SPATIAL_INDEX& SPATIAL_INDEX::operator=(SpatialIndex&& rhs) noexcept =
+  default;
+
+TPARAMS
+SPATIAL_INDEX::~SpatialIndex() noexcept = default;
+
+// -- Incremental updates ------------------------------------------------------
+
+TPARAMS
+void SPATIAL_INDEX::update(const point_set_type& points,
+                           const index_list_type& changed) {
+    if(!has_pimpl_()) m_pimpl_ = std::make_unique<pimpl_type>();
+    m_pimpl_->update(detail_::SoACoordinates<T>(points), changed);
+}
+
+TPARAMS
+template<typename PointSetType>
+void SPATIAL_INDEX::update(const PointSetView<PointSetType>& points,
+                           const index_list_type& changed) {
+    if(!has_pimpl_()) m_pimpl_ = std::make_unique<pimpl_type>();
+    m_pimpl_->update(detail_::SoACoordinates<T>(points), changed);
+}
+
+TPARAMS
+void SPATIAL_INDEX::rebuild() {
+    if(has_pimpl_()) m_pimpl_->rebuild();
+}
+
+// -- Queries ------------------------------------------------------------------
+
+TPARAMS
+typename SPATIAL_INDEX::size_type SPATIAL_INDEX::size() const noexcept {
+    return has_pimpl_() ? m_pimpl_->size() : 0;
+}
+
+TPARAMS
+typename SPATIAL_INDEX::index_list_type SPATIAL_INDEX::radius_query(
+  const point_type& r, coord_type radius) const {
+    if(!has_pimpl_()) return index_list_type{};
+    return m_pimpl_->radius_query(r.x(), r.y(), r.z(), radius);
+}
+
+TPARAMS
+typename SPATIAL_INDEX::index_list_type SPATIAL_INDEX::nearest_neighbors(
+  const point_type& r, size_type k) const {
+    if(!has_pimpl_()) return index_list_type{};
+    return m_pimpl_->nearest_neighbors(r.x(), r.y(), r.z(), k);
+}
+
+TPARAMS
+typename SPATIAL_INDEX::batch_result_type SPATIAL_INDEX::radius_query(
+  const point_set_type& queries, coord_type radius) const {
+    if(!has_pimpl_()) return batch_result_type(queries.size());
+    return m_pimpl_->radius_query(detail_::SoACoordinates<T>(queries), radius);
+}
+
+TPARAMS
+typename SPATIAL_INDEX::batch_result_type SPATIAL_INDEX::nearest_neighbors(
+  const point_set_type& queries, size_type k) const {
+    if(!has_pimpl_()) return batch_result_type(queries.size());
+    return m_pimpl_->nearest_neighbors(detail_::SoACoordinates<T>(queries), k);
+}
+
+TPARAMS
+typename SPATIAL_INDEX::pair_list_type SPATIAL_INDEX::neighbor_pairs(
+  coord_type radius) const {
+    if(!has_pimpl_()) return pair_list_type{};
+    return m_pimpl_->neighbor_pairs(radius);
+}
+
+// -- Utility methods ----------------------------------------------------------
+
+TPARAMS
+void SPATIAL_INDEX::swap(SpatialIndex& other) noexcept {
+    m_pimpl_.swap(other.m_pimpl_);
+}
+
+// -- Private methods ----------------------------------------------------------
+
+TPARAMS
+bool SPATIAL_INDEX::has_pimpl_() const noexcept {
+    return static_cast<bool>(m_pimpl_);
+}
+
+#undef SPATIAL_INDEX
+#undef TPARAMS
+
+#define INSTANTIATE_VIEW(T, PointSetType)                                      \
+    template SpatialIndex<T>::SpatialIndex(const PointSetView<PointSetType>&); \
+    template void SpatialIndex<T>::update(                                     \
+      const PointSetView<PointSetType>&,                                       \
+      const typename SpatialIndex<T>::index_list_type&)
+
+INSTANTIATE_VIEW(float, PointSet<float>);
+INSTANTIATE_VIEW(float, const PointSet<float>);
+INSTANTIATE_VIEW(double, PointSet<double>);
+INSTANTIATE_VIEW(double, const PointSet<double>);
+
+#undef INSTANTIATE_VIEW
+
+template class SpatialIndex<float>;
+template class SpatialIndex<double>;
+
+} // namespace chemist
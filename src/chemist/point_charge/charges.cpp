@@ -33,6 +33,16 @@ CHARGES::Charges(std::initializer_list<value_type> qs) :
     for(const auto& x : qs) push_back(x);
 }
 
+TPARAMS
+CHARGES::Charges(point_set_type points, std::span<const charge_type> charges) :
+  m_pimpl_(std::make_unique<pimpl_type>(std::move(points), charges)) {}
+
+TPARAMS
+CHARGES::Charges(std::span<const coord_type> x, std::span<const coord_type> y,
+                 std::span<const coord_type> z,
+                 std::span<const charge_type> charges) :
+  Charges(point_set_type(x, y, z), charges) {}
+
 TPARAMS
 CHARGES::Charges(const Charges& other) :
   m_pimpl_(other.has_pimpl_() ? std::make_unique<pimpl_type>(*other.m_pimpl_) :
@@ -61,6 +71,36 @@ void CHARGES::push_back(value_type q) {
     m_pimpl_->push_back(std::move(q));
 }
 
+TPARAMS
+void CHARGES::reserve(size_type n) {
+    if(!has_pimpl_()) m_pimpl_ = std::make_unique<pimpl_type>();
+    m_pimpl_->reserve(n);
+}
+
+TPARAMS
+void CHARGES::permute(const permutation_type& p) {
+    detail_::check_permutation(p, this->size());
+    if(has_pimpl_()) m_pimpl_->permute(p);
+}
+
+TPARAMS
+typename CHARGES::permutation_type CHARGES::reorder(SpaceFillingCurve curve) {
+    if(!has_pimpl_()) return permutation_type{};
+    return m_pimpl_->reorder(curve);
+}
+
+TPARAMS
+void CHARGES::transform(const affine_type& f) noexcept {
+    if(has_pimpl_()) m_pimpl_->transform(f);
+}
+
+TPARAMS
+CHARGES CHARGES::transformed(const affine_type& f) const {
+    Charges rv(*this);
+    rv.transform(f);
+    return rv;
+}
+
 TPARAMS
 typename CHARGES::point_set_reference CHARGES::point_set() {
     return has_pimpl_() ? m_pimpl_->as_point_set() : point_set_reference{};
@@ -84,11 +124,6 @@ typename CHARGES::const_charge_pointer CHARGES::charge_data() const noexcept {
 
 // -- Private methods ---------------------------------------------------------
 
-TPARAMS
-CHARGES::Charges(point_set_type points, std::vector<charge_type> charges) :
-  m_pimpl_(
-    std::make_unique<pimpl_type>(std::move(points), std::move(charges))) {}
-
 TPARAMS typename CHARGES::reference CHARGES::at_(size_type i) {
     return (*m_pimpl_)[i];
 }
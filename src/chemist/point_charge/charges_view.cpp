@@ -15,6 +15,10 @@
  */
 
 #include "detail_/charges_contiguous.hpp"
+#include "detail_/charges_strided.hpp"
+#include "detail_/charges_subset.hpp"
+#include "detail_/charges_union.hpp"
+#include <stdexcept>
 #include <utility>
 
 namespace chemist {
@@ -38,6 +42,22 @@ CHARGES_VIEW::ChargesView(point_set_reference points, charge_pointer pcharges) :
   m_pimpl_(std::make_unique<detail_::ChargesContiguous<ChargesType>>(
     points, pcharges)) {}
 
+TPARAMS
+CHARGES_VIEW::ChargesView(point_set_reference points, charge_pointer pcharges,
+                          size_type stride) :
+  m_pimpl_(std::make_unique<detail_::ChargesStrided<ChargesType>>(
+    points, pcharges, stride)) {}
+
+TPARAMS
+CHARGES_VIEW::ChargesView(ChargesView supersystem, member_list_type members) :
+  m_pimpl_(std::make_unique<detail_::ChargesSubset<ChargesType>>(
+    std::move(supersystem), std::move(members))) {}
+
+TPARAMS
+CHARGES_VIEW::ChargesView(charges_view_container members) :
+  m_pimpl_(std::make_unique<detail_::ChargesUnion<ChargesType>>(
+    std::move(members))) {}
+
 TPARAMS
 CHARGES_VIEW::ChargesView(const ChargesView& other) :
   m_pimpl_(other.clone_pimpl_()) {}
@@ -69,6 +89,17 @@ typename CHARGES_VIEW::const_point_set_reference CHARGES_VIEW::point_set()
                           const_point_set_reference{};
 }
 
+TPARAMS
+typename CHARGES_VIEW::charges_type CHARGES_VIEW::as_charges() const {
+    return this->empty() ? charges_type{} : m_pimpl_->as_charges();
+}
+
+TPARAMS
+bool CHARGES_VIEW::is_contiguous() const noexcept {
+    if(this->empty()) return true;
+    return m_pimpl_->charge_data() != nullptr && point_set().is_contiguous();
+}
+
 TPARAMS
 bool CHARGES_VIEW::operator==(const ChargesView& rhs) const noexcept {
     if(this->empty() != rhs.empty()) return false;
@@ -113,6 +144,14 @@ typename CHARGES_VIEW::size_type CHARGES_VIEW::size_() const noexcept {
     return has_pimpl_() ? m_pimpl_->size() : 0;
 }
 
+TPARAMS
+typename CHARGES_VIEW::charge_pointer CHARGES_VIEW::charge_column_data_()
+  const {
+    if(!is_contiguous())
+        throw std::runtime_error("The aliased charges are not contiguous");
+    return this->empty() ? nullptr : m_pimpl_->charge_data();
+}
+
 #undef CHARGES_VIEW
 #undef TPARAMS
 
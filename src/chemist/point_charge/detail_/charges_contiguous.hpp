@@ -142,6 +142,11 @@ protected:
     /// Defers to the PointSet piece of *this for the number of point charges
     size_type size_() const noexcept override { return m_points_.size(); }
 
+    /// The charges are contiguous by construction
+    charge_pointer charge_data_() const noexcept override {
+        return m_pcharges_;
+    }
+
     /// Calls the base class's are_equal_impl_ to implement are_equal
     bool are_equal_(const base_type& rhs) const noexcept override {
         return base_type::template are_equal_impl_<my_type>(rhs);
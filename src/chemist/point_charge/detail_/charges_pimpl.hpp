@@ -15,8 +15,14 @@
  */
 
 #pragma once
+#include <chemist/detail_/aligned_array.hpp>
+#include <chemist/detail_/permutation.hpp>
 #include <chemist/point/point_set.hpp>
+#include <chemist/point/space_filling_curve.hpp>
 #include <chemist/point_charge/charges.hpp>
+#include <memory>
+#include <span>
+#include <stdexcept>
 #include <vector>
 
 namespace chemist::detail_ {
@@ -25,7 +31,9 @@ namespace chemist::detail_ {
  *
  *  Charges is a set of PointCharges. Each PointCharge is a charge and a
  *  point. This class unpacks the charges into a contiguous array, and then
- *  unpacks the point part into a PointSet.
+ *  unpacks the point part into a PointSet. The charge array is stored the
+ *  same way as the PointSet's coordinate arrays (aligned and zero-padded) so
+ *  that loops over charges and coordinates can share bounds.
  *
  *  @tparam T The floating point type used to hold the point charge's charge.
  *            Assumed to be either float or double.
@@ -53,6 +61,8 @@ public:
     using charge_pointer       = typename parent_type::charge_pointer;
     using const_charge_pointer = typename parent_type::const_charge_pointer;
     using size_type            = typename parent_type::size_type;
+    using permutation_type     = typename parent_type::permutation_type;
+    using affine_type          = typename parent_type::affine_type;
     ///@}
 
     /// The type used to store the charge
@@ -62,8 +72,35 @@ public:
     ChargesPIMPL() = default;
 
     /// Create a Charges object from a set of points and their charges
-    ChargesPIMPL(point_set_type points, std::vector<charge_type> charges) :
-      m_points_(std::move(points)), m_charges_(std::move(charges)) {}
+    ChargesPIMPL(point_set_type points, std::span<const charge_type> charges) :
+      m_points_(std::move(points)), m_charges_(charges) {
+        if(m_points_.size() == m_charges_.size()) return;
+        throw std::runtime_error("Must have one charge per point");
+    }
+
+    /// Implements reserve
+    void reserve(size_type n) {
+        m_points_.reserve(n);
+        m_charges_.reserve(n);
+    }
+
+    /// Implements permute, assumes @p p has been checked
+    void permute(const permutation_type& p) {
+        AlignedArray<charge_type> charges(m_charges_);
+        apply_permutation(charges, p);
+        m_points_.permute(p);
+        m_charges_ = std::move(charges);
+    }
+
+    /// Implements reorder
+    permutation_type reorder(SpaceFillingCurve curve) {
+        auto p = space_filling_curve_order(m_points_, curve);
+        permute(p);
+        return p;
+    }
+
+    /// Implements transform
+    void transform(const affine_type& f) noexcept { m_points_.transform(f); }
 
     /// Implements push_back
     void push_back(value_type q) {
@@ -95,10 +132,18 @@ public:
     }
 
     /// Retrieves a mutable pointer to the first charge
-    charge_pointer charge_data() { return m_charges_.data(); }
+    charge_pointer charge_data() {
+        return size() != 0 ? std::assume_aligned<simd_alignment>(
+                               m_charges_.data()) :
+                             nullptr;
+    }
 
     /// Retrieves a read-only pointer to the first charge
-    const_charge_pointer charge_data() const { return m_charges_.data(); }
+    const_charge_pointer charge_data() const {
+        return size() != 0 ? std::assume_aligned<simd_alignment>(
+                               m_charges_.data()) :
+                             nullptr;
+    }
 
     /// Implements comparisons for Charges
     bool operator==(const ChargesPIMPL& rhs) const {
@@ -111,7 +156,7 @@ private:
     point_set_type m_points_;
 
     /// The charges of each point charge
-    std::vector<charge_type> m_charges_;
+    AlignedArray<charge_type> m_charges_;
 };
 
 } // namespace chemist::detail_
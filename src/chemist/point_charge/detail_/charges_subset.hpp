@@ -0,0 +1,186 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "../../detail_/gather.hpp"
+#include "charges_view_pimpl.hpp"
+#include <vector>
+
+namespace chemist::detail_ {
+
+/** @brief Implements a ChargesView that is a subset of another Charges object.
+ *
+ *  This PIMPL is the Charges analog of NucleiSubset. It stores a view of the
+ *  supersystem and the indices of the point charges in *this, e.g., the
+ *  embedding charges near a fragment can be selected out of a large set of
+ *  charges without copying them. The PointSet piece of *this is the
+ *  corresponding subset of the supersystem's PointSet piece.
+ *
+ *  @tparam ChargesType the type *this is acting like it aliases.
+ */
+template<typename ChargesType>
+class ChargesSubset : public ChargesViewPIMPL<ChargesType> {
+private:
+    /// Type of *this
+    using my_type = ChargesSubset<ChargesType>;
+
+    /// Type of the base class
+    using base_type = ChargesViewPIMPL<ChargesType>;
+
+public:
+    /// Type of a mutable view of a point charge
+    using typename base_type::reference;
+
+    /// Type of a read-only view of a point charge
+    using typename base_type::const_reference;
+
+    /// Type of a pointer to the base of *this
+    using typename base_type::pimpl_pointer;
+
+    /// Type of a mutable reference to the PointSet piece of *this
+    using typename base_type::point_set_reference;
+
+    /// Type of a read-only reference to the PointSet piece of *this
+    using typename base_type::const_point_set_reference;
+
+    /// Type used for indexing and offsets
+    using typename base_type::size_type;
+
+    /// Type of the owning container *this can be copied to
+    using typename base_type::charges_type;
+
+    /// Type of a charge, without cv-qualifiers
+    using typename base_type::charge_type;
+
+    /// Type of a view of the supersystem
+    using charges_view_type = ChargesView<ChargesType>;
+
+    /// Type used to hold the indices of the point charges in *this
+    using member_list_type = typename charges_view_type::member_list_type;
+
+    /// Makes a null subset
+    ChargesSubset() = default;
+
+    /** @brief Creates a view which is a subset of @p supersystem
+     *
+     *  @param[in] supersystem A view which aliases the supersystem.
+     *  @param[in] members Which point charges in @p supersystem should be
+     *                     included in the subset. Values in @p members should
+     *                     be in the range [0, supersystem.size()).
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the PointSet
+     *                        piece of *this. Strong throw guarantee.
+     */
+    ChargesSubset(charges_view_type supersystem, member_list_type members) :
+      m_points_(supersystem.point_set(), members),
+      m_charges_(std::move(supersystem)),
+      m_members_(std::move(members)) {}
+
+    /** @brief Makes a shallow copy of another ChargesSubset
+     *
+     *  The indices are deep copied, but the supersystem is aliased.
+     *
+     *  @param[in] other The instance to copy.
+     *
+     *  @throw std::bad_alloc if there is a problem copying the indices. Strong
+     *                        throw guarantee.
+     */
+    ChargesSubset(const ChargesSubset& other) = default;
+
+    /** @brief Compares two ChargesSubset objects for equality.
+     *
+     *  Like the other PIMPLs this compares the aliased point charges. They
+     *  are compared one by one, even if the supersystems are the same: the
+     *  supersystem may contain duplicate point charges, so different indices
+     *  do not imply different values, and comparing the supersystems would
+     *  cost time proportional to their size rather than the size of *this.
+     *
+     *  @param[in] rhs The object we compare to.
+     *
+     *  @return True if *this compares equal to @p rhs and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool operator==(const ChargesSubset& rhs) const noexcept;
+
+protected:
+    /// Simply calls the copy ctor
+    pimpl_pointer clone_() const override {
+        return std::make_unique<my_type>(*this);
+    }
+
+    /// Returns the member of the supersystem
+    reference at_(size_type i) noexcept override {
+        return m_charges_[m_members_[i]];
+    }
+
+    /// Returns the member of the supersystem, read-only
+    const_reference at_(size_type i) const noexcept override {
+        return std::as_const(m_charges_)[m_members_[i]];
+    }
+
+    /// Returns the subset of the supersystem's PointSet
+    point_set_reference point_set_() noexcept override { return m_points_; }
+
+    /// Returns a read-only view of the subset of the supersystem's PointSet
+    const_point_set_reference point_set_() const noexcept override {
+        return m_points_;
+    }
+
+    /// The number of members
+    size_type size_() const noexcept override { return m_members_.size(); }
+
+    /// Gathers the members straight from the supersystem's columns if it can
+    charges_type as_charges_() const override {
+        if(m_charges_.empty() || !m_charges_.is_contiguous())
+            return base_type::as_charges_();
+
+        std::vector<charge_type> qs(m_members_.size());
+        gather(m_charges_.charge_column().data(), m_members_, qs.data());
+        return charges_type(m_points_.as_point_set(), qs);
+    }
+
+    /// Calls the base class's are_equal_impl_ to implement are_equal
+    bool are_equal_(const base_type& rhs) const noexcept override {
+        return base_type::template are_equal_impl_<my_type>(rhs);
+    }
+
+private:
+    /// The subset of the supersystem's PointSet
+    point_set_reference m_points_;
+
+    /// The supersystem
+    charges_view_type m_charges_;
+
+    /// The indices in *this
+    member_list_type m_members_;
+};
+
+// -----------------------------------------------------------------------------
+// -- Out of line definitions
+// -----------------------------------------------------------------------------
+
+template<typename ChargesType>
+bool ChargesSubset<ChargesType>::operator==(
+  const ChargesSubset& rhs) const noexcept {
+    if(size_() != rhs.size()) return false;
+    for(size_type i = 0; i < size_(); ++i)
+        if((*this)[i] != rhs[i]) return false;
+
+    return true;
+}
+
+} // namespace chemist::detail_
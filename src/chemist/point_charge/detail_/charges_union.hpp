@@ -0,0 +1,222 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "charges_view_pimpl.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace chemist::detail_ {
+
+/** @brief Implements a ChargesView that is a union of ChargesView objects.
+ *
+ *  This PIMPL is the Charges analog of NucleiUnion. It allows one or more
+ *  ChargesView objects, e.g., several MM regions, to be used as a single
+ *  ChargesView without copying the aliased point charges. The PointSet piece
+ *  of *this is the union of the PointSet pieces of the views. The views in
+ *  the union can not change after construction, so *this caches the offset
+ *  of each view's first point charge and retrieving a point charge is a
+ *  binary search over the views.
+ *
+ *  @warning Like NucleiUnion, the resulting union can contain duplicates.
+ *
+ *  @tparam ChargesType the type *this is acting like it aliases.
+ */
+template<typename ChargesType>
+class ChargesUnion : public ChargesViewPIMPL<ChargesType> {
+private:
+    /// Type of *this
+    using my_type = ChargesUnion<ChargesType>;
+
+    /// Type of the base class
+    using base_type = ChargesViewPIMPL<ChargesType>;
+
+public:
+    /// Type of a mutable view of a point charge
+    using typename base_type::reference;
+
+    /// Type of a read-only view of a point charge
+    using typename base_type::const_reference;
+
+    /// Type of a pointer to the base of *this
+    using typename base_type::pimpl_pointer;
+
+    /// Type of a mutable reference to the PointSet piece of *this
+    using typename base_type::point_set_reference;
+
+    /// Type of a read-only reference to the PointSet piece of *this
+    using typename base_type::const_point_set_reference;
+
+    /// Type used for indexing and offsets
+    using typename base_type::size_type;
+
+    /// Type of the owning container *this can be copied to
+    using typename base_type::charges_type;
+
+    /// Type of a charge, without cv-qualifiers
+    using typename base_type::charge_type;
+
+    /// Type of a container filled with ChargesView objects
+    using charges_view_container =
+      typename ChargesView<ChargesType>::charges_view_container;
+
+    /// Makes an empty union
+    ChargesUnion() = default;
+
+    /** @brief Aliases the union of the Charges objects aliased by @p charges.
+     *
+     *  The i-th point charge of *this is the i-th point charge of the views
+     *  in @p charges, taken in order.
+     *
+     *  @param[in] charges The aliased Charges objects to form the members of
+     *                     *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the PointSet
+     *                        piece or the offsets. Strong throw guarantee.
+     */
+    explicit ChargesUnion(charges_view_container charges) :
+      m_points_(points_(charges)),
+      m_charges_(std::move(charges)),
+      m_offsets_(m_charges_.size() + 1, 0) {
+        for(size_type j = 0; j < m_charges_.size(); ++j)
+            m_offsets_[j + 1] = m_offsets_[j] + m_charges_[j].size();
+    }
+
+    /** @brief Makes a shallow copy of another ChargesUnion
+     *
+     *  The views are copied, but continue to alias the same point charges.
+     *
+     *  @param[in] other The instance to copy.
+     *
+     *  @throw std::bad_alloc if there is a problem copying the views. Strong
+     *                        throw guarantee.
+     */
+    ChargesUnion(const ChargesUnion& other) = default;
+
+    /** @brief Compares two ChargesUnion objects for equality.
+     *
+     *  Like the other PIMPLs this compares the aliased point charges, not how
+     *  they are partitioned among the views in the union.
+     *
+     *  @param[in] rhs The object we compare to.
+     *
+     *  @return True if *this compares equal to @p rhs and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool operator==(const ChargesUnion& rhs) const noexcept;
+
+protected:
+    /// Simply calls the copy ctor
+    pimpl_pointer clone_() const override {
+        return std::make_unique<my_type>(*this);
+    }
+
+    /// Finds the view holding point charge @p i and returns it
+    reference at_(size_type i) noexcept override {
+        const auto j = view_index_(i);
+        return m_charges_[j][i - m_offsets_[j]];
+    }
+
+    /// Finds the view holding point charge @p i and returns it, read-only
+    const_reference at_(size_type i) const noexcept override {
+        const auto j = view_index_(i);
+        return std::as_const(m_charges_[j])[i - m_offsets_[j]];
+    }
+
+    /// Returns the union of the views' PointSet pieces
+    point_set_reference point_set_() noexcept override { return m_points_; }
+
+    /// Returns a read-only view of the union of the views' PointSet pieces
+    const_point_set_reference point_set_() const noexcept override {
+        return m_points_;
+    }
+
+    size_type size_() const noexcept override {
+        // Default constructed unions have no offsets
+        return m_offsets_.empty() ? 0 : m_offsets_.back();
+    }
+
+    /// Copies each view's charges into the column, in bulk when possible
+    charges_type as_charges_() const override;
+
+    /// Calls the base class's are_equal_impl_ to implement are_equal
+    bool are_equal_(const base_type& rhs) const noexcept override {
+        return base_type::template are_equal_impl_<my_type>(rhs);
+    }
+
+private:
+    /// Returns the union of the PointSet pieces of @p charges
+    static point_set_reference points_(charges_view_container& charges) {
+        typename point_set_reference::point_set_view_container points;
+        points.reserve(charges.size());
+        for(auto& qs : charges) points.push_back(qs.point_set());
+        return point_set_reference(std::move(points));
+    }
+
+    /// Returns the index of the view holding point charge @p i
+    size_type view_index_(size_type i) const noexcept {
+        // The first offset greater than i is one past the view holding i
+        auto itr = std::upper_bound(m_offsets_.begin(), m_offsets_.end(), i);
+        return (itr - m_offsets_.begin()) - 1;
+    }
+
+    /// The union of the PointSet pieces of m_charges_
+    point_set_reference m_points_;
+
+    /// The views whose union is *this
+    charges_view_container m_charges_;
+
+    /// Element j is the index of m_charges_[j][0], last element is the size
+    std::vector<size_type> m_offsets_;
+};
+
+// -----------------------------------------------------------------------------
+// -- Out of line definitions
+// -----------------------------------------------------------------------------
+
+template<typename ChargesType>
+bool ChargesUnion<ChargesType>::operator==(
+  const ChargesUnion& rhs) const noexcept {
+    if(size_() != rhs.size()) return false;
+    if(size_() == 0) return true;
+
+    for(size_type i = 0; i < size_(); ++i)
+        if((*this)[i] != rhs[i]) return false;
+
+    return true;
+}
+
+template<typename ChargesType>
+typename ChargesUnion<ChargesType>::charges_type
+ChargesUnion<ChargesType>::as_charges_() const {
+    std::vector<charge_type> qs(size_());
+    for(size_type j = 0; j < m_charges_.size(); ++j) {
+        const auto& view  = m_charges_[j];
+        const auto offset = m_offsets_[j];
+        if(view.empty()) continue;
+        if(view.is_contiguous()) {
+            const auto column = view.charge_column();
+            std::copy(column.begin(), column.end(), qs.begin() + offset);
+            continue;
+        }
+        for(size_type i = 0; i < view.size(); ++i)
+            qs[offset + i] = view[i].charge();
+    }
+    return charges_type(m_points_.as_point_set(), qs);
+}
+
+} // namespace chemist::detail_
@@ -17,6 +17,8 @@
 #pragma once
 #include <cassert>
 #include <chemist/point_charge/charges_view.hpp>
+#include <span>
+#include <vector>
 
 namespace chemist::detail_ {
 
@@ -57,6 +59,15 @@ public:
     using const_point_set_reference =
       typename parent_type::const_point_set_reference;
 
+    /// Type of a pointer to a charge
+    using charge_pointer = typename parent_type::charge_pointer;
+
+    /// Type of the owning container *this can be copied to
+    using charges_type = typename parent_type::charges_type;
+
+    /// Type of a charge, without cv-qualifiers
+    using charge_type = typename charges_type::charge_type;
+
     /// Type used for indexing and offsets
     using size_type = typename parent_type::size_type;
 
@@ -126,6 +137,13 @@ public:
     /// The number of point charges in *this, implemented by size_
     size_type size() const noexcept { return size_(); }
 
+    /// Address of the first charge if the charges are contiguous, otherwise
+    /// a null pointer. Implemented by charge_data_
+    charge_pointer charge_data() const noexcept { return charge_data_(); }
+
+    /// Copies the aliased point charges into a new Charges object
+    charges_type as_charges() const { return as_charges_(); }
+
     /// Polymorphic value comparison, implemented by are_equal_
     bool are_equal(const ChargesViewPIMPL& rhs) const noexcept {
         return are_equal_(rhs);
@@ -154,6 +172,12 @@ protected:
     /// Derived class should override to implement size
     virtual size_type size_() const noexcept = 0;
 
+    /// Derived class may override if its charges are contiguous
+    virtual charge_pointer charge_data_() const noexcept { return nullptr; }
+
+    /// Derived class may override if it can copy faster than one at a time
+    virtual charges_type as_charges_() const;
+
     /// Derived class should implement by calling are_equal_impl_
     virtual bool are_equal_(const ChargesViewPIMPL& rhs) const noexcept = 0;
 };
@@ -162,6 +186,20 @@ protected:
 // -- Out of line definitions
 // -----------------------------------------------------------------------------
 
+template<typename ChargesType>
+typename ChargesViewPIMPL<ChargesType>::charges_type
+ChargesViewPIMPL<ChargesType>::as_charges_() const {
+    const auto n = size_();
+    auto points  = point_set_().as_point_set();
+    if(auto pq = charge_data_(); pq != nullptr)
+        return charges_type(std::move(points),
+                            std::span<const charge_type>(pq, n));
+
+    std::vector<charge_type> qs(n);
+    for(size_type i = 0; i < n; ++i) qs[i] = at_(i).charge();
+    return charges_type(std::move(points), qs);
+}
+
 template<typename ChargesType>
 template<typename DerivedType>
 bool ChargesViewPIMPL<ChargesType>::are_equal_impl_(
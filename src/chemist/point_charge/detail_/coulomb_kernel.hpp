@@ -0,0 +1,127 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "../../point/detail_/soa_coordinates.hpp"
+#include <chemist/point_charge/charges.hpp>
+#include <chemist/point_charge/charges_view.hpp>
+#include <cmath>
+#include <vector>
+
+namespace chemist::detail_ {
+
+/** @brief Read-only structure-of-arrays view of a set of point charges.
+ *
+ *  This is SoACoordinates plus a pointer to the charges. Charges objects and
+ *  contiguous ChargesView objects are wrapped, other ChargesView objects have
+ *  their charges gathered into a buffer owned by *this.
+ *
+ *  @tparam T The floating-point type of the charges and coordinates.
+ */
+template<typename T>
+class SoACharges {
+public:
+    /// Type used for indexing and offsets
+    using size_type = std::size_t;
+
+    /// Wraps the arrays of @p charges, no copy is made
+    explicit SoACharges(const Charges<T>& charges) :
+      m_points_(charges.point_set()), m_pq_(charges.charge_data()) {}
+
+    /// Wraps the state aliased by @p charges if it is contiguous, otherwise
+    /// gathers it into *this
+    template<typename ChargesType>
+    explicit SoACharges(const ChargesView<ChargesType>& charges) :
+      m_points_(charges.point_set()) {
+        if(charges.is_contiguous()) {
+            m_pq_ = charges.charge_column().data();
+            return;
+        }
+        m_buffer_.reserve(charges.size());
+        for(const auto& q : charges) m_buffer_.push_back(q.charge());
+        m_pq_ = m_buffer_.data();
+    }
+
+    /// Copying would leave the pointers aliasing the original buffers
+    SoACharges(const SoACharges&) = delete;
+
+    /// Number of point charges
+    size_type size() const noexcept { return m_points_.size(); }
+
+    /// The coordinates of the charges
+    const SoACoordinates<T>& points() const noexcept { return m_points_; }
+
+    /// Pointer to the first charge
+    const T* q() const noexcept { return m_pq_; }
+
+private:
+    /// The coordinates of the charges
+    SoACoordinates<T> m_points_;
+
+    /// Storage for gathered charges (empty if the charges are wrapped)
+    std::vector<T> m_buffer_;
+
+    /// Pointer to the first charge
+    const T* m_pq_ = nullptr;
+};
+
+/** @brief Adds the potential, and optionally the field, of charges
+ *         [@p j_begin, @p j_end) at the point (@p x, @p y, @p z).
+ *
+ *  This is the innermost loop of every direct Coulomb sum in Chemist and is
+ *  written so that it vectorizes. Charges further than the cutoff are
+ *  skipped, as are charges at zero (smoothed) distance, with selects rather
+ *  than branches.
+ *
+ *  @tparam ComputeField If false @p fx, @p fy, and @p fz are not touched.
+ *
+ *  @param[in] rc2 The square of the cutoff.
+ *  @param[in] a2 The square of the softening length.
+ *  @param[in,out] v The potential, incremented by this call.
+ *  @param[in,out] fx The x-component of the field, incremented by this call.
+ */
+template<bool ComputeField, typename T>
+inline void coulomb_sum(T x, T y, T z, const T* qx, const T* qy, const T* qz,
+                        const T* q, std::size_t j_begin, std::size_t j_end,
+                        T rc2, T a2, T& v, T& fx, T& fy, T& fz) noexcept {
+    T v_ = 0, fx_ = 0, fy_ = 0, fz_ = 0;
+#pragma omp simd reduction(+ : v_, fx_, fy_, fz_)
+    for(std::size_t j = j_begin; j < j_end; ++j) {
+        const T dx     = x - qx[j];
+        const T dy     = y - qy[j];
+        const T dz     = z - qz[j];
+        const T r2     = dx * dx + dy * dy + dz * dz;
+        const T s2     = r2 + a2;
+        const bool use = r2 <= rc2 && s2 > T(0);
+        const T inv    = T(1) / std::sqrt(use ? s2 : T(1));
+        const T qinv   = use ? q[j] * inv : T(0);
+        v_ += qinv;
+        if constexpr(ComputeField) {
+            const T qinv3 = qinv * inv * inv;
+            fx_ += qinv3 * dx;
+            fy_ += qinv3 * dy;
+            fz_ += qinv3 * dz;
+        }
+    }
+    v += v_;
+    if constexpr(ComputeField) {
+        fx += fx_;
+        fy += fy_;
+        fz += fz_;
+    }
+}
+
+} // namespace chemist::detail_
@@ -0,0 +1,489 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "coulomb_kernel.hpp"
+#include <algorithm>
+#include <array>
+#include <chemist/point_charge/multipole_tree.hpp>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace chemist::detail_ {
+
+/** @brief Implements MultipoleTree with an octree of Cartesian multipoles.
+ *
+ *  Each node is split into (up to) eight children at the center of its
+ *  bounding box. The nodes are stored in breadth-first order and the children
+ *  of a node are consecutive. The charges are stored in tree order, so the
+ *  charges of every node are the contiguous range [begin, end).
+ *
+ *  For a node centered at @f$\mathbf{c}@f$ and a target at
+ *  @f$\mathbf{R} = \mathbf{r} - \mathbf{c}@f$, Taylor expanding
+ *  @f$1/|\mathbf{R} - \mathbf{d}_j|@f$ in
+ *  @f$\mathbf{d}_j = \mathbf{r}_j - \mathbf{c}@f$ gives:
+ *
+ *  @f[
+ *    \phi(\mathbf{r}) \approx \sum_{|n| \le p} M_n T_n(\mathbf{R}), \qquad
+ *    M_n = \sum_j q_j \frac{(-\mathbf{d}_j)^n}{n!}, \qquad
+ *    T_n(\mathbf{R}) = \partial^n \frac{1}{|\mathbf{R}|}
+ *  @f]
+ *
+ *  where @f$n = (t, u, v)@f$ is a multi-index. The field is
+ *  @f$E_k = -\sum_n M_n T_{n + e_k}@f$, so it needs the derivatives through
+ *  order @f$p + 1@f$. The derivatives are computed with the
+ *  McMurchie-Davidson recursion (the Boys functions of the Hermite Coulomb
+ *  integrals become @f$(-1)^m(2m-1)!!/R^{2m+1}@f$ for point charges):
+ *
+ *  @f[
+ *    R^{(m)}_{t+1,u,v} = t R^{(m+1)}_{t-1,u,v} + X R^{(m+1)}_{t,u,v}
+ *  @f]
+ *
+ *  and @f$T_n = R^{(0)}_n@f$. Multi-indices are stored ordered by total
+ *  degree, so the multi-indices with @f$|n| \le l@f$ are the first
+ *  n_terms_(l) of them.
+ *
+ *  @tparam T The floating-point type of the charges and coordinates.
+ */
+template<typename T>
+class MultipoleTreePIMPL {
+public:
+    /// Type *this implements
+    using parent_type = MultipoleTree<T>;
+
+    /// Reuse parent's types
+    ///@{
+    using size_type   = typename parent_type::size_type;
+    using result_type = typename parent_type::result_type;
+    ///@}
+
+    /// Type of the charges passed to *this
+    using charges_type = SoACharges<T>;
+
+    /// Type of the target points passed to *this
+    using coordinates_type = SoACoordinates<T>;
+
+    /// Nodes this deep are not split (guards against coincident charges)
+    static constexpr size_type max_depth = 21;
+
+    /// Number of charges (or charge-target pairs) below which work is not
+    /// threaded
+    static constexpr size_type parallel_threshold = size_type(1) << 16;
+
+    /// Implements building a MultipoleTree
+    MultipoleTreePIMPL(const charges_type& charges, size_type order, T theta,
+                       size_type leaf_size) :
+      m_order_(order), m_theta_(theta) {
+        if(!(theta >= T(0) && theta < T(1)))
+            throw std::runtime_error("Opening angle must be in [0, 1)");
+        if(leaf_size == 0)
+            throw std::runtime_error("Leaf size must be positive");
+        const auto n       = charges.size();
+        const auto& points = charges.points();
+        m_x_.assign(points.x(), points.x() + n);
+        m_y_.assign(points.y(), points.y() + n);
+        m_z_.assign(points.z(), points.z() + n);
+        m_q_.assign(charges.q(), charges.q() + n);
+        build_terms_();
+        build_tree_(leaf_size);
+        build_moments_();
+    }
+
+    /// Implements MultipoleTree::size
+    size_type size() const noexcept { return m_q_.size(); }
+
+    /// Implements MultipoleTree::order
+    size_type order() const noexcept { return m_order_; }
+
+    /// Implements MultipoleTree::theta
+    T theta() const noexcept { return m_theta_; }
+
+    /// Implements MultipoleTree::error_bound
+    T error_bound() const noexcept {
+        const T t = m_theta_;
+        return (T(1) + t) * std::pow(t, T(m_order_ + 1)) / (T(1) - t);
+    }
+
+    /// Implements MultipoleTree::potential
+    result_type potential(const coordinates_type& points) const {
+        result_type rv(points.size(), T(0));
+        T* const phi = rv.data();
+        evaluate_<false>(points, phi, phi, phi, phi);
+        return rv;
+    }
+
+    /// Implements MultipoleTree::field
+    result_type field(const coordinates_type& points) const {
+        const size_type n = points.size();
+        std::vector<T> phi(n, T(0));
+        result_type rv(3 * n, T(0));
+        auto* const ex = rv.data();
+        evaluate_<true>(points, phi.data(), ex, ex + n, ex + 2 * n);
+        return rv;
+    }
+
+private:
+    /// A node of the tree
+    struct Node {
+        /// The point the multipoles are expanded about
+        std::array<T, 3> center;
+
+        /// Distance from center to the node's furthest charge
+        T radius;
+
+        /// The charges in the node are [begin, end) in tree order
+        size_type begin;
+        size_type end;
+
+        /// The children are [first_child, first_child + n_children)
+        size_type first_child;
+        size_type n_children;
+
+        bool is_leaf() const noexcept { return n_children == 0; }
+    };
+
+    /// A multi-index and how it is reached from lower degrees
+    struct Term {
+        /// The multi-index (t, u, v)
+        std::array<size_type, 3> n;
+
+        /// The direction, k, the recursion steps along
+        size_type k;
+
+        /// Index of n - e_k
+        size_type parent;
+
+        /// Index of n - 2e_k (0, with a zero coefficient, if n_k < 2)
+        size_type grandparent;
+
+        /// n_k - 1, the coefficient of the grandparent
+        T coef;
+
+        /// 1 / n_k, used to build up the 1 / n! of the moments
+        T inv;
+    };
+
+    /// Number of multi-indices with total degree at most @p l
+    static size_type n_terms_(size_type l) noexcept {
+        return (l + 1) * (l + 2) * (l + 3) / 6;
+    }
+
+    /// Fills m_terms_ and m_raise_
+    void build_terms_();
+
+    /// Sorts the charges into the octree
+    void build_tree_(size_type leaf_size);
+
+    /// Computes the multipoles of every node
+    void build_moments_();
+
+    /** @brief Computes @f$T_n(\mathbf{R})@f$ for @f$|n| \le l@f$.
+     *
+     *  @param[in] work A buffer of at least l + 1 + 2 * n_terms_(l) elements.
+     *
+     *  @return A pointer (into @p work) to the n_terms_(l) derivatives.
+     */
+    const T* derivatives_(T x, T y, T z, size_type l, T* work) const noexcept;
+
+    /// Writes the potential, and if ComputeField the field, at @p points
+    template<bool ComputeField>
+    void evaluate_(const coordinates_type& points, T* phi, T* ex, T* ey,
+                   T* ez) const;
+
+    /// The order of the expansions
+    size_type m_order_;
+
+    /// The opening angle
+    T m_theta_;
+
+    /// The charges and their coordinates, in tree order
+    ///@{
+    std::vector<T> m_x_;
+    std::vector<T> m_y_;
+    std::vector<T> m_z_;
+    std::vector<T> m_q_;
+    ///@}
+
+    /// The nodes of the tree in breadth-first order, node 0 is the root
+    std::vector<Node> m_nodes_;
+
+    /// The multi-indices through degree m_order_ + 1
+    std::vector<Term> m_terms_;
+
+    /// m_raise_[i][k] is the index of m_terms_[i].n + e_k
+    std::vector<std::array<size_type, 3>> m_raise_;
+
+    /// The n_terms_(m_order_) multipoles of node i start at element
+    /// i * n_terms_(m_order_)
+    std::vector<T> m_moments_;
+};
+
+// -----------------------------------------------------------------------------
+// -- Out of line implementations
+// -----------------------------------------------------------------------------
+
+template<typename T>
+void MultipoleTreePIMPL<T>::build_terms_() {
+    const size_type l  = m_order_ + 1;
+    const size_type l1 = l + 1;
+    std::vector<size_type> index(l1 * l1 * l1, 0);
+    auto at = [&](const std::array<size_type, 3>& n) -> size_type& {
+        return index[(n[0] * l1 + n[1]) * l1 + n[2]];
+    };
+
+    m_terms_.clear();
+    m_terms_.reserve(n_terms_(l));
+    for(size_type deg = 0; deg <= l; ++deg) {
+        for(size_type t = deg + 1; t-- > 0;) {
+            for(size_type u = deg - t + 1; u-- > 0;) {
+                Term term{{t, u, deg - t - u}, 0, 0, 0, T(0), T(0)};
+                at(term.n) = m_terms_.size();
+                if(deg > 0) {
+                    while(term.n[term.k] == 0) ++term.k;
+                    const auto nk = term.n[term.k];
+                    auto p        = term.n;
+                    --p[term.k];
+                    term.parent = at(p);
+                    if(nk > 1) {
+                        --p[term.k];
+                        term.grandparent = at(p);
+                    }
+                    term.coef = T(nk - 1);
+                    term.inv  = T(1) / T(nk);
+                }
+                m_terms_.push_back(term);
+            }
+        }
+    }
+
+    m_raise_.resize(n_terms_(m_order_));
+    for(size_type i = 0; i < m_raise_.size(); ++i) {
+        for(size_type k = 0; k < 3; ++k) {
+            auto n = m_terms_[i].n;
+            ++n[k];
+            m_raise_[i][k] = at(n);
+        }
+    }
+}
+
+template<typename T>
+void MultipoleTreePIMPL<T>::build_tree_(size_type leaf_size) {
+    const size_type n = size();
+    m_nodes_.clear();
+    if(n == 0) return;
+
+    std::vector<size_type> index(n);
+    std::iota(index.begin(), index.end(), size_type{0});
+    std::vector<size_type> buffer(n);
+    std::vector<size_type> depth{0};
+    m_nodes_.push_back(Node{{}, T(0), 0, n, 0, 0});
+
+    // Appending children while sweeping the nodes builds them breadth-first
+    for(size_type node = 0; node < m_nodes_.size(); ++node) {
+        const size_type begin = m_nodes_[node].begin;
+        const size_type end   = m_nodes_[node].end;
+
+        std::array<T, 3> lo, hi;
+        lo.fill(std::numeric_limits<T>::max());
+        hi.fill(std::numeric_limits<T>::lowest());
+        for(size_type p = begin; p < end; ++p) {
+            const std::array<T, 3> r{m_x_[index[p]], m_y_[index[p]],
+                                     m_z_[index[p]]};
+            for(size_type q = 0; q < 3; ++q) {
+                lo[q] = std::min(lo[q], r[q]);
+                hi[q] = std::max(hi[q], r[q]);
+            }
+        }
+        std::array<T, 3> c;
+        for(size_type q = 0; q < 3; ++q) c[q] = (lo[q] + hi[q]) / T(2);
+
+        T r2 = 0;
+        for(size_type p = begin; p < end; ++p) {
+            const T dx = m_x_[index[p]] - c[0];
+            const T dy = m_y_[index[p]] - c[1];
+            const T dz = m_z_[index[p]] - c[2];
+            r2         = std::max(r2, dx * dx + dy * dy + dz * dz);
+        }
+        m_nodes_[node].center = c;
+        m_nodes_[node].radius = std::sqrt(r2);
+
+        if(end - begin <= leaf_size || r2 == T(0) || depth[node] == max_depth)
+            continue;
+
+        // Counting sort of the charges by octant
+        auto octant = [&](size_type i) {
+            return size_type(m_x_[i] > c[0]) | size_type(m_y_[i] > c[1]) << 1 |
+                   size_type(m_z_[i] > c[2]) << 2;
+        };
+        std::array<size_type, 9> offset{};
+        for(size_type p = begin; p < end; ++p) ++offset[octant(index[p]) + 1];
+        for(size_type o = 1; o < 9; ++o) offset[o] += offset[o - 1];
+        std::array<size_type, 8> fill;
+        std::copy(offset.begin(), offset.begin() + 8, fill.begin());
+        for(size_type p = begin; p < end; ++p)
+            buffer[begin + fill[octant(index[p])]++] = index[p];
+        std::copy(buffer.begin() + begin, buffer.begin() + end,
+                  index.begin() + begin);
+
+        m_nodes_[node].first_child = m_nodes_.size();
+        for(size_type o = 0; o < 8; ++o) {
+            if(offset[o + 1] == offset[o]) continue;
+            m_nodes_.push_back(
+              Node{{}, T(0), begin + offset[o], begin + offset[o + 1], 0, 0});
+            depth.push_back(depth[node] + 1);
+            ++m_nodes_[node].n_children;
+        }
+    }
+
+    // Store the charges in tree order
+    auto gather = [&](std::vector<T>& v) {
+        std::vector<T> sorted(n);
+        for(size_type p = 0; p < n; ++p) sorted[p] = v[index[p]];
+        v.swap(sorted);
+    };
+    gather(m_x_);
+    gather(m_y_);
+    gather(m_z_);
+    gather(m_q_);
+}
+
+template<typename T>
+void MultipoleTreePIMPL<T>::build_moments_() {
+    const size_type n_nodes = m_nodes_.size();
+    const size_type nm      = n_terms_(m_order_);
+    m_moments_.assign(n_nodes * nm, T(0));
+
+#pragma omp parallel if(size() >= parallel_threshold)
+    {
+        std::vector<T> w(nm);
+#pragma omp for schedule(dynamic)
+        for(size_type node = 0; node < n_nodes; ++node) {
+            const auto& nd = m_nodes_[node];
+            T* const m     = m_moments_.data() + node * nm;
+            for(size_type p = nd.begin; p < nd.end; ++p) {
+                // -d_j, the sign of (-d_j)^n is folded into the recursion
+                const std::array<T, 3> md{nd.center[0] - m_x_[p],
+                                          nd.center[1] - m_y_[p],
+                                          nd.center[2] - m_z_[p]};
+                w[0] = m_q_[p];
+                m[0] += w[0];
+                for(size_type i = 1; i < nm; ++i) {
+                    const auto& t = m_terms_[i];
+                    w[i]          = w[t.parent] * md[t.k] * t.inv;
+                    m[i] += w[i];
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+const T* MultipoleTreePIMPL<T>::derivatives_(T x, T y, T z, size_type l,
+                                             T* work) const noexcept {
+    const T inv_r2 = T(1) / (x * x + y * y + z * z);
+    T* const a     = work;
+    T* prev        = work + l + 1;
+    T* curr        = prev + n_terms_(l);
+
+    // a[m] = (-1)^m (2m - 1)!! / R^(2m + 1)
+    a[0] = std::sqrt(inv_r2);
+    for(size_type m = 1; m <= l; ++m) a[m] = -T(2 * m - 1) * inv_r2 * a[m - 1];
+
+    // Level m needs |n| <= l - m, so sweep from m = l down to m = 0
+    const std::array<T, 3> r{x, y, z};
+    for(size_type m = l + 1; m-- > 0;) {
+        const size_type n = n_terms_(l - m);
+        curr[0]           = a[m];
+        for(size_type i = 1; i < n; ++i) {
+            const auto& t = m_terms_[i];
+            curr[i] = t.coef * prev[t.grandparent] + r[t.k] * prev[t.parent];
+        }
+        std::swap(prev, curr);
+    }
+    return prev;
+}
+
+template<typename T>
+template<bool ComputeField>
+void MultipoleTreePIMPL<T>::evaluate_(const coordinates_type& points, T* phi,
+                                      T* ex, T* ey, T* ez) const {
+    const size_type n = points.size();
+    if(n == 0 || size() == 0) return;
+
+    const size_type l      = m_order_ + (ComputeField ? 1 : 0);
+    const size_type nm     = n_terms_(m_order_);
+    const T theta2         = m_theta_ * m_theta_;
+    const T rc2            = std::numeric_limits<T>::infinity();
+    const auto* const px   = points.x();
+    const auto* const py   = points.y();
+    const auto* const pz   = points.z();
+    const bool do_parallel = n * size() >= parallel_threshold;
+
+#pragma omp parallel if(do_parallel)
+    {
+        std::vector<T> work(l + 1 + 2 * n_terms_(l));
+        std::vector<size_type> stack;
+
+#pragma omp for schedule(dynamic, 16)
+        for(size_type i = 0; i < n; ++i) {
+            const T x = px[i];
+            const T y = py[i];
+            const T z = pz[i];
+            T v = 0, fx = 0, fy = 0, fz = 0;
+            stack.assign(1, 0);
+            while(!stack.empty()) {
+                const size_type node = stack.back();
+                stack.pop_back();
+                const auto& nd = m_nodes_[node];
+                const T dx     = x - nd.center[0];
+                const T dy     = y - nd.center[1];
+                const T dz     = z - nd.center[2];
+                const T r2     = dx * dx + dy * dy + dz * dz;
+
+                if(r2 > T(0) && nd.radius * nd.radius <= theta2 * r2) {
+                    const T* d = derivatives_(dx, dy, dz, l, work.data());
+                    const T* m = m_moments_.data() + node * nm;
+                    for(size_type j = 0; j < nm; ++j) {
+                        v += m[j] * d[j];
+                        if constexpr(ComputeField) {
+                            fx -= m[j] * d[m_raise_[j][0]];
+                            fy -= m[j] * d[m_raise_[j][1]];
+                            fz -= m[j] * d[m_raise_[j][2]];
+                        }
+                    }
+                } else if(nd.is_leaf()) {
+                    coulomb_sum<ComputeField>(
+                      x, y, z, m_x_.data(), m_y_.data(), m_z_.data(),
+                      m_q_.data(), nd.begin, nd.end, rc2, T(0), v, fx, fy, fz);
+                } else {
+                    for(size_type c = 0; c < nd.n_children; ++c)
+                        stack.push_back(nd.first_child + c);
+                }
+            }
+            phi[i] = v;
+            if constexpr(ComputeField) {
+                ex[i] = fx;
+                ey[i] = fy;
+                ez[i] = fz;
+            }
+        }
+    }
+}
+
+} // namespace chemist::detail_
@@ -0,0 +1,202 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "detail_/coulomb_kernel.hpp"
+#include <algorithm>
+#include <chemist/point_charge/electrostatics.hpp>
+
+namespace chemist {
+namespace {
+
+using size_type = std::size_t;
+
+/// Number of charges per tile, 4 * 256 doubles fit comfortably in L1
+constexpr size_type tile_size = 256;
+
+/// Number of charge-target pairs below which threading costs more than it
+/// saves
+constexpr size_type parallel_threshold = size_type(1) << 16;
+
+/// Number of tiles needed to cover @p n points
+constexpr size_type n_tiles(size_type n) noexcept {
+    return (n + tile_size - 1) / tile_size;
+}
+
+using detail_::SoACharges;
+using detail_::SoACoordinates;
+
+/** @brief Accumulates the potential, and optionally the field, of @p src at
+ *         the points of @p tgt.
+ *
+ *  Each thread owns a tile of target points and sweeps the tiles of charges
+ *  over it, so a tile of charges is reused by tile_size targets before it is
+ *  evicted.
+ *
+ *  @p ex, @p ey, and @p ez are only touched if ComputeField is true.
+ */
+template<bool ComputeField, typename T>
+void coulomb_(const SoACharges<T>& src, const SoACoordinates<T>& tgt, T cutoff,
+              T smoothing, T* phi, T* ex, T* ey, T* ez) {
+    const size_type n    = tgt.size();
+    const size_type m    = src.size();
+    const size_type n_ti = n_tiles(n);
+    const size_type n_tj = n_tiles(m);
+    const T rc2          = cutoff * cutoff;
+    const T a2           = smoothing * smoothing;
+    const auto* const px = tgt.x();
+    const auto* const py = tgt.y();
+    const auto* const pz = tgt.z();
+    const auto* const qx = src.points().x();
+    const auto* const qy = src.points().y();
+    const auto* const qz = src.points().z();
+    const auto* const q  = src.q();
+
+#pragma omp parallel for schedule(static) if(n * m >= parallel_threshold)
+    for(size_type ti = 0; ti < n_ti; ++ti) {
+        const size_type i_end = std::min(n, (ti + 1) * tile_size);
+        for(size_type tj = 0; tj < n_tj; ++tj) {
+            const size_type j_begin = tj * tile_size;
+            const size_type j_end   = std::min(m, j_begin + tile_size);
+            for(size_type i = ti * tile_size; i < i_end; ++i) {
+                T fx = 0, fy = 0, fz = 0;
+                detail_::coulomb_sum<ComputeField>(
+                  px[i], py[i], pz[i], qx, qy, qz, q, j_begin, j_end, rc2, a2,
+                  phi[i], fx, fy, fz);
+                if constexpr(ComputeField) {
+                    ex[i] += fx;
+                    ey[i] += fy;
+                    ez[i] += fz;
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+std::vector<T> potential_(const SoACharges<T>& src,
+                          const SoACoordinates<T>& tgt, T cutoff, T smoothing) {
+    std::vector<T> rv(tgt.size(), T(0));
+    T* const phi = rv.data();
+    coulomb_<false>(src, tgt, cutoff, smoothing, phi, phi, phi, phi);
+    return rv;
+}
+
+template<typename T>
+std::vector<T> field_(const SoACharges<T>& src, const SoACoordinates<T>& tgt,
+                      T cutoff, T smoothing) {
+    const size_type n = tgt.size();
+    std::vector<T> phi(n, T(0));
+    std::vector<T> rv(3 * n, T(0));
+    auto* const ex = rv.data();
+    coulomb_<true>(src, tgt, cutoff, smoothing, phi.data(), ex, ex + n,
+                   ex + 2 * n);
+    return rv;
+}
+
+} // namespace
+
+// -- Charges/PointSet overloads -----------------------------------------------
+
+template<typename T>
+std::vector<T> electrostatic_potential(const Charges<T>& charges,
+                                       const PointSet<T>& points, T cutoff,
+                                       T smoothing) {
+    return potential_(SoACharges<T>(charges), SoACoordinates<T>(points),
+                      cutoff, smoothing);
+}
+
+template<typename T>
+std::vector<T> electric_field(const Charges<T>& charges,
+                              const PointSet<T>& points, T cutoff,
+                              T smoothing) {
+    return field_(SoACharges<T>(charges), SoACoordinates<T>(points), cutoff,
+                  smoothing);
+}
+
+// -- View overloads -----------------------------------------------------------
+
+template<typename ChargesType, typename PointSetType>
+auto electrostatic_potential(
+  const ChargesView<ChargesType>& charges,
+  const PointSetView<PointSetType>& points,
+  typename ChargesView<ChargesType>::value_type::charge_type cutoff,
+  typename ChargesView<ChargesType>::value_type::charge_type smoothing)
+  -> std::vector<typename ChargesView<ChargesType>::value_type::charge_type> {
+    using T = typename ChargesView<ChargesType>::value_type::charge_type;
+    return potential_(SoACharges<T>(charges), SoACoordinates<T>(points),
+                      cutoff, smoothing);
+}
+
+template<typename ChargesType, typename PointSetType>
+auto electric_field(
+  const ChargesView<ChargesType>& charges,
+  const PointSetView<PointSetType>& points,
+  typename ChargesView<ChargesType>::value_type::charge_type cutoff,
+  typename ChargesView<ChargesType>::value_type::charge_type smoothing)
+  -> std::vector<typename ChargesView<ChargesType>::value_type::charge_type> {
+    using T = typename ChargesView<ChargesType>::value_type::charge_type;
+    return field_(SoACharges<T>(charges), SoACoordinates<T>(points), cutoff,
+                  smoothing);
+}
+
+// -- Grid overloads -----------------------------------------------------------
+
+std::vector<double> electrostatic_potential(const Charges<double>& charges,
+                                            const Grid& grid, double cutoff,
+                                            double smoothing) {
+    return potential_(SoACharges<double>(charges),
+                      SoACoordinates<double>(grid.point_set()), cutoff,
+                      smoothing);
+}
+
+std::vector<double> electric_field(const Charges<double>& charges,
+                                   const Grid& grid, double cutoff,
+                                   double smoothing) {
+    return field_(SoACharges<double>(charges),
+                  SoACoordinates<double>(grid.point_set()), cutoff,
+                  smoothing);
+}
+
+#define INSTANTIATE(T)                                                        \
+    template std::vector<T> electrostatic_potential(                          \
+      const Charges<T>&, const PointSet<T>&, T, T);                           \
+    template std::vector<T> electric_field(const Charges<T>&,                 \
+                                           const PointSet<T>&, T, T)
+
+#define INSTANTIATE_VIEW(T, ChargesType, PointSetType)                        \
+    template std::vector<T> electrostatic_potential(                          \
+      const ChargesView<ChargesType>&, const PointSetView<PointSetType>&, T,  \
+      T);                                                                     \
+    template std::vector<T> electric_field(const ChargesView<ChargesType>&,   \
+                                           const PointSetView<PointSetType>&, \
+                                           T, T)
+
+#define INSTANTIATE_VIEWS(T)                                                  \
+    INSTANTIATE_VIEW(T, Charges<T>, PointSet<T>);                             \
+    INSTANTIATE_VIEW(T, Charges<T>, const PointSet<T>);                       \
+    INSTANTIATE_VIEW(T, const Charges<T>, PointSet<T>);                       \
+    INSTANTIATE_VIEW(T, const Charges<T>, const PointSet<T>)
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE_VIEWS(float);
+INSTANTIATE_VIEWS(double);
+
+#undef INSTANTIATE_VIEWS
+#undef INSTANTIATE_VIEW
+#undef INSTANTIATE
+
+} // namespace chemist
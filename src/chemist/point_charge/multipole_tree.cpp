@@ -0,0 +1,162 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "detail_/multipole_tree_pimpl.hpp"
+#include <utility>
+
+namespace chemist {
+
+#define TPARAMS template<typename T>
+#define MULTIPOLE_TREE MultipoleTree<T>
+
+// -- Ctors, assignment, and dtor ----------------------------------------------
+
+TPARAMS
+MULTIPOLE_TREE::MultipoleTree() noexcept = default;
+
+TPARAMS
+MULTIPOLE_TREE::MultipoleTree(const charges_type& charges, size_type order,
+                              coord_type theta, size_type leaf_size) :
+  m_pimpl_(std::make_unique<pimpl_type>(detail_::SoACharges<T>(charges), order,
+                                        theta, leaf_size)) {}
+
+TPARAMS
+template<typename ChargesType>
+MULTIPOLE_TREE::MultipoleTree(const ChargesView<ChargesType>& charges,
+                              size_type order, coord_type theta,
+                              size_type leaf_size) :
+  m_pimpl_(std::make_unique<pimpl_type>(detail_::SoACharges<T>(charges), order,
+                                        theta, leaf_size)) {}
+
+TPARAMS
+MULTIPOLE_TREE::MultipoleTree(const MultipoleTree& other) :
+  m_pimpl_(other.has_pimpl_() ? std::make_unique<pimpl_type>(*other.m_pimpl_) :
+                                nullptr) {}
+
+TPARAMS
+MULTIPOLE_TREE::MultipoleTree(MultipoleTree&& other) noexcept = default;
+
+TPARAMS
+MULTIPOLE_TREE& MULTIPOLE_TREE::operator=(const MultipoleTree& rhs) {
+    MultipoleTree(rhs).m_pimpl_.swap(m_pimpl_);
+    return *this;
+}
+
+TPARAMS
+MULTIPOLE_TREE& MULTIPOLE_TREE::operator=(MultipoleTree&& rhs) noexcept =
+  default;
+
+TPARAMS
+MULTIPOLE_TREE::~MultipoleTree() noexcept = default;
+
+// -- Accessors ----------------------------------------------------------------
+
+TPARAMS
+typename MULTIPOLE_TREE::size_type MULTIPOLE_TREE::size() const noexcept {
+    return has_pimpl_() ? m_pimpl_->size() : 0;
+}
+
+TPARAMS
+typename MULTIPOLE_TREE::size_type MULTIPOLE_TREE::order() const noexcept {
+    return has_pimpl_() ? m_pimpl_->order() : 0;
+}
+
+TPARAMS
+typename MULTIPOLE_TREE::coord_type MULTIPOLE_TREE::theta() const noexcept {
+    return has_pimpl_() ? m_pimpl_->theta() : 0;
+}
+
+TPARAMS
+typename MULTIPOLE_TREE::coord_type MULTIPOLE_TREE::error_bound()
+  const noexcept {
+    return has_pimpl_() ? m_pimpl_->error_bound() : 0;
+}
+
+// -- Evaluation ---------------------------------------------------------------
+
+TPARAMS
+typename MULTIPOLE_TREE::result_type MULTIPOLE_TREE::potential(
+  const point_set_type& points) const {
+    if(!has_pimpl_()) return result_type(points.size(), T(0));
+    return m_pimpl_->potential(detail_::SoACoordinates<T>(points));
+}
+
+TPARAMS
+template<typename PointSetType>
+typename MULTIPOLE_TREE::result_type MULTIPOLE_TREE::potential(
+  const PointSetView<PointSetType>& points) const {
+    if(!has_pimpl_()) return result_type(points.size(), T(0));
+    return m_pimpl_->potential(detail_::SoACoordinates<T>(points));
+}
+
+TPARAMS
+typename MULTIPOLE_TREE::result_type MULTIPOLE_TREE::field(
+  const point_set_type& points) const {
+    if(!has_pimpl_()) return result_type(3 * points.size(), T(0));
+    return m_pimpl_->field(detail_::SoACoordinates<T>(points));
+}
+
+TPARAMS
+template<typename PointSetType>
+typename MULTIPOLE_TREE::result_type MULTIPOLE_TREE::field(
+  const PointSetView<PointSetType>& points) const {
+    if(!has_pimpl_()) return result_type(3 * points.size(), T(0));
+    return m_pimpl_->field(detail_::SoACoordinates<T>(points));
+}
+
+// -- Utility methods ----------------------------------------------------------
+
+TPARAMS
+void MULTIPOLE_TREE::swap(MultipoleTree& other) noexcept {
+    m_pimpl_.swap(other.m_pimpl_);
+}
+
+// -- Private methods ----------------------------------------------------------
+
+TPARAMS
+bool MULTIPOLE_TREE::has_pimpl_() const noexcept {
+    return static_cast<bool>(m_pimpl_);
+}
+
+#undef MULTIPOLE_TREE
+#undef TPARAMS
+
+#define INSTANTIATE_CHARGES_VIEW(T, ChargesType)                              \
+    template MultipoleTree<T>::MultipoleTree(                                 \
+      const ChargesView<ChargesType>&, std::size_t, T, std::size_t)
+
+#define INSTANTIATE_POINT_SET_VIEW(T, PointSetType)                           \
+    template std::vector<T> MultipoleTree<T>::potential(                      \
+      const PointSetView<PointSetType>&) const;                               \
+    template std::vector<T> MultipoleTree<T>::field(                          \
+      const PointSetView<PointSetType>&) const
+
+INSTANTIATE_CHARGES_VIEW(float, Charges<float>);
+INSTANTIATE_CHARGES_VIEW(float, const Charges<float>);
+INSTANTIATE_CHARGES_VIEW(double, Charges<double>);
+INSTANTIATE_CHARGES_VIEW(double, const Charges<double>);
+INSTANTIATE_POINT_SET_VIEW(float, PointSet<float>);
+INSTANTIATE_POINT_SET_VIEW(float, const PointSet<float>);
+INSTANTIATE_POINT_SET_VIEW(double, PointSet<double>);
+INSTANTIATE_POINT_SET_VIEW(double, const PointSet<double>);
+
+#undef INSTANTIATE_POINT_SET_VIEW
+#undef INSTANTIATE_CHARGES_VIEW
+
+template class MultipoleTree<float>;
+template class MultipoleTree<double>;
+
+} // namespace chemist
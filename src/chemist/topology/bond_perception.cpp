@@ -0,0 +1,158 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../point/detail_/soa_coordinates.hpp"
+#include <chemist/topology/bond_perception.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace chemist::topology {
+namespace {
+
+using size_type       = typename BondPerception::size_type;
+using index_list_type = typename BondPerception::index_list_type;
+
+/// Number of atoms below which threading costs more than it saves
+constexpr size_type parallel_threshold = 256;
+
+/// The covalent radius of an atom with atomic number @p Z, or -1 if there is
+/// no such element
+double covalent_radius_(Element::atomic_number_type Z) noexcept {
+    return is_element(Z) ? element(Z).covalent_radius_au() : -1.0;
+}
+
+} // namespace
+
+// -- Ctors --------------------------------------------------------------------
+
+BondPerception::BondPerception(const Nuclei& nuclei, double tolerance) :
+  m_tolerance_(tolerance) {
+    if(tolerance < 0.0)
+        throw std::runtime_error("Bond perception tolerance can't be negative");
+
+    const auto n = nuclei.size();
+    const auto Z = nuclei.atomic_number_column();
+    m_radii_.resize(n);
+    for(size_type i = 0; i < n; ++i) {
+        m_radii_[i]   = covalent_radius_(Z[i]);
+        m_max_radius_ = std::max(m_max_radius_, m_radii_[i]);
+    }
+
+    const auto charges = nuclei.charges();
+    const auto points  = charges.point_set();
+    const chemist::detail_::SoACoordinates<double> r(points);
+    m_index_ = SpatialIndex<double>(points);
+
+    std::vector<index_list_type> partners(n);
+#pragma omp parallel for schedule(dynamic, 64) if(n >= parallel_threshold)
+    for(size_type i = 0; i < n; ++i)
+        partners[i] = bonds_of_(i, r.x(), r.y(), r.z());
+
+    // Bonds are added in lexicographic order, which only ever appends to the
+    // table's adjacency lists
+    m_connectivity_.set_n_atoms(n);
+    for(size_type i = 0; i < n; ++i) {
+        const auto& js = partners[i];
+        for(auto j = std::upper_bound(js.begin(), js.end(), i); j != js.end();
+            ++j)
+            m_connectivity_.add_bond(i, *j);
+    }
+}
+
+BondPerception::BondPerception(const Molecule& molecule, double tolerance) :
+  BondPerception(molecule.nuclei().as_nuclei(), tolerance) {}
+
+// -- Incremental updates ------------------------------------------------------
+
+void BondPerception::update(const Nuclei& nuclei,
+                            const index_list_type& moved) {
+    const auto n = natoms();
+    if(nuclei.size() != n)
+        throw std::runtime_error("Expected " + std::to_string(n) +
+                                 " nuclei, but got " +
+                                 std::to_string(nuclei.size()));
+    for(const auto i : moved)
+        if(i >= n)
+            throw std::out_of_range("Atom " + std::to_string(i) +
+                                    " is not in the range [0, " +
+                                    std::to_string(n) + ").");
+
+    // Nuclei store their coordinates contiguously, so these views (and the
+    // one m_index_ makes) alias the columns of nuclei instead of copying them
+    const auto charges = nuclei.charges();
+    const auto points  = charges.point_set();
+    const chemist::detail_::SoACoordinates<double> r(points);
+    m_index_.update(points, moved);
+
+    const auto Z = nuclei.atomic_number_column();
+    for(const auto i : moved) {
+        m_radii_[i]   = covalent_radius_(Z[i]);
+        m_max_radius_ = std::max(m_max_radius_, m_radii_[i]);
+        for(const auto j : m_connectivity_.bonded_atoms(i))
+            m_connectivity_.remove_bond(i, j);
+    }
+
+    const auto n_moved = moved.size();
+    std::vector<index_list_type> partners(n_moved);
+#pragma omp parallel for schedule(dynamic, 16) if(n_moved >= parallel_threshold)
+    for(size_type k = 0; k < n_moved; ++k)
+        partners[k] = bonds_of_(moved[k], r.x(), r.y(), r.z());
+
+    // A bond between two moved atoms is found twice, add_bond ignores repeats
+    for(size_type k = 0; k < n_moved; ++k)
+        for(const auto j : partners[k]) m_connectivity_.add_bond(moved[k], j);
+}
+
+void BondPerception::update(const Molecule& molecule,
+                            const index_list_type& moved) {
+    update(molecule.nuclei().as_nuclei(), moved);
+}
+
+// -- Private methods ----------------------------------------------------------
+
+index_list_type BondPerception::bonds_of_(size_type i, const double* x,
+                                          const double* y,
+                                          const double* z) const {
+    index_list_type rv;
+    const double r_i = m_radii_[i];
+    if(r_i < 0.0) return rv;
+
+    // Nothing can be bonded to i from further away than this
+    const double search_radius = r_i + m_max_radius_ + m_tolerance_;
+    const Point<double> center(x[i], y[i], z[i]);
+    for(const auto j : m_index_.radius_query(center, search_radius)) {
+        if(j == i || m_radii_[j] < 0.0) continue;
+        const double dx     = x[j] - x[i];
+        const double dy     = y[j] - y[i];
+        const double dz     = z[j] - z[i];
+        const double cutoff = r_i + m_radii_[j] + m_tolerance_;
+        if(dx * dx + dy * dy + dz * dz <= cutoff * cutoff) rv.push_back(j);
+    }
+    return rv;
+}
+
+// -- Free functions -----------------------------------------------------------
+
+ConnectivityTable perceive_bonds(const Nuclei& nuclei, double tolerance) {
+    return BondPerception(nuclei, tolerance).connectivity();
+}
+
+ConnectivityTable perceive_bonds(const Molecule& molecule, double tolerance) {
+    return BondPerception(molecule, tolerance).connectivity();
+}
+
+} // namespace chemist::topology
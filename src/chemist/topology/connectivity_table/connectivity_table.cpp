@@ -59,6 +59,10 @@ void ConnectivityTable::add_bond(size_type i, size_type j) {
     pimpl_().add_bond(i, j);
 }
 
+void ConnectivityTable::remove_bond(size_type i, size_type j) {
+    pimpl_().remove_bond(i, j);
+}
+
 size_type ConnectivityTable::natoms() const noexcept {
     if(m_pimpl_) return m_pimpl_->natoms();
     return 0;
@@ -76,18 +80,18 @@ offset_pair_list ConnectivityTable::bonds() const {
 
 typename ConnectivityTable::atom_indices_set ConnectivityTable::bonded_atoms(
   size_type i) const {
+    const auto js = neighbors(i);
+    return atom_indices_set(js.begin(), js.end());
+}
+
+typename ConnectivityTable::const_atom_indices_span
+ConnectivityTable::neighbors(size_type i) const {
     const auto n = natoms();
     if(i >= n)
         throw std::out_of_range("i = " + std::to_string(i) +
                                 " is not in the range [0, " +
                                 std::to_string(n) + ").");
-    std::set<size_type> rv;
-    const auto& p = *m_pimpl_;
-    for(size_type j = 0; j < n; ++j) {
-        if(i == j) continue;
-        if(p.are_bonded(i, j)) rv.insert(j);
-    }
-    return rv;
+    return const_atom_indices_span(m_pimpl_->bonded_atoms(i));
 }
 
 pimpl_type& ConnectivityTable::pimpl_() {
@@ -16,14 +16,22 @@
 
 #pragma once
 #include "chemist/topology/connectivity_table.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace chemist::topology::detail_ {
 
-/** @brief PIMPL which stores the bonds in an adjacency matrix.
+/** @brief PIMPL which stores the bonds in adjacency lists.
  *
- *  This PIMPL uses an natoms by natoms adjacency matrix to store the bonds. It
- *  only manipulates the elements (i,j) for which i < j (*i.e.*, the upper
- *  triangle of the adjacency matrix).
+ *  Bond graphs of molecules are very sparse (each atom is bonded to a handful
+ *  of other atoms regardless of how many atoms there are), so this PIMPL
+ *  stores, for each atom, a sorted list of the atoms it is bonded to. Each bond
+ *  appears in the lists of both of its atoms. Memory is thus O(natoms + nbonds)
+ *  rather than O(natoms**2), neighbor queries are O(degree), and enumerating
+ *  the bonds is O(natoms + nbonds). The number of bonds is maintained as bonds
+ *  are added.
  */
 class ConnectivityTablePIMPL {
 public:
@@ -36,6 +44,9 @@ public:
     /// Type used for a list of bonds
     using offset_pair_list = typename ConnectivityTable::offset_pair_list;
 
+    /// Type used to hold the atoms bonded to an atom
+    using neighbor_list = std::vector<size_type>;
+
     /** @brief Creates an empty PIMPL.
      *
      *  The PIMPL created with this ctor is a connectivity table for 0 atoms.
@@ -85,7 +96,7 @@ public:
      *
      *  @throw None no throw guarantee.
      */
-    auto nbonds() const noexcept;
+    size_type nbonds() const noexcept { return m_nbonds_; }
 
     /** @brief Adds a bond between atoms @p i and @p j.
      *
@@ -106,6 +117,20 @@ public:
      */
     void add_bond(size_type i, size_type j);
 
+    /** @brief Removes the bond between atoms @p i and @p j.
+     *
+     *  If atoms @p i and @p j are not bonded this is a no-op.
+     *
+     *  @param[in] i the index of the first atom in the bond.
+     *  @param[in] j the index of the second atom in the bond.
+     *
+     *  @throw std::out_of_range if either (or both) of @p i and/or @p j are not
+     *                           in the range [0, natoms()). Strong throw
+     *                           guarantee.
+     *  @throw std::out_of_range if @p i equals @p j. Strong throw guarantee.
+     */
+    void remove_bond(size_type i, size_type j);
+
     /** @brief Determines if two atoms are bonded.
      *
      *  This function can be used to inquire into whether two atoms are bonded.
@@ -138,6 +163,19 @@ public:
      */
     offset_pair_list bonds() const;
 
+    /** @brief Returns the atoms bonded to atom @p i.
+     *
+     *  @param[in] i The zero-based index of the atom of interest. Must be in
+     *               the range [0, natoms()).
+     *
+     *  @return The indices of the atoms bonded to @p i, sorted in ascending
+     *          order.
+     *
+     *  @throw std::out_of_range if @p i is not in the range [0, natoms()).
+     *                           Strong throw guarantee.
+     */
+    const neighbor_list& bonded_atoms(size_type i) const;
+
 private:
     /// Ensures argument is less than `natoms()` and throws if it is not
     void bounds_check_(size_type atom_i) const;
@@ -161,57 +199,87 @@ private:
     /// The number of atoms this table is for.
     size_type m_natoms_ = 0;
 
-    // An m_natoms_ by m_natoms_ adjacency matrix storing the connections
-    std::vector<bool> m_connections_;
+    /// The number of bonds in the table
+    size_type m_nbonds_ = 0;
+
+    /// m_connections_[i] is the sorted list of atoms bonded to atom i
+    std::vector<neighbor_list> m_connections_;
 };
 
 // ---------------------------- Implementations --------------------------------
 
 inline ConnectivityTablePIMPL::ConnectivityTablePIMPL(size_type natoms) :
-  m_natoms_(natoms), m_connections_(natoms * natoms, false) {}
+  m_natoms_(natoms), m_connections_(natoms) {}
 
 inline void ConnectivityTablePIMPL::set_natoms(size_type natoms) {
     if(natoms == m_natoms_) return;
-    std::vector<bool> temp(natoms * natoms, false);
+    std::vector<neighbor_list> temp(natoms);
     m_connections_.swap(temp);
     m_natoms_ = natoms;
-}
-
-inline auto ConnectivityTablePIMPL::nbonds() const noexcept {
-    size_type n_bonds = 0;
-    for(size_type i = 0; i < m_natoms_; ++i)
-        for(size_type j = i + 1; j < m_natoms_; ++j)
-            if(m_connections_[i * m_natoms_ + j]) ++n_bonds;
-    return n_bonds;
+    m_nbonds_ = 0;
 }
 
 inline bool ConnectivityTablePIMPL::are_bonded(size_type i, size_type j) const {
     auto [min, max] = sanitize_indices_(i, j);
-    return m_connections_[min * m_natoms_ + max];
+    // Search the shorter of the two lists
+    const auto& min_list = m_connections_[min];
+    const auto& max_list = m_connections_[max];
+    if(max_list.size() < min_list.size())
+        return std::binary_search(max_list.begin(), max_list.end(), min);
+    return std::binary_search(min_list.begin(), min_list.end(), max);
 }
 
 inline void ConnectivityTablePIMPL::add_bond(size_type i, size_type j) {
-    auto [min, max]                       = sanitize_indices_(i, j);
-    m_connections_[min * m_natoms_ + max] = true;
+    auto [min, max] = sanitize_indices_(i, j);
+    auto& min_list  = m_connections_[min];
+    auto& max_list  = m_connections_[max];
+    auto min_itr    = std::lower_bound(min_list.begin(), min_list.end(), max);
+    if(min_itr != min_list.end() && *min_itr == max) return;
+    auto max_itr = std::lower_bound(max_list.begin(), max_list.end(), min);
+
+    // Reserve first so the two inserts can't leave the lists inconsistent
+    const auto min_offset = min_itr - min_list.begin();
+    const auto max_offset = max_itr - max_list.begin();
+    min_list.reserve(min_list.size() + 1);
+    max_list.reserve(max_list.size() + 1);
+    min_list.insert(min_list.begin() + min_offset, max);
+    max_list.insert(max_list.begin() + max_offset, min);
+    ++m_nbonds_;
+}
+
+inline void ConnectivityTablePIMPL::remove_bond(size_type i, size_type j) {
+    auto [min, max] = sanitize_indices_(i, j);
+    auto& min_list  = m_connections_[min];
+    auto& max_list  = m_connections_[max];
+    auto min_itr    = std::lower_bound(min_list.begin(), min_list.end(), max);
+    if(min_itr == min_list.end() || *min_itr != max) return;
+    auto max_itr = std::lower_bound(max_list.begin(), max_list.end(), min);
+    min_list.erase(min_itr);
+    max_list.erase(max_itr);
+    --m_nbonds_;
 }
 
 inline typename ConnectivityTablePIMPL::offset_pair_list
 ConnectivityTablePIMPL::bonds() const {
-    const auto n_bonds = nbonds();
-    offset_pair_list rv(n_bonds);
-
-    for(size_type i = 0, bonds_found = 0; i < m_natoms_; ++i) {
-        for(size_type j = i + 1; j < m_natoms_; ++j) {
-            if(are_bonded(i, j)) {
-                rv[bonds_found++] = offset_pair{i, j};
-                if(bonds_found == n_bonds) return rv;
-            }
-        }
+    offset_pair_list rv;
+    rv.reserve(m_nbonds_);
+    for(size_type i = 0; i < m_natoms_; ++i) {
+        // Lists are sorted, so the atoms after i give i's bonds in order
+        const auto& neighbors = m_connections_[i];
+        const auto end        = neighbors.end();
+        for(auto itr = std::upper_bound(neighbors.begin(), end, i); itr != end;
+            ++itr)
+            rv.push_back(offset_pair{i, *itr});
     }
-    // We can get here if there's actually zero bonds...
     return rv;
 }
 
+inline const typename ConnectivityTablePIMPL::neighbor_list&
+ConnectivityTablePIMPL::bonded_atoms(size_type i) const {
+    bounds_check_(i);
+    return m_connections_[i];
+}
+
 inline void ConnectivityTablePIMPL::bounds_check_(size_type atom_i) const {
     if(atom_i < m_natoms_) return;
 
@@ -0,0 +1,517 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chemist/topology/graph_algorithms.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace chemist::topology {
+namespace {
+
+using size_type        = graph_size_type;
+using offset_pair      = typename ConnectivityTable::offset_pair;
+using offset_pair_list = typename ConnectivityTable::offset_pair_list;
+
+/// Marks an atom which has not been reached (or does not exist)
+constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+/// Number of searches (or ring blocks) below which threading isn't worth it
+constexpr size_type parallel_threshold = 64;
+
+void check_atom_(const ConnectivityTable& table, size_type i) {
+    if(i < table.natoms()) return;
+    throw std::out_of_range("Atom " + std::to_string(i) +
+                            " is not in the range [0, " +
+                            std::to_string(table.natoms()) + ").");
+}
+
+/** @brief Breadth-first search whose state is reused across searches.
+ *
+ *  The arrays are sized for the whole table once. Each search only resets
+ *  the entries the previous search touched, so a search costs time
+ *  proportional to the part of the graph it visits.
+ */
+class BreadthFirstSearch {
+public:
+    explicit BreadthFirstSearch(size_type natoms) :
+      m_distance_(natoms, npos), m_parent_(natoms, npos) {}
+
+    /** @brief Searches outward from @p source.
+     *
+     *  The search stops expanding atoms which are @p max_depth bonds from
+     *  @p source, and stops altogether once @p target is reached.
+     */
+    void run(const ConnectivityTable& table, size_type source,
+             size_type max_depth, size_type target = npos) {
+        reset_();
+        m_distance_[source] = 0;
+        m_visited_.push_back(source);
+        for(size_type head = 0; head < m_visited_.size(); ++head) {
+            const auto i = m_visited_[head];
+            if(i == target) return;
+            if(m_distance_[i] == max_depth) continue;
+            for(const auto j : table.neighbors(i)) {
+                if(m_distance_[j] != npos) continue;
+                m_distance_[j] = m_distance_[i] + 1;
+                m_parent_[j]   = i;
+                m_visited_.push_back(j);
+            }
+        }
+    }
+
+    /// The atoms reached by the last search, in the order they were reached
+    const atom_list_type& visited() const noexcept { return m_visited_; }
+
+    /// Number of bonds between the source and @p i, npos if not reached
+    size_type distance(size_type i) const noexcept { return m_distance_[i]; }
+
+    /// The atom @p i was reached from, npos for the source
+    size_type parent(size_type i) const noexcept { return m_parent_[i]; }
+
+private:
+    void reset_() noexcept {
+        for(const auto i : m_visited_) {
+            m_distance_[i] = npos;
+            m_parent_[i]   = npos;
+        }
+        m_visited_.clear();
+    }
+
+    atom_list_type m_distance_;
+    atom_list_type m_parent_;
+    atom_list_type m_visited_;
+};
+
+atom_list_type k_hop_(const ConnectivityTable& table, BreadthFirstSearch& bfs,
+                      size_type seed, size_type k) {
+    bfs.run(table, seed, k);
+    atom_list_type rv(bfs.visited());
+    std::sort(rv.begin(), rv.end());
+    return rv;
+}
+
+atom_list_type path_(const ConnectivityTable& table, BreadthFirstSearch& bfs,
+                     size_type source, size_type target) {
+    bfs.run(table, source, npos, target);
+    atom_list_type rv;
+    if(bfs.distance(target) == npos) return rv;
+    rv.reserve(bfs.distance(target) + 1);
+    for(auto i = target; i != npos; i = bfs.parent(i)) rv.push_back(i);
+    std::reverse(rv.begin(), rv.end());
+    return rv;
+}
+
+/** @brief Splits the bonds into biconnected blocks and returns the blocks
+ *         which contain a ring.
+ *
+ *  This is Tarjan's algorithm, written with an explicit stack so deep
+ *  chains can't overflow the call stack. A block without a ring is a single
+ *  bond, so only blocks with at least three bonds are kept.
+ */
+std::vector<offset_pair_list> ring_blocks_(const ConnectivityTable& table) {
+    /// An atom whose neighbors are being visited
+    struct Frame {
+        size_type atom;
+        size_type parent;
+        size_type next; // Offset of the next neighbor to visit
+    };
+
+    const auto n = table.natoms();
+    atom_list_type discovered(n, npos), low(n, npos);
+    offset_pair_list bond_stack;
+    std::vector<Frame> stack;
+    std::vector<offset_pair_list> rv;
+
+    size_type time = 0;
+    for(size_type root = 0; root < n; ++root) {
+        if(discovered[root] != npos) continue;
+        discovered[root] = low[root] = time++;
+        stack.push_back(Frame{root, npos, 0});
+        while(!stack.empty()) {
+            const auto i  = stack.back().atom;
+            const auto js = table.neighbors(i);
+            if(stack.back().next < js.size()) {
+                const auto j = js[stack.back().next++];
+                if(j == stack.back().parent) continue;
+                if(discovered[j] == npos) { // Tree bond
+                    bond_stack.push_back(offset_pair{i, j});
+                    discovered[j] = low[j] = time++;
+                    stack.push_back(Frame{j, i, 0});
+                } else if(discovered[j] < discovered[i]) { // Back bond
+                    bond_stack.push_back(offset_pair{i, j});
+                    low[i] = std::min(low[i], discovered[j]);
+                }
+                continue;
+            }
+
+            // All of i's neighbors are done
+            const auto parent = stack.back().parent;
+            stack.pop_back();
+            if(parent == npos) continue;
+            low[parent] = std::min(low[parent], low[i]);
+            if(low[i] < discovered[parent]) continue;
+
+            // parent separates i's subtree from the rest of the graph
+            offset_pair_list block;
+            offset_pair bond;
+            do {
+                bond = bond_stack.back();
+                bond_stack.pop_back();
+                block.push_back(bond);
+            } while(bond != offset_pair{parent, i});
+            if(block.size() >= 3) rv.push_back(std::move(block));
+        }
+    }
+    return rv;
+}
+
+/// Rotates and reflects @p ring so it starts at its lowest atom and
+/// continues towards the lower of that atom's two neighbors
+void canonicalize_ring_(atom_list_type& ring) {
+    std::rotate(ring.begin(), std::min_element(ring.begin(), ring.end()),
+                ring.end());
+    if(ring.back() < ring[1]) std::reverse(ring.begin() + 1, ring.end());
+}
+
+/// Adjacency lists of a block, as (neighbor, bond) pairs
+using block_adjacency =
+  std::vector<std::vector<std::pair<size_type, size_type>>>;
+
+/** @brief Breadth-first tree of a ring block whose state is reused across
+ *         roots.
+ *
+ *  Besides the distance to each atom, the tree records the bond each atom
+ *  was reached through and the branch of the tree (the root's neighbor the
+ *  path goes through). As with BreadthFirstSearch, only the entries touched
+ *  by the previous search are reset, so one tree of O(atoms) memory serves
+ *  every root of the block.
+ */
+class BlockTree {
+public:
+    explicit BlockTree(size_type natoms) :
+      m_distance_(natoms, npos),
+      m_bond_(natoms, npos),
+      m_branch_(natoms, npos) {}
+
+    /// Grows the tree from @p root, stopping at @p max_depth bonds
+    void run(const block_adjacency& adj, size_type root, size_type max_depth) {
+        reset_();
+        m_root_           = root;
+        m_depth_          = max_depth;
+        m_distance_[root] = 0;
+        m_visited_.push_back(root);
+        for(size_type head = 0; head < m_visited_.size(); ++head) {
+            const auto x = m_visited_[head];
+            if(m_distance_[x] == max_depth) continue;
+            for(const auto& [y, b] : adj[x]) {
+                if(m_distance_[y] != npos) continue;
+                m_distance_[y] = m_distance_[x] + 1;
+                m_bond_[y]     = b;
+                m_branch_[y]   = x == root ? y : m_branch_[x];
+                m_visited_.push_back(y);
+            }
+        }
+    }
+
+    /// Does the last tree contain every atom within @p depth of @p root?
+    bool covers(size_type root, size_type depth) const noexcept {
+        return root == m_root_ && depth <= m_depth_;
+    }
+
+    /// The atoms in the tree, in the order they were reached
+    const atom_list_type& visited() const noexcept { return m_visited_; }
+
+    /// Number of bonds between the root and @p i, npos if not reached
+    size_type distance(size_type i) const noexcept { return m_distance_[i]; }
+
+    /// The bond @p i was reached through, npos for the root
+    size_type bond(size_type i) const noexcept { return m_bond_[i]; }
+
+    /// The root's neighbor the path to @p i goes through, npos for the root
+    size_type branch(size_type i) const noexcept { return m_branch_[i]; }
+
+private:
+    void reset_() noexcept {
+        for(const auto i : m_visited_) {
+            m_distance_[i] = npos;
+            m_bond_[i]     = npos;
+            m_branch_[i]   = npos;
+        }
+        m_visited_.clear();
+    }
+
+    size_type m_root_  = npos;
+    size_type m_depth_ = 0;
+    atom_list_type m_distance_;
+    atom_list_type m_bond_;
+    atom_list_type m_branch_;
+    atom_list_type m_visited_;
+};
+
+/** @brief Finds a minimum cycle basis of a biconnected block with Horton's
+ *         algorithm.
+ *
+ *  For every atom v of the block a breadth-first tree is grown from v. Each
+ *  bond (x, y) which is not in the tree closes the candidate ring
+ *  v -> x -> y -> v, provided the tree paths to x and y only share v.
+ *  Candidates are then considered from shortest to longest and a candidate is
+ *  kept if its bonds are linearly independent (over GF(2)) of the bonds of
+ *  the rings kept so far, until the block's cyclomatic number is reached.
+ *
+ *  Candidates are recorded as (number of atoms, root, closing bond) only and
+ *  their rings are traced by regrowing the root's tree when they are
+ *  considered. They are also generated in windows of lengths whose upper
+ *  bound doubles each time, and the trees only need to reach half of that
+ *  bound. Molecular rings are small, so usually only the first window is
+ *  needed. The trees and candidates then take memory linear in the size of
+ *  the block, even for large fused ring systems; only the bit rows of the
+ *  elimination grow as (rings) x (bonds) / 64 words.
+ */
+atom_list_set_type block_rings_(const offset_pair_list& block) {
+    // Renumber the block's atoms 0, 1, ...
+    atom_list_type atoms;
+    for(const auto& [i, j] : block) {
+        atoms.push_back(i);
+        atoms.push_back(j);
+    }
+    std::sort(atoms.begin(), atoms.end());
+    atoms.erase(std::unique(atoms.begin(), atoms.end()), atoms.end());
+    auto local = [&](size_type i) {
+        return size_type(std::lower_bound(atoms.begin(), atoms.end(), i) -
+                         atoms.begin());
+    };
+
+    const auto nv      = atoms.size();
+    const auto nb      = block.size();
+    const auto n_rings = nb - nv + 1;
+
+    block_adjacency adj(nv);
+    offset_pair_list bonds(nb);
+    for(size_type b = 0; b < nb; ++b) {
+        bonds[b] = offset_pair{local(block[b][0]), local(block[b][1])};
+        adj[bonds[b][0]].emplace_back(bonds[b][1], b);
+        adj[bonds[b][1]].emplace_back(bonds[b][0], b);
+    }
+    for(auto& a : adj) std::sort(a.begin(), a.end());
+
+    // Gaussian elimination over GF(2). Each kept row's lowest set bit is its
+    // pivot, and no two rows share a pivot.
+    using word_type         = std::uint64_t;
+    const size_type n_words = (nb + 63) / 64;
+    std::vector<word_type> rows;
+    atom_list_type pivot_row(nb, npos);
+    std::vector<word_type> row(n_words);
+    auto add_bond = [&](size_type bond) {
+        row[bond / 64] ^= word_type{1} << (bond % 64);
+    };
+
+    BlockTree tree(nv);
+    std::vector<std::tuple<size_type, size_type, size_type>> candidates;
+    atom_list_set_type rv;
+
+    // Rings have at least three atoms and at most nv
+    for(size_type lo = 2, hi = 8; rv.size() < n_rings && lo < nv;
+        lo = hi, hi *= 2) {
+        // The candidates with lo < length <= hi
+        candidates.clear();
+        for(size_type v = 0; v < nv; ++v) {
+            tree.run(adj, v, hi / 2);
+            for(const auto x : tree.visited()) {
+                for(const auto& [y, b] : adj[x]) {
+                    if(y < x || tree.distance(y) == npos) continue;
+                    if(tree.bond(x) == b || tree.bond(y) == b) continue;
+                    if(tree.branch(x) == tree.branch(y)) continue;
+                    const auto length = tree.distance(x) + tree.distance(y) + 1;
+                    if(length > lo && length <= hi)
+                        candidates.emplace_back(length, v, b);
+                }
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        for(const auto& [length, v, b] : candidates) {
+            if(rv.size() == n_rings) break;
+
+            // The ring is the tree path v -> x, the bond (x, y), and y -> v
+            if(!tree.covers(v, length / 2)) tree.run(adj, v, length / 2);
+            std::fill(row.begin(), row.end(), word_type{0});
+            atom_list_type ring;
+            ring.reserve(length);
+            for(auto x = bonds[b][0]; x != v;) {
+                ring.push_back(x);
+                add_bond(tree.bond(x));
+                const auto& [i, j] = bonds[tree.bond(x)];
+                x                  = i == x ? j : i;
+            }
+            ring.push_back(v);
+            std::reverse(ring.begin(), ring.end());
+            add_bond(b);
+            for(auto y = bonds[b][1]; y != v;) {
+                ring.push_back(y);
+                add_bond(tree.bond(y));
+                const auto& [i, j] = bonds[tree.bond(y)];
+                y                  = i == y ? j : i;
+            }
+
+            // Reduce the ring against the rows kept so far
+            bool independent = false;
+            for(size_type w = 0; w < n_words;) {
+                if(row[w] == 0) {
+                    ++w;
+                    continue;
+                }
+                const size_type bit = w * 64 + std::countr_zero(row[w]);
+                if(pivot_row[bit] == npos) {
+                    pivot_row[bit] = rows.size() / n_words;
+                    rows.insert(rows.end(), row.begin(), row.end());
+                    independent = true;
+                    break;
+                }
+                const auto* r = rows.data() + pivot_row[bit] * n_words;
+                for(size_type k = w; k < n_words; ++k) row[k] ^= r[k];
+            }
+            if(!independent) continue;
+
+            for(auto& i : ring) i = atoms[i];
+            canonicalize_ring_(ring);
+            rv.push_back(std::move(ring));
+        }
+    }
+    return rv;
+}
+
+/// Orders rings by size and then lexicographically
+bool ring_less_(const atom_list_type& lhs, const atom_list_type& rhs) {
+    if(lhs.size() != rhs.size()) return lhs.size() < rhs.size();
+    return lhs < rhs;
+}
+
+} // namespace
+
+// -- Connected components -----------------------------------------------------
+
+atom_list_type component_labels(const ConnectivityTable& table) {
+    const auto n = table.natoms();
+    atom_list_type rv(n, npos);
+    atom_list_type stack;
+    size_type label = 0;
+    for(size_type root = 0; root < n; ++root) {
+        if(rv[root] != npos) continue;
+        rv[root] = label;
+        stack.push_back(root);
+        while(!stack.empty()) {
+            const auto i = stack.back();
+            stack.pop_back();
+            for(const auto j : table.neighbors(i)) {
+                if(rv[j] != npos) continue;
+                rv[j] = label;
+                stack.push_back(j);
+            }
+        }
+        ++label;
+    }
+    return rv;
+}
+
+atom_list_set_type connected_components(const ConnectivityTable& table) {
+    const auto labels = component_labels(table);
+    atom_list_set_type rv;
+    for(size_type i = 0; i < labels.size(); ++i) {
+        if(labels[i] == rv.size()) rv.emplace_back();
+        rv[labels[i]].push_back(i);
+    }
+    return rv;
+}
+
+// -- Neighborhoods and paths --------------------------------------------------
+
+atom_list_type k_hop_neighborhood(const ConnectivityTable& table,
+                                  graph_size_type seed, graph_size_type k) {
+    check_atom_(table, seed);
+    BreadthFirstSearch bfs(table.natoms());
+    return k_hop_(table, bfs, seed, k);
+}
+
+atom_list_set_type k_hop_neighborhoods(const ConnectivityTable& table,
+                                       const atom_list_type& seeds,
+                                       graph_size_type k) {
+    for(const auto seed : seeds) check_atom_(table, seed);
+    const auto n = seeds.size();
+    atom_list_set_type rv(n);
+
+#pragma omp parallel if(n >= parallel_threshold)
+    {
+        BreadthFirstSearch bfs(table.natoms());
+#pragma omp for schedule(dynamic, 16)
+        for(size_type s = 0; s < n; ++s)
+            rv[s] = k_hop_(table, bfs, seeds[s], k);
+    }
+    return rv;
+}
+
+atom_list_type shortest_path(const ConnectivityTable& table,
+                             graph_size_type source, graph_size_type target) {
+    check_atom_(table, source);
+    check_atom_(table, target);
+    BreadthFirstSearch bfs(table.natoms());
+    return path_(table, bfs, source, target);
+}
+
+atom_list_set_type shortest_paths(const ConnectivityTable& table,
+                                  const offset_pair_list& pairs) {
+    for(const auto& [source, target] : pairs) {
+        check_atom_(table, source);
+        check_atom_(table, target);
+    }
+    const auto n = pairs.size();
+    atom_list_set_type rv(n);
+
+#pragma omp parallel if(n >= parallel_threshold)
+    {
+        BreadthFirstSearch bfs(table.natoms());
+#pragma omp for schedule(dynamic, 16)
+        for(size_type p = 0; p < n; ++p)
+            rv[p] = path_(table, bfs, pairs[p][0], pairs[p][1]);
+    }
+    return rv;
+}
+
+// -- Rings --------------------------------------------------------------------
+
+atom_list_set_type smallest_set_of_smallest_rings(
+  const ConnectivityTable& table) {
+    const auto blocks   = ring_blocks_(table);
+    const auto n_blocks = blocks.size();
+    std::vector<atom_list_set_type> block_rings(n_blocks);
+
+#pragma omp parallel for schedule(dynamic) if(n_blocks >= parallel_threshold)
+    for(size_type b = 0; b < n_blocks; ++b)
+        block_rings[b] = block_rings_(blocks[b]);
+
+    atom_list_set_type rv;
+    for(auto& rings : block_rings)
+        for(auto& ring : rings) rv.push_back(std::move(ring));
+    std::sort(rv.begin(), rv.end(), ring_less_);
+    return rv;
+}
+
+} // namespace chemist::topology
@@ -27,7 +27,8 @@ using reference    = CapSet::reference;
 using at_fxn       = reference (CapSet::*)(size_type);
 
 void export_cap_set(python_module_reference m) {
-    auto rvp = pybind11::return_value_policy::reference_internal;
+    // Caps are returned by copy, so they can't be modified behind our back
+    auto rvp = pybind11::return_value_policy::copy;
 
     python_class_type<CapSet>(m, "CapSet")
       .def(pybind11::init<>())
@@ -45,8 +46,10 @@ void export_cap_set(python_module_reference m) {
            })
       .def("at", static_cast<at_fxn>(&CapSet::at), rvp)
       .def("__getitem__", static_cast<at_fxn>(&CapSet::at), rvp)
-      .def("__setitem__",
-           [](CapSet& self, size_type i, cap_type cap) { self.at(i) = cap; })
+      .def("__setitem__", &CapSet::set_cap)
+      .def("set_cap", &CapSet::set_cap)
+      .def("set_anchor_index", &CapSet::set_anchor_index)
+      .def("set_replaced_index", &CapSet::set_replaced_index)
       .def("size", [](CapSet& self) { return self.size(); })
       .def("__len__", [](CapSet& self) { return self.size(); })
       .def(pybind11::self == pybind11::self)
@@ -24,7 +24,8 @@ namespace chemist {
 void export_atom(python_module_reference m) {
     using atom_type          = Atom;
     using atom_reference     = atom_type&;
-    using name_type          = typename atom_type::name_type;
+    // Names are InternedName objects in C++, Python sees them as str
+    using name_type          = std::string;
     using atomic_number_type = typename atom_type::atomic_number_type;
     using mass_type          = typename atom_type::mass_type;
     using coord_type         = typename atom_type::coord_type;
@@ -44,7 +45,7 @@ void export_atom(python_module_reference m) {
       .def(pybind11::init<name_type, atomic_number_type, mass_type, coord_type,
                           coord_type, coord_type, charge_type, size_type>())
       .def_property(
-        "name", [](atom_reference self) { return self.name(); },
+        "name", [](atom_reference self) { return self.name().str(); },
         [](atom_reference self, name_type name) { self.name() = name; })
       .def_property(
         "nucleus", [](atom_reference self) { return self.nucleus(); },
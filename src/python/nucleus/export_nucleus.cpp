@@ -25,7 +25,8 @@ void export_nucleus(python_module_reference m) {
     using nucleus_type       = Nucleus;
     using nucleus_reference  = nucleus_type&;
     using point_charge_type  = typename Nucleus::point_charge_type;
-    using name_type          = typename Nucleus::name_type;
+    // Names are InternedName objects in C++, Python sees them as str
+    using name_type          = std::string;
     using atomic_number_type = typename Nucleus::atomic_number_type;
     using mass_type          = typename Nucleus::mass_type;
     using coord_type         = typename Nucleus::coord_type;
@@ -39,7 +40,7 @@ void export_nucleus(python_module_reference m) {
       .def(pybind11::init<name_type, atomic_number_type, mass_type, coord_type,
                           coord_type, coord_type, charge_type>())
       .def_property(
-        "name", [](nucleus_reference self) { return self.name(); },
+        "name", [](nucleus_reference self) { return self.name().str(); },
         [](nucleus_reference self, name_type name) {
             self.name() = std::move(name);
         })
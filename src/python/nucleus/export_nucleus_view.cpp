@@ -27,14 +27,15 @@ void export_nucleus_view(python_module_reference m) {
     using view_reference     = view_type&;
     using nucleus_reference  = typename view_type::nucleus_reference;
     using charge_view_type   = typename view_type::charge_view_type;
-    using name_type          = typename view_type::name_type;
+    // Names are InternedName objects in C++, Python sees them as str
+    using name_type          = std::string;
     using atomic_number_type = typename view_type::atomic_number_type;
     using mass_type          = typename view_type::mass_type;
 
     python_class_type<view_type, charge_view_type>(m, "NucleusView")
       .def(pybind11::init<nucleus_reference>())
       .def_property(
-        "name", [](view_reference self) { return self.name(); },
+        "name", [](view_reference self) { return self.name().str(); },
         [](view_reference self, name_type name) {
             self.name() = std::move(name);
         })
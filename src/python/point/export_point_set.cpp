@@ -16,6 +16,8 @@
 
 #include "export_point.hpp"
 #include <chemist/point/point_set.hpp>
+#include <pybind11/numpy.h>
+#include <span>
 
 namespace chemist {
 namespace detail_ {
@@ -29,9 +31,25 @@ void export_point_set_(const char* name, python_module_reference m) {
     using point_set_reference = point_set_type&;
     using value_type          = typename point_set_type::value_type;
     using size_type           = typename point_set_type::size_type;
+    using coord_type          = typename point_set_type::coord_type;
+
+    // N.B. forcecast lets Python lists and arrays of other types through,
+    //      c_style ensures the data is contiguous.
+    constexpr auto flags = pybind11::array::c_style | pybind11::array::forcecast;
+    using coord_array    = pybind11::array_t<coord_type, flags>;
+
+    auto array_ctor = [](coord_array x, coord_array y, coord_array z) {
+        auto as_span = [](const coord_array& a) {
+            if(a.ndim() != 1)
+                throw std::runtime_error("Coordinates must be 1-D arrays");
+            return std::span<const coord_type>(a.data(), a.size());
+        };
+        return point_set_type(as_span(x), as_span(y), as_span(z));
+    };
 
     python_class_type<point_set_type>(m, name)
       .def(pybind11::init<>())
+      .def(pybind11::init(array_ctor))
       .def("empty", [](point_set_reference self) { return self.empty(); })
       .def("push_back",
            [](point_set_reference self, value_type v) {
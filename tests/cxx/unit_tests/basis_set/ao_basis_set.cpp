@@ -174,6 +174,20 @@ TEMPLATE_TEST_CASE("AOBasisSet", "", float, double) {
                               std::out_of_range);
             REQUIRE(std::as_const(aobs1).primitive(0) == p0);
         }
+        SECTION("coefficient_column") {
+            REQUIRE(aobs0.coefficient_column().empty());
+            auto c = aobs1.coefficient_column();
+            REQUIRE(coeff_vector(c.begin(), c.end()) == cs);
+            c[1] = 42.0;
+            REQUIRE(aobs1.primitive(1).coefficient() == TestType(42.0));
+            REQUIRE(std::as_const(aobs1).coefficient_column()[1] == c[1]);
+        }
+        SECTION("exponent_column") {
+            REQUIRE(std::as_const(aobs0).exponent_column().empty());
+            auto e = aobs1.exponent_column();
+            REQUIRE(exp_vector(e.begin(), e.end()) == es);
+            REQUIRE(std::as_const(aobs1).exponent_column()[2] == es[2]);
+        }
     }
     SECTION("Utility") {
         SECTION("swap") {
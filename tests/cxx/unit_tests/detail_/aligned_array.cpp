@@ -0,0 +1,126 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/detail_/aligned_array.hpp>
+#include <cstdint>
+
+using namespace chemist::detail_;
+
+namespace {
+
+template<typename T>
+bool is_aligned(const T* p) {
+    return reinterpret_cast<std::uintptr_t>(p) % simd_alignment == 0;
+}
+
+template<typename ArrayType>
+bool padding_is_zero(const ArrayType& a) {
+    for(auto i = a.size(); i < a.padded_size(); ++i)
+        if(a.data()[i] != 0) return false;
+    return true;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("AlignedArray", "", float, double) {
+    using array_type = AlignedArray<TestType>;
+    constexpr auto w = array_type::simd_width;
+    STATIC_REQUIRE(w == simd_alignment / sizeof(TestType));
+
+    array_type defaulted;
+    array_type filled(3, TestType{1.5});
+    std::vector<TestType> values{1.0, 2.0, 3.0, 4.0, 5.0};
+    array_type from_vector(values);
+
+    SECTION("padded_size(n)") {
+        STATIC_REQUIRE(array_type::padded_size(0) == 0);
+        STATIC_REQUIRE(array_type::padded_size(1) == w);
+        STATIC_REQUIRE(array_type::padded_size(w) == w);
+        STATIC_REQUIRE(array_type::padded_size(w + 1) == 2 * w);
+    }
+
+    SECTION("Ctors") {
+        SECTION("Default") {
+            REQUIRE(defaulted.size() == 0);
+            REQUIRE(defaulted.empty());
+            REQUIRE(defaulted.padded_size() == 0);
+        }
+        SECTION("Value") {
+            REQUIRE(filled.size() == 3);
+            REQUIRE(filled.padded_size() == w);
+            for(std::size_t i = 0; i < 3; ++i) REQUIRE(filled[i] == 1.5);
+            REQUIRE(padding_is_zero(filled));
+        }
+        SECTION("Vector") {
+            REQUIRE(from_vector.size() == 5);
+            for(std::size_t i = 0; i < 5; ++i)
+                REQUIRE(from_vector[i] == values[i]);
+        }
+        SECTION("Copy") {
+            array_type copy(from_vector);
+            REQUIRE(copy == from_vector);
+            REQUIRE(is_aligned(copy.data()));
+        }
+    }
+
+    SECTION("push_back") {
+        for(std::size_t i = 0; i < 3 * w + 1; ++i) {
+            defaulted.push_back(TestType(i + 1));
+            REQUIRE(defaulted.size() == i + 1);
+            REQUIRE(defaulted.padded_size() % w == 0);
+            REQUIRE(defaulted.padded_size() >= defaulted.size());
+            REQUIRE(is_aligned(defaulted.data()));
+            REQUIRE(padding_is_zero(defaulted));
+        }
+        for(std::size_t i = 0; i < defaulted.size(); ++i)
+            REQUIRE(defaulted[i] == TestType(i + 1));
+    }
+
+    SECTION("resize") {
+        from_vector.resize(2);
+        REQUIRE(from_vector.size() == 2);
+        REQUIRE(padding_is_zero(from_vector));
+        from_vector.resize(4);
+        REQUIRE(from_vector[2] == 0);
+        REQUIRE(from_vector[3] == 0);
+        REQUIRE(padding_is_zero(from_vector));
+    }
+
+    SECTION("clear") {
+        from_vector.clear();
+        REQUIRE(from_vector == defaulted);
+        REQUIRE(from_vector.padded_size() == 0);
+    }
+
+    SECTION("at") {
+        REQUIRE(from_vector.at(4) == 5.0);
+        REQUIRE_THROWS_AS(from_vector.at(5), std::out_of_range);
+        REQUIRE_THROWS_AS(std::as_const(defaulted).at(0), std::out_of_range);
+    }
+
+    SECTION("begin/end") {
+        std::vector<TestType> corr(from_vector.begin(), from_vector.end());
+        REQUIRE(corr == values);
+    }
+
+    SECTION("operator==") {
+        REQUIRE(defaulted == array_type{});
+        REQUIRE(from_vector == array_type(values));
+        REQUIRE_FALSE(from_vector == filled);
+        REQUIRE(from_vector != filled);
+    }
+}
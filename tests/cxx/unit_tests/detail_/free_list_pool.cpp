@@ -0,0 +1,68 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/detail_/free_list_pool.hpp>
+#include <thread>
+#include <vector>
+
+using namespace chemist::detail_;
+
+/* Testing Notes:
+ *
+ * Pools are per block size and per thread, so each test uses a block size
+ * which no other code uses to avoid interference.
+ */
+TEST_CASE("FreeListPool") {
+    SECTION("block_size") {
+        STATIC_REQUIRE(FreeListPool<1>::block_size == sizeof(void*));
+        STATIC_REQUIRE(FreeListPool<1000>::block_size == 1000);
+    }
+
+    SECTION("Released blocks are recycled") {
+        using pool_type = FreeListPool<1001>;
+        auto* p0        = pool_type::allocate();
+        REQUIRE(p0 != nullptr);
+        pool_type::deallocate(p0);
+        REQUIRE(pool_type::cached() == 1);
+        auto* p1 = pool_type::allocate();
+        REQUIRE(p1 == p0);
+        REQUIRE(pool_type::cached() == 0);
+        pool_type::deallocate(p1);
+    }
+
+    SECTION("Blocks are distinct") {
+        using pool_type = FreeListPool<1002>;
+        std::vector<void*> blocks;
+        for(std::size_t i = 0; i < 10; ++i)
+            blocks.push_back(pool_type::allocate());
+        for(std::size_t i = 0; i < 10; ++i)
+            for(std::size_t j = i + 1; j < 10; ++j)
+                REQUIRE(blocks[i] != blocks[j]);
+        for(auto* p : blocks) pool_type::deallocate(p);
+    }
+
+    SECTION("nullptr is a no-op") { FreeListPool<1003>::deallocate(nullptr); }
+
+    SECTION("Cross-thread release") {
+        using pool_type = FreeListPool<1004>;
+        void* p         = nullptr;
+        std::thread t([&p]() { p = pool_type::allocate(); });
+        t.join();
+        pool_type::deallocate(p);
+        REQUIRE(pool_type::allocate() == p);
+    }
+}
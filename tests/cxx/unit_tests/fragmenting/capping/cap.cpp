@@ -173,6 +173,11 @@ TEST_CASE("Cap") {
         REQUIRE(c23.get_anchor_index() == 2);
     }
 
+    SECTION("has_anchor_index") {
+        REQUIRE_FALSE(defaulted.has_anchor_index());
+        REQUIRE(c12.has_anchor_index());
+    }
+
     SECTION("set_replaced_index") {
         defaulted.set_replaced_index(1);
         REQUIRE(defaulted.get_replaced_index() == 1);
@@ -190,6 +195,11 @@ TEST_CASE("Cap") {
         REQUIRE(c23.get_replaced_index() == 3);
     }
 
+    SECTION("has_replaced_index") {
+        REQUIRE_FALSE(defaulted.has_replaced_index());
+        REQUIRE(c12.has_replaced_index());
+    }
+
     SECTION("comparisons") {
         // Default v default
         Cap other_default;
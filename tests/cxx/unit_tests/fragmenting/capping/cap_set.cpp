@@ -104,6 +104,13 @@ TEST_CASE("CapSet") {
         defaulted.push_back(cap2);
         defaulted.push_back(cap3);
         REQUIRE(defaulted == has_values);
+
+        // Caps added after construction are found
+        defaulted.emplace_back(0, 1, atom0);
+        REQUIRE(defaulted.get_cap_indices(index_set_type{0}) ==
+                index_set_type{4});
+        REQUIRE(defaulted.get_cap_indices(index_set_type{0, 3}) ==
+                index_set_type{3, 4});
     }
 
     SECTION("emplace_back") {
@@ -181,6 +188,107 @@ TEST_CASE("CapSet") {
         }
     }
 
+    SECTION("get_cap_indices(sorted) const") {
+        using sorted_indices_type = typename CapSet::sorted_indices_type;
+        using vector_type         = std::vector<std::size_t>;
+
+        SECTION("Neither the anchor or replaced") {
+            vector_type input;
+            auto rv = has_values.get_cap_indices(sorted_indices_type(input));
+            REQUIRE(rv == index_set_type{});
+        }
+        SECTION("Anchor only") {
+            vector_type input{1, 3};
+            auto rv = has_values.get_cap_indices(sorted_indices_type(input));
+            REQUIRE(rv == index_set_type{1, 3});
+        }
+        SECTION("Both the anchor and replaced") {
+            vector_type input{1, 2, 2};
+            auto rv = has_values.get_cap_indices(sorted_indices_type(input));
+            REQUIRE(rv == index_set_type{2});
+        }
+        SECTION("Throws if not sorted") {
+            vector_type input{3, 1};
+            sorted_indices_type sorted(input);
+            REQUIRE_THROWS_AS(has_values.get_cap_indices(sorted),
+                              std::runtime_error);
+        }
+    }
+
+    SECTION("get_cap_indices(mask) const") {
+        using index_mask_type = typename CapSet::index_mask_type;
+
+        SECTION("Neither the anchor or replaced") {
+            index_mask_type input{true};
+            REQUIRE(has_values.get_cap_indices(input) == index_set_type{});
+        }
+        SECTION("Anchor only") {
+            index_mask_type input{false, true, false, true};
+            REQUIRE(has_values.get_cap_indices(input) == index_set_type{1, 3});
+        }
+        SECTION("Both the anchor and replaced") {
+            index_mask_type input{false, true, true};
+            REQUIRE(has_values.get_cap_indices(input) == index_set_type{2});
+        }
+    }
+
+    SECTION("set_cap") {
+        has_values.set_cap(1, cap3);
+        REQUIRE(has_values[1] == cap3);
+        REQUIRE(has_values.get_cap_indices(index_set_type{1}).empty());
+        REQUIRE(has_values.get_cap_indices(index_set_type{3}) ==
+                index_set_type{1, 3});
+
+        has_values.set_cap(0, Cap(0, 1));
+        REQUIRE(has_values.get_cap_indices(index_set_type{0}) ==
+                index_set_type{0});
+
+        REQUIRE_THROWS_AS(has_values.set_cap(4, cap0), std::out_of_range);
+    }
+
+    SECTION("set_anchor_index") {
+        has_values.set_anchor_index(3, 0);
+        REQUIRE(has_values[3] == Cap(0, 4, atom0, atom0));
+        REQUIRE(has_values.get_cap_indices(index_set_type{0}) ==
+                index_set_type{3});
+        REQUIRE(has_values.get_cap_indices(index_set_type{3}).empty());
+
+        // Caps without a replaced index are never needed
+        has_values.set_anchor_index(0, 0);
+        REQUIRE(has_values.get_cap_indices(index_set_type{0}) ==
+                index_set_type{3});
+
+        REQUIRE_THROWS_AS(has_values.set_anchor_index(4, 0), std::out_of_range);
+    }
+
+    SECTION("set_replaced_index") {
+        has_values.set_replaced_index(1, 3);
+        REQUIRE(has_values[1] == Cap(1, 3));
+        REQUIRE(has_values.get_cap_indices(index_set_type{1, 2}) ==
+                index_set_type{1, 2});
+
+        REQUIRE_THROWS_AS(has_values.set_replaced_index(4, 0),
+                          std::out_of_range);
+    }
+
+    SECTION("Index stays valid across queries") {
+        // Element access is read-only, so holding on to a cap can not be used
+        // to change its indices behind the index's back
+        STATIC_REQUIRE(std::is_same_v<CapSet::reference, const Cap&>);
+
+        auto& c = has_values[3];
+        has_values.get_cap_nuclei(index_set_type{3});
+        has_values.set_anchor_index(3, 2);
+        REQUIRE(c.get_anchor_index() == 2);
+
+        std::vector<Cap> buffer{cap0, cap1, cap2, c};
+        CapSet fresh(buffer.begin(), buffer.end());
+        index_set_type input{2};
+        auto rv = std::as_const(has_values).get_cap_indices(input);
+        REQUIRE(rv == index_set_type{2, 3});
+        REQUIRE(rv == fresh.get_cap_indices(input));
+    }
+
     SECTION("get_cap_nuclei(range)") {
         typename nuclei_reference::reference a0_view(atom0);
 
@@ -301,6 +409,28 @@ TEST_CASE("CapSet") {
         }
     }
 
+    SECTION("get_nuclei") {
+        typename nuclei_reference::reference a0_view(atom0);
+        std::vector a0{a0_view, a0_view, a0_view};
+
+        REQUIRE(has_values.get_nuclei(index_set_type{}) == nuclei_reference{});
+        REQUIRE(has_values.get_nuclei(index_set_type{1}) == nuclei_reference{});
+        REQUIRE(has_values.get_nuclei(index_set_type{2, 3}) ==
+                nuclei_reference{a0});
+        REQUIRE_THROWS_AS(has_values.get_nuclei(index_set_type{4}),
+                          std::out_of_range);
+    }
+
+    SECTION("get_nuclei() const") {
+        typename const_nuclei_reference::reference a0_view(atom0);
+        auto& cvalues = std::as_const(has_values);
+
+        auto rv = cvalues.get_nuclei(index_set_type{2});
+        REQUIRE(rv == const_nuclei_reference{std::vector{a0_view}});
+        REQUIRE_THROWS_AS(cvalues.get_nuclei(index_set_type{4}),
+                          std::out_of_range);
+    }
+
     SECTION("at_") {
         // N.B. at_ is used by the base class to implement element access. We
         // rely on the public API to test that we actually implemented it right.
@@ -310,9 +440,9 @@ TEST_CASE("CapSet") {
         REQUIRE(has_values[2] == cap2);
         REQUIRE(has_values[3] == cap3);
 
-        // Is writeable
-        has_values[1] = cap0;
-        REQUIRE(has_values[1] == cap0);
+        // Is read-only, caps are changed with set_cap and friends
+        STATIC_REQUIRE(std::is_const_v<
+                       std::remove_reference_t<decltype(has_values[1])>>);
     }
 
     SECTION("at_() const") {
@@ -302,6 +302,33 @@ TEMPLATE_LIST_TEST_CASE("FragmentedNuclei", "", types2test) {
         no_frags.insert(frag);
         REQUIRE(no_frags.size() == 1);
         REQUIRE(no_frags[0] == corr1);
+
+        SECTION("Views of the supersystem") {
+            auto ss_view = std::as_const(no_frags).supersystem();
+            no_frags.insert(ss_view);
+            REQUIRE(no_frags.size() == 2);
+            REQUIRE(no_frags.nuclear_indices(1) == index_set_type{0, 1, 2});
+        }
+
+        SECTION("Duplicate nuclei map to the first copy") {
+            set_type dups(supersystem_type{h0, h1, h0});
+            dups.insert(fragment_reference(reference_container{h0}));
+            REQUIRE(dups.nuclear_indices(0) == index_set_type{0});
+
+            // Unless they alias a later copy
+            dups.insert(std::as_const(dups).supersystem());
+            REQUIRE(dups.nuclear_indices(1) == index_set_type{0, 1, 2});
+        }
+
+        SECTION("Supersystem modified after the first insert") {
+            if constexpr(!std::is_const_v<TestType>) {
+                no_frags.supersystem()[2].x() = 42.0;
+                nucleus_type moved("H", 1ul, 1.0, 42.0, 9.0, 0.0);
+                no_frags.insert(fragment_reference(reference_container{moved}));
+                REQUIRE(no_frags.nuclear_indices(1) == index_set_type{2});
+                REQUIRE_THROWS_AS(no_frags.insert(frag2), std::runtime_error);
+            }
+        }
     }
 
     SECTION("insert(by index)") {
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <chemist/fragmenting/fragmented_nuclei.hpp>
+#include <vector>
+
+using namespace chemist;
+using namespace chemist::fragmenting;
+
+/* Testing Notes:
+ *
+ * These benchmarks are hidden (they only run if explicitly requested, e.g.,
+ * by passing "[benchmark]" to the test executable). The supersystem is a
+ * chain of hydrogen atoms cut into fragments of consecutive atoms, each of
+ * which is capped on both ends. Every nucleus of every fragment is visited,
+ * which stresses looking up nuclei in the unions of fragment and caps.
+ */
+TEST_CASE("FragmentedNuclei iteration", "[.][benchmark]") {
+    using set_type     = FragmentedNuclei<Nuclei>;
+    using cap_set_type = typename set_type::cap_set_type;
+    using cap_type     = typename cap_set_type::value_type;
+    using view_type    = typename set_type::const_reference;
+
+    constexpr std::size_t n_frags = 500;
+    constexpr std::size_t n_atoms = 20; // Per fragment
+
+    auto h = [](std::size_t i) {
+        return Nucleus("H", 1ul, 1.0, 1.4 * i, 0.0, 0.0);
+    };
+
+    Nuclei ss;
+    for(std::size_t i = 0; i < n_frags * n_atoms; ++i) ss.push_back(h(i));
+
+    typename set_type::nucleus_map_type frags;
+    cap_set_type caps;
+    for(std::size_t f = 0; f < n_frags; ++f) {
+        const auto first = f * n_atoms, last = first + n_atoms - 1;
+        typename set_type::nucleus_index_set frag;
+        for(std::size_t i = first; i <= last; ++i) frag.push_back(i);
+        frags.push_back(frag);
+        if(f > 0) caps.push_back(cap_type(first, first - 1, h(first - 1)));
+        if(f + 1 < n_frags)
+            caps.push_back(cap_type(last, last + 1, h(last + 1)));
+    }
+
+    const set_type frag_set(ss, frags, caps);
+
+    BENCHMARK("Capped fragments: visit every nucleus") {
+        double sum = 0.0;
+        for(std::size_t f = 0; f < frag_set.size(); ++f) {
+            const auto frag = frag_set[f];
+            for(std::size_t i = 0; i < frag.size(); ++i) sum += frag[i].x();
+        }
+        return sum;
+    };
+
+    std::vector<view_type> all_frags;
+    for(std::size_t f = 0; f < frag_set.size(); ++f)
+        all_frags.push_back(frag_set[f]);
+    const view_type everything(all_frags);
+
+    BENCHMARK("Union of all fragments: visit every nucleus") {
+        double sum = 0.0;
+        for(std::size_t i = 0; i < everything.size(); ++i)
+            sum += everything[i].x();
+        return sum;
+    };
+}
@@ -16,6 +16,7 @@
 
 #include "../test_helpers.hpp"
 #include <chemist/grid/grid_class.hpp>
+#include <cstdint>
 #include <utility>
 
 using namespace chemist;
@@ -38,6 +39,57 @@ TEST_CASE("Grid") {
         test_chemist::test_copy_and_move(defaulted, range);
     }
 
+    SECTION("weight_data") {
+        REQUIRE(defaulted.weight_data() == nullptr);
+        REQUIRE(std::as_const(defaulted).weight_data() == nullptr);
+        REQUIRE(range.weight_data()[0] == points.at(0).weight());
+        REQUIRE(std::as_const(range).weight_data()[1] == points.at(1).weight());
+        auto addr = reinterpret_cast<std::uintptr_t>(range.weight_data());
+        REQUIRE(addr % Grid::data_alignment == 0);
+    }
+
+    SECTION("Columns") {
+        REQUIRE(defaulted.weight_column().empty());
+        REQUIRE(defaulted.x_column().empty());
+
+        auto ws = range.weight_column();
+        REQUIRE(ws.size() == 2);
+        REQUIRE(ws.data() == range.weight_data());
+        ws[0] = 2.0;
+        REQUIRE(range.at(0).weight() == 2.0);
+        REQUIRE(std::as_const(range).weight_column()[1] == 0.1);
+
+        REQUIRE(range.x_column().size() == 2);
+        REQUIRE(range.x_column()[1] == points.at(1).point().x());
+        REQUIRE(range.y_column()[1] == points.at(1).point().y());
+        REQUIRE(range.z_column()[1] == points.at(1).point().z());
+    }
+
+    SECTION("permute") {
+        range.permute({1, 0});
+        REQUIRE(range.at(0) == points.at(1));
+        REQUIRE(range.at(1) == points.at(0));
+        REQUIRE(range.weight_data()[0] == points.at(1).weight());
+
+        defaulted.permute({});
+        REQUIRE(defaulted.size() == 0);
+
+        REQUIRE_THROWS_AS(range.permute({1, 1}), std::runtime_error);
+    }
+
+    SECTION("reorder") {
+        REQUIRE(defaulted.reorder().empty());
+
+        std::vector<GridPoint> line{GridPoint(1.0, 0.0, 0.0, 0.0),
+                                    GridPoint(2.0, 3.0, 0.0, 0.0),
+                                    GridPoint(3.0, 1.0, 0.0, 0.0)};
+        Grid g(line.begin(), line.end());
+        auto p = g.reorder(SpaceFillingCurve::morton);
+        REQUIRE(p == Grid::permutation_type{0, 2, 1});
+        REQUIRE(g.at(1) == line.at(2));
+        REQUIRE(g.weight_data()[2] == 2.0);
+    }
+
     SECTION("at_()") {
         REQUIRE(range.at(0) == points.at(0));
         REQUIRE(range.at(1) == points.at(1));
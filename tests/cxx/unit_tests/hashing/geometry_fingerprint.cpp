@@ -0,0 +1,208 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/hashing/geometry_fingerprint.hpp>
+#include <cmath>
+#include <stdexcept>
+
+using namespace chemist;
+using namespace chemist::hashing;
+
+namespace {
+
+/// Rotates @p points by @p theta about the axis (1, 1, 1)/sqrt(3)
+PointSet<double> rotate(const PointSet<double>& points, double theta) {
+    const double c = std::cos(theta), s = std::sin(theta), t = 1.0 - c;
+    const double u = 1.0 / std::sqrt(3.0);
+    // Rodrigues' formula, all three components of the axis are u
+    const double d = t * u * u + c, o1 = t * u * u - s * u;
+    const double o2 = t * u * u + s * u;
+    PointSet<double> rv;
+    for(std::size_t i = 0; i < points.size(); ++i) {
+        const auto r = points[i];
+        rv.push_back(Point<double>(d * r.x() + o1 * r.y() + o2 * r.z(),
+                                   o2 * r.x() + d * r.y() + o1 * r.z(),
+                                   o1 * r.x() + o2 * r.y() + d * r.z()));
+    }
+    return rv;
+}
+
+/// Translates @p points by (dx, dy, dz)
+PointSet<double> translate(const PointSet<double>& points, double dx,
+                           double dy, double dz) {
+    PointSet<double> rv;
+    for(std::size_t i = 0; i < points.size(); ++i) {
+        const auto r = points[i];
+        rv.push_back(Point<double>(r.x() + dx, r.y() + dy, r.z() + dz));
+    }
+    return rv;
+}
+
+} // namespace
+
+TEST_CASE("geometry_fingerprint") {
+    const auto rotation = GeometryInvariance::rotation;
+    const double tol    = 1.0E-4;
+
+    // Water, with coordinates chosen so noise does not cross grid boundaries
+    PointSet<double> water{{0.0, 0.0, 0.12345}, {0.0, 1.43217, -0.88765},
+                           {0.0, -1.43217, -0.88765}};
+    PointSet<double> noisy{{1.0E-9, 0.0, 0.12345},
+                           {0.0, 1.43217 - 2.0E-9, -0.88765},
+                           {0.0, -1.43217, -0.88765 + 1.0E-9}};
+    PointSet<double> bent{{0.0, 0.0, 0.12345}, {0.0, 1.5, -0.88765},
+                          {0.0, -1.43217, -0.88765}};
+
+    SECTION("PointSet") {
+        const auto fp = geometry_fingerprint(water, tol);
+        REQUIRE(fp == geometry_fingerprint(noisy, tol));
+        REQUIRE(fp == geometry_fingerprint(translate(water, 1.0, 2.0, 3.0),
+                                           tol));
+        REQUIRE(fp != geometry_fingerprint(bent, tol));
+        REQUIRE(fp != geometry_fingerprint(rotate(water, 0.3), tol));
+        REQUIRE(fp != geometry_fingerprint(water, tol, rotation));
+        REQUIRE(geometry_fingerprint(PointSet<double>{}, tol) ==
+                geometry_fingerprint(PointSet<double>{}, tol));
+
+        REQUIRE_THROWS_AS(geometry_fingerprint(water, 0.0),
+                          std::runtime_error);
+    }
+
+    SECTION("PointSet (rotation invariant)") {
+        const auto fp = geometry_fingerprint(water, tol, rotation);
+        REQUIRE(fp == geometry_fingerprint(noisy, tol, rotation));
+        REQUIRE(fp == geometry_fingerprint(rotate(water, 0.3), tol, rotation));
+        REQUIRE(fp == geometry_fingerprint(
+                        translate(rotate(water, 1.1), -4.0, 0.5, 2.0), tol,
+                        rotation));
+        REQUIRE(fp != geometry_fingerprint(bent, tol, rotation));
+    }
+
+    SECTION("Nuclei") {
+        auto make_nuclei = [](const PointSet<double>& r) {
+            Nuclei rv;
+            rv.push_back(Nucleus("O", 8ul, 15.999, r[0].x(), r[0].y(),
+                                 r[0].z()));
+            rv.push_back(Nucleus("H", 1ul, 1.008, r[1].x(), r[1].y(),
+                                 r[1].z()));
+            rv.push_back(Nucleus("H", 1ul, 1.008, r[2].x(), r[2].y(),
+                                 r[2].z()));
+            return rv;
+        };
+        auto w  = make_nuclei(water);
+        auto fp = geometry_fingerprint(w, tol);
+        REQUIRE(fp == geometry_fingerprint(make_nuclei(noisy), tol));
+        REQUIRE(fp != geometry_fingerprint(make_nuclei(bent), tol));
+        REQUIRE(fp != geometry_fingerprint(water, tol));
+
+        // Non-geometric state must match exactly
+        auto d2o     = w;
+        d2o[1].mass() = 2.014;
+        REQUIRE(fp != geometry_fingerprint(d2o, tol));
+
+        Molecule mol(0, 1, w), cation(1, 2, w);
+        REQUIRE(geometry_fingerprint(mol, tol) ==
+                geometry_fingerprint(Molecule(0, 1, make_nuclei(noisy)), tol));
+        REQUIRE(geometry_fingerprint(mol, tol) !=
+                geometry_fingerprint(cation, tol));
+        REQUIRE(geometry_fingerprint(mol, tol, rotation) ==
+                geometry_fingerprint(
+                  Molecule(0, 1, make_nuclei(rotate(water, 2.0))), tol,
+                  rotation));
+    }
+}
+
+TEST_CASE("geometry_rmsd") {
+    const auto rotation = GeometryInvariance::rotation;
+
+    PointSet<double> points{{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0},
+                            {0.0, 2.0, 0.0}, {0.5, 0.5, 3.0}};
+
+    SECTION("Translation only") {
+        REQUIRE(geometry_rmsd(points, points) == 0.0);
+        auto moved = translate(points, 1.0, -2.0, 0.5);
+        REQUIRE(geometry_rmsd(points, moved) == Approx(0.0).margin(1.0E-12));
+
+        // Moving one point by d moves the centroid by d / 4
+        PointSet<double> shifted{{0.4, 0.0, 0.0}, {1.0, 0.0, 0.0},
+                                 {0.0, 2.0, 0.0}, {0.5, 0.5, 3.0}};
+        const double expected = std::sqrt((0.09 + 3.0 * 0.01) / 4.0);
+        REQUIRE(geometry_rmsd(points, shifted) == Approx(expected));
+
+        REQUIRE(geometry_rmsd(points, rotate(points, 0.5)) > 0.1);
+        REQUIRE(geometry_rmsd(PointSet<double>{}, PointSet<double>{}) == 0.0);
+        REQUIRE_THROWS_AS(geometry_rmsd(points, PointSet<double>{}),
+                          std::runtime_error);
+    }
+
+    SECTION("Rotation") {
+        for(double theta : {0.1, 1.0, 2.5, 3.1}) {
+            auto rotated = translate(rotate(points, theta), 3.0, 2.0, 1.0);
+            REQUIRE(geometry_rmsd(points, rotated, rotation) ==
+                    Approx(0.0).margin(1.0E-7));
+        }
+
+        // Rotating can only lower the RMSD, but can't superimpose a mirror
+        // image
+        PointSet<double> mirror{{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0},
+                                {0.0, 2.0, 0.0}, {0.5, 0.5, -3.0}};
+        REQUIRE(geometry_rmsd(points, mirror, rotation) > 0.1);
+        REQUIRE(geometry_rmsd(points, mirror, rotation) <=
+                geometry_rmsd(points, mirror));
+    }
+}
+
+TEST_CASE("same_geometry") {
+    const auto rotation = GeometryInvariance::rotation;
+    const double tol    = 1.0E-4;
+
+    Nucleus o("O", 8ul, 15.999, 0.0, 0.0, 0.2217);
+    Nucleus h1("H", 1ul, 1.008, 0.0, 1.4309, -0.8867);
+    Nucleus h2("H", 1ul, 1.008, 0.0, -1.4309, -0.8867);
+    Nucleus h1_noisy("H", 1ul, 1.008, 0.0, 1.4309 + 1.0E-6, -0.8867);
+    Nucleus h2_rot("H", 1ul, 1.008, 1.4309, 0.0, -0.8867);
+    Nucleus h1_rot("H", 1ul, 1.008, -1.4309, 0.0, -0.8867);
+
+    Nuclei water{o, h1, h2}, noisy{o, h1_noisy, h2}, rotated{o, h1_rot, h2_rot};
+
+    SECTION("PointSet") {
+        auto r0 = water.charges().point_set().as_point_set();
+        auto r1 = noisy.charges().point_set().as_point_set();
+        REQUIRE(same_geometry(r0, r1, tol));
+        REQUIRE_FALSE(same_geometry(r0, r1, 1.0E-8));
+        REQUIRE_FALSE(same_geometry(r0, PointSet<double>{}, tol));
+    }
+
+    SECTION("Nuclei") {
+        REQUIRE(same_geometry(water, noisy, tol));
+        REQUIRE_FALSE(same_geometry(water, rotated, tol));
+        REQUIRE(same_geometry(water, rotated, tol, rotation));
+        REQUIRE_FALSE(same_geometry(water, Nuclei{o, h1}, tol));
+
+        Nuclei ghost{o, h1, Nucleus("H", 1ul, 1.008, 0.0, -1.4309, -0.8867,
+                                    0.0)};
+        REQUIRE_FALSE(same_geometry(water, ghost, tol));
+    }
+
+    SECTION("Molecule") {
+        Molecule mol(0, 1, water);
+        REQUIRE(same_geometry(mol, Molecule(0, 1, noisy), tol));
+        REQUIRE_FALSE(same_geometry(mol, Molecule(1, 2, noisy), tol));
+        REQUIRE(same_geometry(Molecule{}, Molecule{}, tol));
+        REQUIRE_FALSE(same_geometry(mol, Molecule{}, tol));
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/enums.hpp>
+#include <chemist/hashing/hasher.hpp>
+#include <limits>
+#include <set>
+#include <string>
+
+using namespace chemist::hashing;
+
+TEST_CASE("Hasher") {
+    Hasher defaulted;
+
+    SECTION("Ctor") {
+        REQUIRE(defaulted.digest() == Hasher{}.digest());
+        REQUIRE(defaulted.digest() != Hasher(1).digest());
+    }
+
+    SECTION("add") {
+        SECTION("Integers") {
+            defaulted.add(1);
+            REQUIRE(defaulted.digest() == Hasher{}.add(1ul).digest());
+            REQUIRE(defaulted.digest() != Hasher{}.add(2).digest());
+            REQUIRE(defaulted.digest() == Hasher{}.add(true).digest());
+        }
+
+        SECTION("Enums") {
+            defaulted.add(chemist::ShellType::pure);
+            REQUIRE(defaulted.digest() == Hasher{}.add(1).digest());
+        }
+
+        SECTION("Floating point") {
+            defaulted.add(1.5);
+            REQUIRE(defaulted.digest() == Hasher{}.add(1.5f).digest());
+            REQUIRE(defaulted.digest() != Hasher{}.add(2.5).digest());
+
+            // Hashed by value
+            REQUIRE(Hasher{}.add(0.0).digest() == Hasher{}.add(-0.0).digest());
+            const auto nan  = std::numeric_limits<double>::quiet_NaN();
+            const auto snan = std::numeric_limits<double>::signaling_NaN();
+            REQUIRE(Hasher{}.add(nan).digest() == Hasher{}.add(-nan).digest());
+            REQUIRE(Hasher{}.add(nan).digest() == Hasher{}.add(snan).digest());
+        }
+
+        SECTION("Strings") {
+            defaulted.add(std::string("Hydrogen"));
+            REQUIRE(defaulted.digest() == Hasher{}.add("Hydrogen").digest());
+            REQUIRE(defaulted.digest() != Hasher{}.add("hydrogen").digest());
+
+            // Length is part of the hash, so the split matters
+            auto ab_c = Hasher{}.add("ab").add("c").digest();
+            auto a_bc = Hasher{}.add("a").add("bc").digest();
+            REQUIRE(ab_c != a_bc);
+            REQUIRE(Hasher{}.add("").digest() != defaulted.digest());
+        }
+
+        SECTION("Order matters") {
+            auto h12 = Hasher{}.add(1).add(2).digest();
+            auto h21 = Hasher{}.add(2).add(1).digest();
+            REQUIRE(h12 != h21);
+        }
+    }
+
+    SECTION("add_range") {
+        double values[] = {1.0, 2.0, 3.0};
+        defaulted.add_range(values, 3);
+        REQUIRE(defaulted.digest() ==
+                Hasher{}.add(1.0).add(2.0).add(3.0).digest());
+    }
+
+    SECTION("digest") {
+        // Small changes to the input change the hash
+        std::set<Hasher::hash_type> hashes;
+        for(std::size_t i = 0; i < 1000; ++i)
+            hashes.insert(Hasher{}.add(i).digest());
+        REQUIRE(hashes.size() == 1000);
+
+        // Stable, i.e., does not change between runs
+        REQUIRE(Hasher{}.add(42).digest() == Hasher{}.add(42).digest());
+    }
+
+    SECTION("digest128") {
+        defaulted.add(3.14);
+        auto h = defaulted.digest128();
+        REQUIRE(h[0] == defaulted.digest());
+        REQUIRE(h[1] != h[0]);
+        REQUIRE(h != Hasher{}.add(2.72).digest128());
+    }
+}
@@ -0,0 +1,281 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/hashing/hashing.hpp>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace chemist;
+using namespace chemist::hashing;
+
+/* Testing Strategy:
+ *
+ * The property that matters is that objects which compare equal have the
+ * same hash, so for each type we check that owning objects, views of them,
+ * and views stored in other ways (subsets, strided views, etc.) hash the
+ * same. We also spot check that objects which differ hash differently.
+ */
+
+TEST_CASE("content_hash : points and point charges") {
+    using point_set_type   = PointSet<double>;
+    using point_set_view   = PointSetView<point_set_type>;
+    using charges_type     = Charges<double>;
+    using charges_view     = ChargesView<charges_type>;
+    using member_list_type = typename charges_view::member_list_type;
+
+    Point<double> r0{1.0, 2.0, 3.0}, r1{4.0, 5.0, 6.0}, r2{7.0, 8.0, 9.0};
+    PointCharge<double> q0{-1.0, r0}, q1{0.5, r1}, q2{0.5, r2};
+
+    SECTION("Point") {
+        REQUIRE(content_hash(r0) == content_hash(Point<double>(r0)));
+        REQUIRE(content_hash(r0) == content_hash(PointView<Point<double>>(r0)));
+        REQUIRE(content_hash(r0) != content_hash(r1));
+
+        // Signed zeros compare equal so they hash the same
+        Point<double> zero{0.0, 0.0, 0.0}, neg_zero{-0.0, 0.0, -0.0};
+        REQUIRE(zero == neg_zero);
+        REQUIRE(content_hash(zero) == content_hash(neg_zero));
+    }
+
+    SECTION("PointCharge") {
+        PointChargeView<PointCharge<double>> q0_view(q0);
+        REQUIRE(content_hash(q0) == content_hash(q0_view));
+        REQUIRE(content_hash(q0) != content_hash(q1));
+        REQUIRE(content_hash(q1) != content_hash(q2));
+    }
+
+    SECTION("PointSet") {
+        point_set_type empty, ps{r0, r1, r2};
+        point_set_view ps_view(ps);
+        REQUIRE(content_hash(empty) == content_hash(point_set_type{}));
+        REQUIRE(content_hash(empty) == content_hash(point_set_view{}));
+        REQUIRE(content_hash(ps) == content_hash(ps_view));
+        REQUIRE(content_hash(ps) != content_hash(empty));
+
+        // Subsets are not contiguous
+        point_set_view subset(ps_view, member_list_type{0, 2});
+        REQUIRE_FALSE(subset.is_contiguous());
+        REQUIRE(content_hash(subset) == content_hash(point_set_type{r0, r2}));
+        REQUIRE(content_hash(subset) != content_hash(point_set_type{r2, r0}));
+    }
+
+    SECTION("Charges") {
+        charges_type empty, qs{q0, q1, q2};
+        charges_view qs_view(qs);
+        REQUIRE(content_hash(empty) == content_hash(charges_view{}));
+        REQUIRE(content_hash(qs) == content_hash(qs_view));
+        REQUIRE(content_hash(qs) != content_hash(qs.point_set()));
+
+        charges_view subset(qs_view, member_list_type{1, 2});
+        REQUIRE(content_hash(subset) == content_hash(charges_type{q1, q2}));
+    }
+
+    SECTION("std::hash") {
+        std::unordered_set<point_set_type> sets;
+        sets.insert(point_set_type{r0, r1});
+        sets.insert(point_set_type{r0, r1});
+        sets.insert(point_set_type{r1, r0});
+        REQUIRE(sets.size() == 2);
+        REQUIRE(std::hash<Point<double>>{}(r0) == content_hash(r0));
+    }
+}
+
+TEST_CASE("content_hash : nuclei and molecules") {
+    using nuclei_view      = NucleiView<Nuclei>;
+    using member_list_type = typename nuclei_view::member_list_type;
+
+    Nucleus h0("H", 1ul, 1.0, 0.0, 0.0, 0.0);
+    Nucleus h1("H", 1ul, 1.0, 0.0, 0.0, 1.4);
+    Nucleus he("He", 2ul, 4.0, 1.0, 2.0, 3.0);
+    Nuclei nukes{h0, h1, he};
+
+    SECTION("Nucleus") {
+        REQUIRE(content_hash(h0) == content_hash(nukes[0]));
+        REQUIRE(content_hash(h0) != content_hash(h1));
+
+        // Each piece of state contributes
+        Nucleus ghost("H", 1ul, 1.0, 0.0, 0.0, 0.0, 0.0);
+        Nucleus d("H", 1ul, 2.0, 0.0, 0.0, 0.0);
+        Nucleus x("X", 1ul, 1.0, 0.0, 0.0, 0.0);
+        REQUIRE(content_hash(h0) != content_hash(ghost));
+        REQUIRE(content_hash(h0) != content_hash(d));
+        REQUIRE(content_hash(h0) != content_hash(x));
+    }
+
+    SECTION("Nuclei") {
+        nuclei_view view(nukes);
+        REQUIRE(content_hash(Nuclei{}) == content_hash(nuclei_view{}));
+        REQUIRE(content_hash(nukes) == content_hash(view));
+        REQUIRE(content_hash(nukes) != content_hash(Nuclei{h0, h1}));
+
+        nuclei_view subset(view, member_list_type{2, 0});
+        REQUIRE(content_hash(subset) == content_hash(Nuclei{he, h0}));
+        REQUIRE(content_hash(subset) == content_hash(subset.as_nuclei()));
+
+        // Views see changes to the aliased state
+        const auto old_hash = content_hash(view);
+        view[0].x()         = 3.0;
+        REQUIRE(content_hash(view) != old_hash);
+        REQUIRE(content_hash(view) == content_hash(nukes));
+    }
+
+    SECTION("Atom") {
+        Atom a0("H", 1ul, 1.0, 0.0, 0.0, 0.0);
+        Atom a1("H", 1ul, 1.0, 0.0, 0.0, 0.0, 1.0, 0ul);
+        REQUIRE(content_hash(a0) == content_hash(Atom(a0)));
+        REQUIRE(content_hash(a0) != content_hash(a1));
+    }
+
+    SECTION("Molecule") {
+        Molecule empty, mol(0, 1, Nuclei{h0, h1}), cation(1, 2, Nuclei{h0, h1});
+        MoleculeView<Molecule> view(mol);
+        REQUIRE(content_hash(empty) == content_hash(MoleculeView<Molecule>{}));
+        REQUIRE(content_hash(mol) == content_hash(view));
+        REQUIRE(content_hash(mol) != content_hash(cation));
+        REQUIRE(content_hash(mol) != content_hash(empty));
+    }
+
+    SECTION("ChemicalSystem") {
+        Molecule mol(0, 1, Nuclei{h0, h1});
+        ChemicalSystem sys(mol);
+        ChemicalSystemView<ChemicalSystem> view(sys);
+        REQUIRE(content_hash(ChemicalSystem{}) ==
+                content_hash(ChemicalSystemView<ChemicalSystem>{}));
+        REQUIRE(content_hash(sys) == content_hash(view));
+        REQUIRE(content_hash(sys) != content_hash(ChemicalSystem{}));
+    }
+
+    SECTION("std::hash") {
+        std::unordered_map<Nuclei, std::string> names;
+        names[nukes]         = "H2He";
+        names[Nuclei{h0, h1}] = "H2";
+        REQUIRE(names.size() == 2);
+        REQUIRE(names.at(Nuclei{h0, h1, he}) == "H2He");
+    }
+}
+
+TEST_CASE("content_hash : basis sets") {
+    using namespace chemist::basis_set;
+    using center_type = typename PrimitiveD::center_type;
+
+    center_type r{1.0, 2.0, 3.0};
+    std::vector<double> cs{1.0, 2.0, 3.0};
+    std::vector<double> es{4.0, 5.0, 6.0};
+    PrimitiveD prim(cs[0], es[0], r);
+    ContractedGaussianD cg(cs.begin(), cs.end(), es.begin(), es.end(), r);
+    ShellD shell(ShellType::pure, 1, cg);
+    AtomicBasisSetD abs("name", 1, r);
+    abs.add_shell(ShellType::pure, 1, cg);
+    AOBasisSetD aobs;
+    aobs.add_center(abs);
+
+    SECTION("Null objects") {
+        REQUIRE(content_hash(PrimitiveD{}) ==
+                content_hash(PrimitiveView<PrimitiveD>{}));
+        REQUIRE(content_hash(ContractedGaussianD{}) ==
+                content_hash(ContractedGaussianView<ContractedGaussianD>{}));
+        REQUIRE(content_hash(ShellD{}) == content_hash(ShellView<ShellD>{}));
+        REQUIRE(content_hash(AtomicBasisSetD{}) ==
+                content_hash(AtomicBasisSetView<AtomicBasisSetD>{}));
+        REQUIRE(content_hash(PrimitiveD{}) != content_hash(prim));
+    }
+
+    SECTION("Views") {
+        REQUIRE(content_hash(prim) == content_hash(cg[0]));
+        REQUIRE(content_hash(cg) == content_hash(shell.contracted_gaussian()));
+        REQUIRE(content_hash(shell) == content_hash(abs[0]));
+        REQUIRE(content_hash(abs) == content_hash(aobs[0]));
+    }
+
+    SECTION("Different values") {
+        ShellD cart(ShellType::cartesian, 1, cg);
+        ShellD d(ShellType::pure, 2, cg);
+        REQUIRE(content_hash(shell) != content_hash(cart));
+        REQUIRE(content_hash(shell) != content_hash(d));
+
+        AtomicBasisSetD other("other", 1, r);
+        other.add_shell(ShellType::pure, 1, cg);
+        REQUIRE(content_hash(abs) != content_hash(other));
+        REQUIRE(content_hash(aobs) != content_hash(AOBasisSetD{}));
+    }
+}
+
+TEST_CASE("content_hash : fragments") {
+    using namespace chemist::fragmenting;
+    using fragmented_nuclei = FragmentedNuclei<Nuclei>;
+
+    Nucleus h0("H", 1ul, 1.0, 0.0, 0.0, 0.0);
+    Nucleus h1("H", 1ul, 1.0, 0.0, 0.0, 1.4);
+    Nucleus he("He", 2ul, 4.0, 1.0, 2.0, 3.0);
+    Nuclei nukes{h0, h1, he};
+
+    fragmented_nuclei defaulted, empty(Nuclei{}), no_frags(nukes);
+    fragmented_nuclei frags(nukes), other_frags(nukes);
+    frags.insert({0, 1});
+    frags.insert({2});
+    other_frags.insert({0});
+    other_frags.insert({1, 2});
+
+    SECTION("Cap") {
+        Cap defaulted_cap, c01(0, 1, h0), c02(0, 2, h0), c01_2(0, 1, h0);
+        REQUIRE(content_hash(c01) == content_hash(c01_2));
+        REQUIRE(content_hash(c01) != content_hash(c02));
+        REQUIRE(content_hash(c01) != content_hash(defaulted_cap));
+        REQUIRE(content_hash(CapSet{c01}) == content_hash(CapSet{c01_2}));
+        REQUIRE(content_hash(CapSet{c01}) != content_hash(CapSet{c02}));
+    }
+
+    SECTION("FragmentedNuclei") {
+        REQUIRE(defaulted == empty);
+        REQUIRE(content_hash(defaulted) == content_hash(empty));
+        REQUIRE(content_hash(frags) == content_hash(fragmented_nuclei(frags)));
+        REQUIRE(content_hash(frags) != content_hash(no_frags));
+        REQUIRE(content_hash(frags) != content_hash(other_frags));
+
+        auto capped = frags;
+        capped.add_cap(Cap(1, 2, h0));
+        REQUIRE(content_hash(frags) != content_hash(capped));
+    }
+
+    SECTION("FragmentedMolecule") {
+        using fragmented_molecule = FragmentedMolecule<Molecule>;
+        fragmented_molecule fm(frags, 0, 1), fm2(frags, 0, 1);
+        fragmented_molecule other(other_frags, 0, 1);
+        REQUIRE(content_hash(fragmented_molecule{}) ==
+                content_hash(fragmented_molecule(Molecule{})));
+        REQUIRE(content_hash(fm) == content_hash(fm2));
+        REQUIRE(content_hash(fm) != content_hash(other));
+    }
+
+    SECTION("FragmentedChemicalSystem") {
+        using fragmented_molecule = FragmentedMolecule<Molecule>;
+        using fragmented_system   = FragmentedChemicalSystem<ChemicalSystem>;
+        fragmented_system sys(fragmented_molecule(frags, 0, 1));
+        fragmented_system sys2(fragmented_molecule(frags, 0, 1));
+        fragmented_system other(fragmented_molecule(other_frags, 0, 1));
+        REQUIRE(content_hash(sys) == content_hash(sys2));
+        REQUIRE(content_hash(sys) != content_hash(other));
+    }
+
+    SECTION("content_hash128") {
+        auto h = content_hash128(frags);
+        REQUIRE(h[0] == content_hash(frags));
+        REQUIRE(h != content_hash128(other_frags));
+    }
+}
@@ -68,7 +68,7 @@ TEST_CASE("Atom Class") {
         REQUIRE(std::is_same_v<size_type, std::size_t>);
         REQUIRE(std::is_same_v<coord_type, double>);
         REQUIRE(std::is_same_v<mass_type, double>);
-        REQUIRE(std::is_same_v<name_type, std::string>);
+        REQUIRE(std::is_same_v<name_type, InternedName>);
         REQUIRE(std::is_same_v<charge_type, double>);
     }
 
@@ -141,6 +141,46 @@ TEST_CASE("Molecule Class") {
         REQUIRE(mol.n_electrons() == 2);
     }
 
+    SECTION("permute") {
+        hd.permute({1, 0});
+        REQUIRE(hd[0] == atoms[1].nucleus());
+        REQUIRE(hd[1] == atoms[0].nucleus());
+        REQUIRE(hd.charge() == 0);
+        REQUIRE(hd.multiplicity() == 1);
+
+        defaulted.permute({});
+        REQUIRE(defaulted == Molecule{});
+
+        REQUIRE_THROWS_AS(hd.permute({0}), std::runtime_error);
+    }
+
+    SECTION("reorder") {
+        REQUIRE(defaulted.reorder().empty());
+
+        auto p = qm.reorder();
+        REQUIRE(p.size() == 2);
+        REQUIRE(qm[0] == atoms[p[0]].nucleus());
+        REQUIRE(qm[1] == atoms[p[1]].nucleus());
+        REQUIRE(qm.charge() == 1);
+        REQUIRE(qm.multiplicity() == 2);
+    }
+
+    SECTION("transform") {
+        using affine_type = typename Molecule::affine_type;
+        auto shift        = affine_type::translation({1.0, 0.0, 0.0});
+        Atom h1("H", 1ul, 1.0079, 1.0, 0.0, 0.89, 0.0);
+        Atom d1("D", 1ul, 2.0079, 1.0, 0.0, 0.0, 0.0);
+
+        auto moved = qm.transformed(shift);
+        REQUIRE(moved == Molecule(1, 2, {h1, d1}));
+        REQUIRE(qm == Molecule(1, 2, {h, d}));
+        qm.transform(shift);
+        REQUIRE(qm == moved);
+
+        defaulted.transform(shift);
+        REQUIRE(defaulted == Molecule{});
+    }
+
     Nuclei corr_nuclei{atoms[0].nucleus(), atoms[1].nucleus()};
 
     SECTION("nuclei") { REQUIRE(hd.nuclei() == corr_nuclei); }
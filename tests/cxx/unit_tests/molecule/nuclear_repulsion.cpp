@@ -0,0 +1,41 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/molecule/nuclear_repulsion.hpp>
+
+using namespace chemist;
+
+/* Testing Notes:
+ *
+ * The Molecule overloads forward to the NucleiView overloads, which are
+ * tested with the nuclei. Here we only check that the forwarding works.
+ */
+
+TEST_CASE("nuclear_repulsion (Molecule)") {
+    Atom o("O", 8ul, 15.999, 0.0, 0.0, 0.2217);
+    Atom h1("H", 1ul, 1.008, 0.0, 1.4309, -0.8867);
+    Atom h2("H", 1ul, 1.008, 0.0, -1.4309, -0.8867);
+    Molecule water{o, h1, h2};
+    const auto& nukes = water.nuclei();
+
+    REQUIRE(nuclear_repulsion_energy(Molecule{}) == 0.0);
+    REQUIRE(nuclear_repulsion_energy(water) == nuclear_repulsion_energy(nukes));
+    REQUIRE(nuclear_repulsion_gradient(water) ==
+            nuclear_repulsion_gradient(nukes));
+    REQUIRE(nuclear_repulsion_hessian(water) ==
+            nuclear_repulsion_hessian(nukes));
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/molecule/periodic_table.hpp>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+using namespace chemist;
+
+TEST_CASE("make_molecule") {
+    std::vector<std::string_view> water{"O", "H", "H"};
+    std::vector<double> x{0.0, 0.0, 0.0};
+    std::vector<double> y{0.0, 1.4309, -1.4309};
+    std::vector<double> z{0.2217, -0.8867, -0.8867};
+
+    SECTION("Neutral molecule") {
+        auto mol = make_molecule(water, x, y, z);
+        REQUIRE(mol.nuclei() == make_nuclei(water, x, y, z));
+        REQUIRE(mol.charge() == 0);
+        REQUIRE(mol.multiplicity() == 1);
+    }
+
+    SECTION("Ion") {
+        auto mol = make_molecule(water, x, y, z, 1);
+        REQUIRE(mol.charge() == 1);
+        REQUIRE(mol.multiplicity() == 2);
+    }
+
+    SECTION("Atoms use their ground state") {
+        std::vector<Element::atomic_number_type> Zs{8};
+        std::vector<double> r{0.0};
+        REQUIRE(make_molecule(Zs, r, r, r).multiplicity() == 3);
+        REQUIRE(make_molecule(Zs, r, r, r, 1).multiplicity() == 2);
+
+        std::vector<std::string> cr{"Cr"};
+        REQUIRE(make_molecule(cr, r, r, r).multiplicity() == 7);
+    }
+
+    SECTION("Throws") {
+        std::vector<double> too_short{0.0};
+        REQUIRE_THROWS_AS(make_molecule(water, too_short, y, z),
+                          std::runtime_error);
+    }
+}
@@ -62,6 +62,17 @@ void test_nuclei_union() {
             REQUIRE(has_values2.get_nuke(2) == h0);
             REQUIRE(has_values2.get_nuke(3) == h1);
             REQUIRE(has_values2.get_nuke(4) == h2);
+
+            // Empty members are skipped over
+            NucleiType none;
+            nuclei_container c3{view_type{none}, view_type{n01},
+                                view_type{none}, view_type{n2},
+                                view_type{none}};
+            pimpl_type has_empties(c3);
+            REQUIRE(has_empties.size() == 3);
+            REQUIRE(has_empties.get_nuke(0) == h0);
+            REQUIRE(has_empties.get_nuke(1) == h1);
+            REQUIRE(has_empties.get_nuke(2) == h2);
         }
 
         SECTION("copy") {
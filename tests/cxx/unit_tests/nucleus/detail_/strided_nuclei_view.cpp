@@ -0,0 +1,181 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../catch.hpp"
+#include <chemist/nucleus/detail_/contiguous_nuclei_view.hpp>
+#include <chemist/nucleus/detail_/strided_nuclei_view.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// An array-of-structures record, like a user's own "Atom" class might be
+struct Atom {
+    double x;
+    double y;
+    double z;
+    double q;
+    chemist::Nucleus::name_type name;
+    unsigned int Z;
+    double mass;
+};
+
+} // namespace
+
+template<typename NucleiType>
+void strided_nuclei_guts() {
+    using nuclei_type  = NucleiType;
+    using pimpl_type   = chemist::detail_::StridedNucleiView<nuclei_type>;
+    using nucleus_type = typename pimpl_type::nucleus_traits::value_type;
+    using name_type    = typename pimpl_type::nucleus_traits::name_type;
+    using atomic_number_type =
+      typename pimpl_type::nucleus_traits::atomic_number_type;
+    using mass_type         = typename pimpl_type::nucleus_traits::mass_type;
+    using charges_type      = typename pimpl_type::charges_traits::value_type;
+    using charges_reference = typename pimpl_type::charges_reference;
+    using point_set_reference =
+      typename charges_reference::point_set_reference;
+    using contiguous_type =
+      chemist::detail_::ContiguousNucleiView<nuclei_type>;
+
+    std::vector<Atom> atoms{{0.0, 1.0, 2.0, -1.1, "H", 1, 1.0},
+                            {3.0, 4.0, 5.0, 1.0, "He", 2, 4.0},
+                            {6.0, 7.0, 8.0, 0.0, "Li", 3, 7.0}};
+    const std::size_t s = sizeof(Atom);
+    auto& a0            = atoms[0];
+
+    point_set_reference points(3, &a0.x, &a0.y, &a0.z, s);
+    charges_reference qs(points, &a0.q, s);
+    charges_type defaulted_qs{};
+
+    // Values we're testing
+    pimpl_type defaulted;
+    pimpl_type no_values(defaulted_qs, nullptr, nullptr, nullptr, 0);
+    pimpl_type values(qs, &a0.name, &a0.Z, &a0.mass, s);
+
+    // Correct values
+    nucleus_type h("H", 1, 1.0, 0.0, 1.0, 2.0, -1.1);
+    nucleus_type he("He", 2, 4.0, 3.0, 4.0, 5.0, 1.0);
+    nucleus_type li("Li", 3, 7.0, 6.0, 7.0, 8.0, 0.0);
+
+    SECTION("Ctors") {
+        SECTION("Default") { REQUIRE(defaulted.size() == 0); }
+        SECTION("Value") {
+            REQUIRE(no_values.size() == 0);
+            REQUIRE(values.size() == 3);
+            REQUIRE(values.get_nuke(0) == h);
+            REQUIRE(values.get_nuke(1) == he);
+            REQUIRE(values.get_nuke(2) == li);
+        }
+        SECTION("Copy") {
+            pimpl_type defaulted_copy(defaulted);
+            REQUIRE(defaulted_copy == defaulted);
+
+            pimpl_type values_copy(values);
+            REQUIRE(values_copy == values);
+        }
+    }
+
+    SECTION("clone") {
+        auto pvalues_copy = values.clone();
+        REQUIRE(pvalues_copy->are_equal(values));
+    }
+
+    SECTION("get_nuke()") {
+        REQUIRE(values.get_nuke(2) == li);
+
+        // Is it writeable and does it alias the records?
+        using type_wo_cv = std::remove_cv_t<NucleiType>;
+        if constexpr(std::is_same_v<NucleiType, type_wo_cv>) {
+            auto he_inside   = values.get_nuke(1);
+            he_inside.mass() = 99.0;
+            REQUIRE(atoms[1].mass == 99.0);
+        }
+    }
+
+    SECTION("get_nuke() const") {
+        REQUIRE(std::as_const(values).get_nuke(0) == h);
+        REQUIRE(std::as_const(values).get_nuke(1) == he);
+        REQUIRE(std::as_const(values).get_nuke(2) == li);
+    }
+
+    SECTION("operator==") {
+        SECTION("Defaulted vs. defaulted") {
+            REQUIRE(defaulted == pimpl_type{});
+        }
+
+        SECTION("Defaulted vs. empty") { REQUIRE(defaulted == no_values); }
+
+        SECTION("Defaulted vs. non-empty") {
+            REQUIRE_FALSE(defaulted == values);
+        }
+
+        SECTION("Same values and addresses") {
+            pimpl_type other(qs, &a0.name, &a0.Z, &a0.mass, s);
+            REQUIRE(other == values);
+        }
+
+        SECTION("Same values and different layout") {
+            using point_charge_type = typename charges_type::value_type;
+            point_charge_type q0(-1.1, 0.0, 1.0, 2.0);
+            point_charge_type q1(1.0, 3.0, 4.0, 5.0);
+            point_charge_type q2(0.0, 6.0, 7.0, 8.0);
+            charges_type qs2{q0, q1, q2};
+            std::vector<name_type> names{"H", "He", "Li"};
+            std::vector<atomic_number_type> zs{1, 2, 3};
+            std::vector<mass_type> masses{1.0, 4.0, 7.0};
+            contiguous_type contiguous(qs2, names.data(), zs.data(),
+                                       masses.data());
+            REQUIRE(contiguous.are_equal(values));
+            REQUIRE(values.are_equal(contiguous));
+        }
+
+        SECTION("Different names") {
+            auto atoms2    = atoms;
+            atoms2[0].name = "foo";
+            auto& b0       = atoms2[0];
+            pimpl_type other(qs, &b0.name, &b0.Z, &b0.mass, s);
+            REQUIRE_FALSE(other == values);
+        }
+
+        SECTION("Different atomic numbers") {
+            auto atoms2 = atoms;
+            atoms2[2].Z = 42;
+            auto& b0    = atoms2[0];
+            pimpl_type other(qs, &b0.name, &b0.Z, &b0.mass, s);
+            REQUIRE_FALSE(other == values);
+        }
+
+        SECTION("Different masses") {
+            auto atoms2    = atoms;
+            atoms2[1].mass = 1.23;
+            auto& b0       = atoms2[0];
+            pimpl_type other(qs, &b0.name, &b0.Z, &b0.mass, s);
+            REQUIRE_FALSE(other == values);
+        }
+    }
+}
+
+TEST_CASE("StridedNucleiView<T>") {
+    using nuclei_type = chemist::Nuclei;
+    strided_nuclei_guts<nuclei_type>();
+}
+
+TEST_CASE("StridedNucleiView<const T>") {
+    using nuclei_type = chemist::Nuclei;
+    strided_nuclei_guts<const nuclei_type>();
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/nucleus/interned_name.hpp>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <utility>
+
+using namespace chemist;
+
+TEST_CASE("InternedName") {
+    InternedName defaulted;
+    InternedName h("H");
+    InternedName he(std::string("He"));
+
+    SECTION("Ctors") {
+        SECTION("Default") {
+            REQUIRE(defaulted.empty());
+            REQUIRE(defaulted.size() == 0);
+            REQUIRE(defaulted == InternedName(""));
+        }
+
+        SECTION("Value") {
+            REQUIRE(h.str() == "H");
+            REQUIRE(he.str() == "He");
+            REQUIRE(std::string(he.c_str()) == "He");
+            REQUIRE(he.size() == 2);
+            REQUIRE_FALSE(he.empty());
+        }
+
+        SECTION("Same value, same entry") {
+            InternedName other(std::string_view("He"));
+            REQUIRE(&other.str() == &he.str());
+        }
+
+        SECTION("Copy") {
+            InternedName copy(he);
+            REQUIRE(copy == he);
+            REQUIRE(&copy.str() == &he.str());
+        }
+
+        SECTION("Assignment") {
+            InternedName copy(he);
+            copy = "Li";
+            REQUIRE(copy == "Li");
+            REQUIRE(he == "He"); // Other names are unaffected
+        }
+    }
+
+    SECTION("Table") {
+        const auto n0 = InternedName::table_size();
+        InternedName a("InternedName unit test");
+        REQUIRE(InternedName::table_size() == n0 + 1);
+        InternedName b("InternedName unit test");
+        REQUIRE(InternedName::table_size() == n0 + 1);
+
+        // The empty name is not stored in the table
+        InternedName c{std::string_view{}};
+        REQUIRE(InternedName::table_size() == n0 + 1);
+        REQUIRE(&c.str() == &defaulted.str());
+    }
+
+    SECTION("Conversion to std::string") {
+        const std::string& str = he;
+        REQUIRE(str == "He");
+    }
+
+    SECTION("swap") {
+        h.swap(he);
+        REQUIRE(h == "He");
+        REQUIRE(he == "H");
+    }
+
+    SECTION("Comparisons") {
+        REQUIRE(h == InternedName("H"));
+        REQUIRE_FALSE(h == he);
+        REQUIRE(h == std::string("H"));
+        REQUIRE(h == "H");
+        REQUIRE_FALSE(h == "He");
+        REQUIRE(h != he);
+        REQUIRE(h != "He");
+
+        REQUIRE(h < he);
+        REQUIRE_FALSE(he < h);
+        REQUIRE_FALSE(h < h);
+        REQUIRE(defaulted < h);
+    }
+
+    SECTION("Hash") {
+        std::hash<InternedName> hasher;
+        REQUIRE(hasher(h) == hasher(InternedName("H")));
+    }
+
+    SECTION("Printing") {
+        std::stringstream ss;
+        ss << he;
+        REQUIRE(ss.str() == "He");
+    }
+}
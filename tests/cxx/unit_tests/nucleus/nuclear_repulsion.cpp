@@ -0,0 +1,217 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/nucleus/nuclear_repulsion.hpp>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace chemist;
+
+/* Testing Notes:
+ *
+ * The energies are checked against a double loop, the gradients against
+ * finite differences of the energy, and the Hessians against finite
+ * differences of the gradient. A larger random system checks the threaded
+ * code paths against the same double loop.
+ */
+
+namespace {
+
+Nuclei random_nuclei(std::size_t n, unsigned int seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(-20.0, 20.0);
+    std::uniform_int_distribution<std::size_t> zs(1, 10);
+    Nuclei rv;
+    for(std::size_t i = 0; i < n; ++i) {
+        const auto Z = zs(gen);
+        const auto x = dist(gen), y = dist(gen), z = dist(gen);
+        rv.push_back(Nucleus("X", Z, 2.0 * Z, x, y, z));
+    }
+    return rv;
+}
+
+double brute_force(const Nuclei& nukes) {
+    double rv = 0.0;
+    for(std::size_t i = 0; i < nukes.size(); ++i)
+        for(std::size_t j = i + 1; j < nukes.size(); ++j) {
+            const double dx = nukes[i].x() - nukes[j].x();
+            const double dy = nukes[i].y() - nukes[j].y();
+            const double dz = nukes[i].z() - nukes[j].z();
+            const double r  = std::sqrt(dx * dx + dy * dy + dz * dz);
+            rv += nukes[i].charge() * nukes[j].charge() / r;
+        }
+    return rv;
+}
+
+/// Central finite difference of f with respect to the coordinates of nukes
+template<typename FxnType>
+std::vector<double> finite_difference(Nuclei nukes, FxnType&& f) {
+    const double h = 1.0E-4;
+    std::vector<double> rv;
+    for(std::size_t i = 0; i < nukes.size(); ++i) {
+        for(std::size_t k = 0; k < 3; ++k) {
+            auto& r = nukes[i].coord(k);
+            r += h;
+            auto fp = f(nukes);
+            r -= 2.0 * h;
+            auto fm = f(nukes);
+            r += h;
+            for(std::size_t j = 0; j < fp.size(); ++j)
+                rv.push_back((fp[j] - fm[j]) / (2.0 * h));
+        }
+    }
+    return rv;
+}
+
+bool all_close(const std::vector<double>& lhs, const std::vector<double>& rhs,
+               double tol) {
+    if(lhs.size() != rhs.size()) return false;
+    for(std::size_t i = 0; i < lhs.size(); ++i)
+        if(std::fabs(lhs[i] - rhs[i]) > tol * (1.0 + std::fabs(rhs[i])))
+            return false;
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("nuclear_repulsion") {
+    using view_type        = NucleiView<const Nuclei>;
+    using member_list_type = typename view_type::member_list_type;
+
+    Nucleus o("O", 8ul, 15.999, 0.0, 0.0, 0.2217);
+    Nucleus h1("H", 1ul, 1.008, 0.0, 1.4309, -0.8867);
+    Nucleus h2("H", 1ul, 1.008, 0.0, -1.4309, -0.8867);
+    Nuclei water{o, h1, h2};
+
+    auto energy = [](const Nuclei& n) {
+        return std::vector<double>{nuclear_repulsion_energy(n)};
+    };
+    auto gradient = [](const Nuclei& n) {
+        return nuclear_repulsion_gradient(n);
+    };
+
+    SECTION("Energy") {
+        REQUIRE(nuclear_repulsion_energy(Nuclei{}) == 0.0);
+        REQUIRE(nuclear_repulsion_energy(Nuclei{o}) == 0.0);
+        REQUIRE(nuclear_repulsion_energy(water) == Approx(brute_force(water)));
+
+        // Ghost atoms don't contribute
+        Nucleus ghost("O", 8ul, 15.999, 3.0, 0.0, 0.0, 0.0);
+        Nuclei with_ghost{o, h1, h2, ghost};
+        REQUIRE(nuclear_repulsion_energy(with_ghost) ==
+                Approx(brute_force(water)));
+    }
+
+    SECTION("Gradient") {
+        auto g = nuclear_repulsion_gradient(water);
+        REQUIRE(g.size() == 9);
+        REQUIRE(all_close(g, finite_difference(water, energy), 1.0E-6));
+
+        // Translational invariance
+        for(std::size_t k = 0; k < 3; ++k)
+            REQUIRE(g[k] + g[3 + k] + g[6 + k] ==
+                    Approx(0.0).margin(1.0E-12));
+    }
+
+    SECTION("Hessian") {
+        auto H = nuclear_repulsion_hessian(water);
+        REQUIRE(H.size() == 81);
+        REQUIRE(all_close(H, finite_difference(water, gradient), 1.0E-6));
+        for(std::size_t i = 0; i < 9; ++i)
+            for(std::size_t j = 0; j < i; ++j)
+                REQUIRE(H[i * 9 + j] == Approx(H[j * 9 + i]));
+    }
+
+    SECTION("Large system") {
+        auto nukes = random_nuclei(700, 3);
+        REQUIRE(nuclear_repulsion_energy(nukes) ==
+                Approx(brute_force(nukes)).epsilon(1.0E-12));
+
+        // Gradients and Hessians sum to zero over the nuclei
+        auto g    = nuclear_repulsion_gradient(nukes);
+        double gx = 0.0;
+        for(std::size_t i = 0; i < nukes.size(); ++i) gx += g[3 * i];
+        REQUIRE(gx == Approx(0.0).margin(1.0E-8));
+
+        auto H         = nuclear_repulsion_hessian(nukes);
+        const auto ld  = 3 * nukes.size();
+        double row_sum = 0.0;
+        for(std::size_t j = 0; j < nukes.size(); ++j) row_sum += H[3 * j + 1];
+        REQUIRE(row_sum == Approx(0.0).margin(1.0E-8));
+        REQUIRE(H[5 * ld + 7] == Approx(H[7 * ld + 5]));
+    }
+
+    SECTION("NucleiView") {
+        view_type view(water);
+        REQUIRE(nuclear_repulsion_energy(view) ==
+                nuclear_repulsion_energy(water));
+        REQUIRE(nuclear_repulsion_gradient(view) ==
+                nuclear_repulsion_gradient(water));
+        REQUIRE(nuclear_repulsion_hessian(view) ==
+                nuclear_repulsion_hessian(water));
+
+        view_type oh(water, member_list_type{0, 1});
+        REQUIRE(nuclear_repulsion_energy(oh) ==
+                Approx(brute_force(Nuclei{o, h1})));
+    }
+
+    SECTION("Interaction") {
+        auto nukes = random_nuclei(300, 5);
+        member_list_type a_members(120), b_members(180);
+        std::iota(a_members.begin(), a_members.end(), std::size_t{0});
+        std::iota(b_members.begin(), b_members.end(), std::size_t{120});
+        view_type a(nukes, a_members);
+        view_type b(nukes, b_members);
+
+        // E(A U B) - E(A) - E(B)
+        const auto corr = nuclear_repulsion_energy(nukes) -
+                          nuclear_repulsion_energy(a) -
+                          nuclear_repulsion_energy(b);
+        REQUIRE(nuclear_interaction_energy(a, b) == Approx(corr));
+        REQUIRE(nuclear_interaction_energy(b, a) == Approx(corr));
+
+        auto g = nuclear_interaction_gradient(a, b);
+        {
+            auto g_ab = nuclear_repulsion_gradient(nukes);
+            auto g_a  = nuclear_repulsion_gradient(a);
+            auto g_b  = nuclear_repulsion_gradient(b);
+            for(std::size_t i = 0; i < g_a.size(); ++i) g_ab[i] -= g_a[i];
+            for(std::size_t i = 0; i < g_b.size(); ++i)
+                g_ab[g_a.size() + i] -= g_b[i];
+            REQUIRE(all_close(g, g_ab, 1.0E-10));
+        }
+
+        auto H = nuclear_interaction_hessian(a, b);
+        {
+            auto H_ab     = nuclear_repulsion_hessian(nukes);
+            auto H_a      = nuclear_repulsion_hessian(a);
+            auto H_b      = nuclear_repulsion_hessian(b);
+            const auto ld = 3 * nukes.size();
+            const auto na = 3 * a.size();
+            const auto nb = 3 * b.size();
+            for(std::size_t i = 0; i < na; ++i)
+                for(std::size_t j = 0; j < na; ++j)
+                    H_ab[i * ld + j] -= H_a[i * na + j];
+            for(std::size_t i = 0; i < nb; ++i)
+                for(std::size_t j = 0; j < nb; ++j)
+                    H_ab[(na + i) * ld + na + j] -= H_b[i * nb + j];
+            REQUIRE(all_close(H, H_ab, 1.0E-10));
+        }
+    }
+}
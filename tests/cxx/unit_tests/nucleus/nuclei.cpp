@@ -18,6 +18,7 @@
 #include <cereal/archives/binary.hpp>
 #include <chemist/nucleus/nuclei.hpp>
 #include <sstream>
+#include <utility>
 
 using namespace chemist;
 
@@ -60,6 +61,29 @@ TEST_CASE("Nuclei") {
             REQUIRE(range == nuclei);
         }
 
+        SECTION("columns") {
+            using charges_type = typename set_type::charge_set_type;
+            using charge_type  = typename charges_type::value_type;
+            charges_type qs{charge_type(0.0, 0.0, 0.0, 0.0),
+                            charge_type(4.0, 1.0, 2.0, 3.0),
+                            charge_type(4.0, 1.0, 2.0, 3.0),
+                            charge_type(5.0, 5.0, 6.0, 7.0)};
+            std::vector<Nucleus::name_type> names{"", "H", "H", "He"};
+            std::vector<unsigned int> Zs{0, 1, 1, 2};
+            std::vector<double> masses{0.0, 0.0, 0.0, 4.0};
+            auto pnames = names.data();
+
+            set_type bulk(qs, std::move(names), Zs, masses);
+            REQUIRE(bulk == nuclei);
+            REQUIRE(bulk.name_data() == pnames); // Adopted, not copied
+
+            std::vector<double> too_short{0.0};
+            using error_t = std::runtime_error;
+            REQUIRE_THROWS_AS(set_type(qs, {}, Zs, masses), error_t);
+            REQUIRE_THROWS_AS(set_type(qs, {"", "H", "H", "He"}, Zs, too_short),
+                              error_t);
+        }
+
         SECTION("Copy") {
             set_type copy0(defaulted);
             set_type copy1(nuclei);
@@ -115,6 +139,68 @@ TEST_CASE("Nuclei") {
         }
     }
 
+    SECTION("reserve") {
+        defaulted.reserve(10);
+        REQUIRE(defaulted.size() == 0);
+        defaulted.push_back(n0);
+        auto pZ = defaulted.atomic_number_data();
+        for(std::size_t i = 1; i < 10; ++i) defaulted.push_back(n1);
+        REQUIRE(defaulted.atomic_number_data() == pZ);
+    }
+
+    SECTION("permute") {
+        nuclei.permute({3, 1, 2, 0});
+        REQUIRE(nuclei == set_type{n2, n1, n1, n0});
+
+        defaulted.permute({});
+        REQUIRE(defaulted == set_type{});
+
+        using error_t = std::runtime_error;
+        REQUIRE_THROWS_AS(nuclei.permute({0, 1, 2}), error_t);
+        REQUIRE(nuclei == set_type{n2, n1, n1, n0});
+    }
+
+    SECTION("reorder") {
+        REQUIRE(defaulted.reorder().empty());
+
+        auto p = nuclei.reorder();
+        REQUIRE(p.size() == 4);
+        set_type corr{n0, n1, n1, n2};
+        for(std::size_t i = 0; i < p.size(); ++i)
+            REQUIRE(nuclei[i] == corr[p[i]]);
+    }
+
+    SECTION("transform") {
+        using affine_type = typename set_type::affine_type;
+        auto shift        = affine_type::translation({1.0, 1.0, 1.0});
+        value_type m0("", 0ul, 0.0, 1.0, 1.0, 1.0, 0.0);
+        value_type m1("H", 1ul, 0.0, 2.0, 3.0, 4.0, 4.0);
+        value_type m2("He", 2ul, 4.0, 6.0, 7.0, 8.0, 5.0);
+        auto moved = nuclei.transformed(shift);
+        REQUIRE(moved == set_type{m0, m1, m1, m2});
+        REQUIRE(nuclei == set_type{n0, n1, n1, n2});
+        nuclei.transform(shift);
+        REQUIRE(nuclei == moved);
+
+        defaulted.transform(shift);
+        REQUIRE(defaulted.transformed(shift) == set_type{});
+    }
+
+    SECTION("atomic_number_column, mass_column") {
+        REQUIRE(defaulted.atomic_number_column().empty());
+        REQUIRE(defaulted.mass_column().empty());
+
+        auto Zs = nuclei.atomic_number_column();
+        REQUIRE(Zs.size() == 4);
+        REQUIRE(Zs.data() == nuclei.atomic_number_data());
+        REQUIRE(Zs[3] == n2.Z());
+
+        auto ms = nuclei.mass_column();
+        ms[1]   = 1.5;
+        REQUIRE(nuclei[1].mass() == 1.5);
+        REQUIRE(std::as_const(nuclei).mass_column()[3] == n2.mass());
+    }
+
     SECTION("push_back") {
         defaulted.push_back(n0);
         defaulted.push_back(n1);
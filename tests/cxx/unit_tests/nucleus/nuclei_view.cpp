@@ -19,6 +19,7 @@
 #include <chemist/nucleus/detail_/contiguous_nuclei_view.hpp>
 #include <chemist/nucleus/nuclei_view.hpp>
 #include <sstream>
+#include <stdexcept>
 
 using namespace chemist;
 
@@ -87,6 +88,32 @@ void test_nuclei_view() {
             REQUIRE(pointers[1] == n1);
         }
 
+        SECTION("Strided pointers") {
+            struct Atom {
+                double x, y, z, q;
+                Nucleus::name_type name;
+                unsigned int Z;
+                double mass;
+            };
+            std::vector<Atom> atoms{{1.0, 2.0, 3.0, 4.0, "H", 1, 0.0},
+                                    {5.0, 6.0, 7.0, 5.0, "He", 2, 4.0}};
+            const auto s = sizeof(Atom);
+            auto& a0     = atoms[0];
+
+            using charges_reference = typename view_type::charges_reference;
+            using point_set_reference =
+              typename charges_reference::point_set_reference;
+            point_set_reference points(2, &a0.x, &a0.y, &a0.z, s);
+            charges_reference qs(points, &a0.q, s);
+            view_type strided(qs, &a0.name, &a0.Z, &a0.mass, s);
+
+            REQUIRE(strided.size() == 2);
+            REQUIRE(strided[0] == n0);
+            REQUIRE(strided[1] == n1);
+            REQUIRE(strided == value);
+            REQUIRE(&strided[1].name() == &atoms[1].name);
+        }
+
         SECTION("Subset") {
             view_type empty_subset(value, member_list_type{});
             REQUIRE(empty_subset.size() == 0);
@@ -239,6 +266,29 @@ void test_nuclei_view() {
         REQUIRE(value.size() == 2);
     }
 
+    SECTION("is_contiguous") {
+        REQUIRE(defaulted.is_contiguous());
+        REQUIRE(empty.is_contiguous());
+        REQUIRE(value.is_contiguous());
+        REQUIRE_FALSE(view_type(value, member_list_type{1, 0}).is_contiguous());
+    }
+
+    SECTION("atomic_number_column, mass_column") {
+        REQUIRE(defaulted.atomic_number_column().empty());
+        REQUIRE(std::as_const(empty).mass_column().empty());
+
+        auto Zs = value.atomic_number_column();
+        REQUIRE(Zs.size() == 2);
+        REQUIRE(Zs.data() == value_set.atomic_number_data());
+        REQUIRE(Zs[1] == n1.Z());
+        REQUIRE(std::as_const(value).mass_column()[1] == n1.mass());
+
+        view_type subset(value, member_list_type{1, 0});
+        REQUIRE_THROWS_AS(subset.atomic_number_column(), std::runtime_error);
+        REQUIRE_THROWS_AS(std::as_const(subset).mass_column(),
+                          std::runtime_error);
+    }
+
     SECTION("swap") {
         auto lhs_copy(defaulted);
         auto rhs_copy(value);
@@ -252,6 +302,51 @@ void test_nuclei_view() {
     SECTION("as_nuclei") {
         REQUIRE(defaulted.as_nuclei() == defaulted_set);
         REQUIRE(value.as_nuclei() == value_set);
+
+        // Subsets
+        set_type reversed{n1, n0};
+        view_type subset(value, member_list_type{1, 0});
+        REQUIRE(subset.as_nuclei() == reversed);
+        REQUIRE(view_type(subset, member_list_type{1}).as_nuclei() ==
+                set_type{n0});
+
+        // Strided
+        struct Atom {
+            double x, y, z, q;
+            Nucleus::name_type name;
+            unsigned int Z;
+            double mass;
+        };
+        std::vector<Atom> atoms{{1.0, 2.0, 3.0, 4.0, "H", 1, 0.0},
+                                {5.0, 6.0, 7.0, 5.0, "He", 2, 4.0}};
+        const auto s = sizeof(Atom);
+        auto& a0     = atoms[0];
+
+        using charges_reference = typename view_type::charges_reference;
+        using point_set_reference =
+          typename charges_reference::point_set_reference;
+        point_set_reference points(2, &a0.x, &a0.y, &a0.z, s);
+        charges_reference qs(points, &a0.q, s);
+        view_type strided(qs, &a0.name, &a0.Z, &a0.mass, s);
+        REQUIRE(strided.as_nuclei() == value_set);
+    }
+
+    SECTION("as_nuclei(members)") {
+        REQUIRE(value.as_nuclei(member_list_type{}) == defaulted_set);
+        REQUIRE(value.as_nuclei(member_list_type{0, 1}) == value_set);
+        REQUIRE(value.as_nuclei(member_list_type{1}) == set_type{n1});
+
+        set_type reversed{n1, n0};
+        REQUIRE(value.as_nuclei(member_list_type{1, 0}) == reversed);
+
+        // Members are relative to *this
+        view_type subset(value, member_list_type{1, 0});
+        REQUIRE(subset.as_nuclei(member_list_type{0}) == set_type{n1});
+
+        REQUIRE_THROWS_AS(value.as_nuclei(member_list_type{2}),
+                          std::out_of_range);
+        REQUIRE_THROWS_AS(defaulted.as_nuclei(member_list_type{0}),
+                          std::out_of_range);
     }
 
     SECTION("operator==(NucleiView)") {
@@ -0,0 +1,111 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/nucleus/periodic_table.hpp>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace chemist;
+
+// The look ups are usable at compile time
+static_assert(element(6).symbol == "C");
+static_assert(atomic_number("Fe") == 26);
+static_assert(element("rn").Z == 86);
+static_assert(!is_element(0u));
+static_assert(!is_element("Xx"));
+
+TEST_CASE("periodic_table") {
+    SECTION("Table is consistent") {
+        REQUIRE(max_atomic_number == 86);
+        for(const auto& e : periodic_table) {
+            REQUIRE(&element(e.Z) == &e);
+            REQUIRE(&element(e.symbol) == &e);
+            REQUIRE(e.mass > 0.0);
+            REQUIRE(e.covalent_radius > 0.0);
+            REQUIRE(e.vdw_radius > 0.0);
+            // Multiplicity of a neutral atom has the parity of its electrons
+            REQUIRE((e.Z + e.multiplicity) % 2 == 1);
+        }
+    }
+
+    SECTION("Units") {
+        const auto& h = element(1);
+        REQUIRE(h.mass_au() == Approx(1837.15264));
+        REQUIRE(h.covalent_radius_au() == Approx(0.585815));
+        REQUIRE(h.vdw_radius_au() == Approx(2.267671));
+    }
+
+    SECTION("Symbols") {
+        REQUIRE(atomic_number("He") == 2);
+        REQUIRE(atomic_number("HE") == 2);
+        REQUIRE(atomic_number("he") == 2);
+        REQUIRE(atomic_number("H") == 1);
+        REQUIRE(atomic_number("Co") == 27);
+        REQUIRE_FALSE(is_element(""));
+        REQUIRE_FALSE(is_element("Hee"));
+        REQUIRE_FALSE(is_element("1"));
+        REQUIRE_FALSE(is_element("J"));
+        REQUIRE_THROWS_AS(atomic_number("Xx"), std::runtime_error);
+        REQUIRE_THROWS_AS(element("Xx"), std::runtime_error);
+    }
+
+    SECTION("Atomic numbers") {
+        REQUIRE(is_element(1u));
+        REQUIRE(is_element(86u));
+        REQUIRE_FALSE(is_element(87u));
+        REQUIRE_THROWS_AS(element(0), std::out_of_range);
+        REQUIRE_THROWS_AS(element(87), std::out_of_range);
+    }
+
+    SECTION("make_nucleus") {
+        const auto& o = element(8);
+        Nucleus corr("O", 8ul, o.mass_au(), 1.0, 2.0, 3.0);
+        REQUIRE(make_nucleus(8, 1.0, 2.0, 3.0) == corr);
+        REQUIRE(make_nucleus("o", 1.0, 2.0, 3.0) == corr);
+        REQUIRE(make_nucleus("O") == Nucleus("O", 8ul, o.mass_au()));
+        REQUIRE_THROWS_AS(make_nucleus(0), std::out_of_range);
+        REQUIRE_THROWS_AS(make_nucleus("Xx"), std::runtime_error);
+    }
+
+    SECTION("make_nuclei") {
+        std::vector<Element::atomic_number_type> Zs{8, 1, 1};
+        std::vector<std::string_view> views{"O", "H", "h"};
+        std::vector<std::string> strings{"O", "H", "H"};
+        std::vector<double> x{0.0, 0.0, 0.0};
+        std::vector<double> y{0.0, 1.4309, -1.4309};
+        std::vector<double> z{0.2217, -0.8867, -0.8867};
+
+        Nuclei corr{make_nucleus(8, x[0], y[0], z[0]),
+                    make_nucleus(1, x[1], y[1], z[1]),
+                    make_nucleus(1, x[2], y[2], z[2])};
+
+        REQUIRE(make_nuclei(Zs, x, y, z) == corr);
+        REQUIRE(make_nuclei(views, x, y, z) == corr);
+        REQUIRE(make_nuclei(strings, x, y, z) == corr);
+        REQUIRE(make_nuclei(std::span<const std::string>{}, {}, {}, {}) ==
+                Nuclei{});
+
+        std::vector<double> too_short{0.0};
+        REQUIRE_THROWS_AS(make_nuclei(Zs, too_short, y, z), std::runtime_error);
+        Zs[1] = 0;
+        REQUIRE_THROWS_AS(make_nuclei(Zs, x, y, z), std::out_of_range);
+        views[1] = "Xx";
+        REQUIRE_THROWS_AS(make_nuclei(views, x, y, z), std::runtime_error);
+    }
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/point/affine_transform.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace chemist;
+
+TEMPLATE_TEST_CASE("AffineTransform", "", float, double) {
+    using affine_type = AffineTransform<TestType>;
+    using matrix_type = typename affine_type::matrix_type;
+    using vector_type = typename affine_type::vector_type;
+    using point_type  = typename affine_type::point_type;
+
+    const TestType pi = 3.14159265358979323846;
+
+    // 90 degree rotation about z, i.e., (x, y, z) -> (-y, x, z)
+    matrix_type Rz{0.0, -1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0};
+    vector_type t{1.0, 2.0, 3.0};
+    matrix_type I{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+
+    affine_type defaulted;
+    affine_type shift = affine_type::translation(t);
+    affine_type rot   = affine_type::rotation(Rz);
+    affine_type both(Rz, t);
+
+    point_type r(1.0, 2.0, 3.0);
+
+    SECTION("Ctors") {
+        SECTION("Default") {
+            REQUIRE(defaulted.linear_part() == I);
+            REQUIRE(defaulted.translation_part() == vector_type{0.0, 0.0, 0.0});
+        }
+        SECTION("Value") {
+            REQUIRE(both.linear_part() == Rz);
+            REQUIRE(both.translation_part() == t);
+        }
+        SECTION("translation") {
+            REQUIRE(shift.linear_part() == I);
+            REQUIRE(shift.translation_part() == t);
+        }
+        SECTION("rotation") {
+            REQUIRE(rot.linear_part() == Rz);
+            REQUIRE(rot.translation_part() == vector_type{0.0, 0.0, 0.0});
+        }
+        SECTION("rotation_about") {
+            auto rv = affine_type::rotation_about({0.0, 0.0, 2.0}, pi / 2);
+            for(std::size_t i = 0; i < 9; ++i)
+                REQUIRE(rv.linear_part()[i] ==
+                        Approx(Rz[i]).margin(1.0E-6));
+
+            // Rotating about the axis leaves points on the axis alone
+            vector_type axis{1.0, 1.0, 1.0};
+            auto r111 = affine_type::rotation_about(axis, 1.234);
+            auto rv2  = r111(point_type(2.0, 2.0, 2.0));
+            REQUIRE(rv2.x() == Approx(2.0));
+            REQUIRE(rv2.y() == Approx(2.0));
+            REQUIRE(rv2.z() == Approx(2.0));
+
+            // Three 120 degree rotations about (1,1,1) cycle x -> y -> z
+            auto cycle = affine_type::rotation_about(axis, 2 * pi / 3);
+            auto ry    = cycle(point_type(1.0, 0.0, 0.0));
+            REQUIRE(ry.x() == Approx(0.0).margin(1.0E-6));
+            REQUIRE(ry.y() == Approx(1.0));
+            REQUIRE(ry.z() == Approx(0.0).margin(1.0E-6));
+
+            using error_t = std::runtime_error;
+            REQUIRE_THROWS_AS(affine_type::rotation_about({0.0, 0.0, 0.0}, 1.0),
+                              error_t);
+        }
+    }
+
+    SECTION("is_translation") {
+        REQUIRE(defaulted.is_translation());
+        REQUIRE(shift.is_translation());
+        REQUIRE_FALSE(rot.is_translation());
+        REQUIRE_FALSE(both.is_translation());
+    }
+
+    SECTION("operator()") {
+        REQUIRE(defaulted(r) == r);
+        REQUIRE(shift(r) == point_type(2.0, 4.0, 6.0));
+        REQUIRE(rot(r) == point_type(-2.0, 1.0, 3.0));
+        REQUIRE(both(r) == point_type(-1.0, 3.0, 6.0));
+    }
+
+    SECTION("apply") {
+        // Enough points to take the threaded path (if it exists)
+        const std::size_t n = 100000;
+        std::vector<TestType> x(n), y(n), z(n);
+        for(std::size_t i = 0; i < n; ++i) {
+            x[i] = TestType(i % 17);
+            y[i] = TestType(i % 5);
+            z[i] = TestType(i % 3);
+        }
+        std::vector<TestType> ox(n), oy(n), oz(n);
+        both.apply(n, x.data(), y.data(), z.data(), ox.data(), oy.data(),
+                   oz.data());
+        bool all_good = true;
+        for(std::size_t i = 0; i < n; ++i) {
+            auto corr = both(point_type(x[i], y[i], z[i]));
+            all_good  = all_good && point_type(ox[i], oy[i], oz[i]) == corr;
+        }
+        REQUIRE(all_good);
+
+        // In place
+        shift.apply(n, x.data(), y.data(), z.data(), x.data(), y.data(),
+                    z.data());
+        REQUIRE(x[18] == TestType(2.0));
+        REQUIRE(y[18] == TestType(5.0));
+        REQUIRE(z[18] == TestType(3.0));
+
+        // No points is a no-op
+        defaulted.apply(0, nullptr, nullptr, nullptr, nullptr, nullptr,
+                        nullptr);
+    }
+
+    SECTION("operator*") {
+        REQUIRE(defaulted * both == both);
+        REQUIRE(both * defaulted == both);
+
+        // Rotate, then translate
+        REQUIRE(shift * rot == both);
+
+        // Translate, then rotate
+        auto rv = rot * shift;
+        REQUIRE(rv(r) == rot(shift(r)));
+        REQUIRE(rv.translation_part() == vector_type{-2.0, 1.0, 3.0});
+
+        // Four 90 degree rotations are the identity
+        REQUIRE(rot * rot * rot * rot == defaulted);
+    }
+
+    SECTION("operator==/operator!=") {
+        REQUIRE(defaulted == affine_type{});
+        REQUIRE(both == affine_type(Rz, t));
+        REQUIRE_FALSE(defaulted == shift);
+        REQUIRE(shift != rot);
+        REQUIRE_FALSE(both != affine_type(Rz, t));
+    }
+}
@@ -130,3 +130,19 @@ TEST_CASE("PointPIMPL<double> : coord const") {
         STATIC_REQUIRE(std::is_const_v<r_type>);
     }
 }
+
+TEST_CASE("PointPIMPL<double> : operator new/delete") {
+    using pool_type = chemist::detail_::FreeListPool<sizeof(pimpl_t)>;
+
+    auto* p = new pimpl_t(1.0, 2.0, 3.0);
+    compare_coords(*p, std::vector{1, 2, 3});
+    const auto n_cached = pool_type::cached();
+    delete p;
+    REQUIRE(pool_type::cached() == n_cached + 1);
+
+    SECTION("Storage is recycled") {
+        auto p2 = std::make_unique<pimpl_t>(4.0, 5.0, 6.0);
+        REQUIRE(pool_type::cached() == n_cached);
+        compare_coords(*p2, std::vector{4, 5, 6});
+    }
+}
@@ -99,6 +99,18 @@ void test_point_set_contiguous_guts() {
         REQUIRE(three_points_copy->are_equal(three_points));
     }
 
+    SECTION("as_const") {
+        auto no_points_copy = no_points.as_const();
+        REQUIRE(no_points_copy->size() == 0);
+
+        auto three_points_copy = three_points.as_const();
+        REQUIRE(three_points_copy->size() == 3);
+        REQUIRE((*three_points_copy)[0] == cp0);
+        REQUIRE((*three_points_copy)[1] == cp1);
+        REQUIRE((*three_points_copy)[2] == cp2);
+        REQUIRE(&(*three_points_copy)[2].x() == &x[2]);
+    }
+
     SECTION("size") {
         REQUIRE(defaulted.size() == 0);
         REQUIRE(no_points.size() == 0);
@@ -0,0 +1,187 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../catch.hpp"
+#include <chemist/point/detail_/point_set_contiguous.hpp>
+#include <chemist/point/detail_/point_set_strided.hpp>
+#include <utility>
+#include <vector>
+
+template<typename PointSetType>
+void test_point_set_strided_guts() {
+    using point_set_type = PointSetType;
+    using coord_type     = typename point_set_type::value_type::coord_type;
+    using pimpl_type     = chemist::detail_::PointSetStrided<point_set_type>;
+    using reference      = typename pimpl_type::reference;
+    using const_reference = typename pimpl_type::const_reference;
+    using contiguous_type =
+      chemist::detail_::PointSetContiguous<point_set_type>;
+
+    // Interleaved x0, y0, z0, x1, ...
+    std::vector<coord_type> xyz{1.1, 2.1, 3.1, 1.2, 2.2, 3.2, 1.3, 2.3, 3.3};
+    auto* pxyz            = xyz.data();
+    const std::size_t s   = 3 * sizeof(coord_type);
+    const std::size_t one = sizeof(coord_type);
+
+    pimpl_type defaulted;
+    pimpl_type no_points(0, pxyz, pxyz + 1, pxyz + 2, s);
+    pimpl_type one_point(1, pxyz, pxyz + 1, pxyz + 2, s);
+    pimpl_type three_points(3, pxyz, pxyz + 1, pxyz + 2, s);
+
+    reference p0(xyz[0], xyz[1], xyz[2]);
+    reference p1(xyz[3], xyz[4], xyz[5]);
+    reference p2(xyz[6], xyz[7], xyz[8]);
+
+    const_reference cp0(xyz[0], xyz[1], xyz[2]);
+    const_reference cp1(xyz[3], xyz[4], xyz[5]);
+    const_reference cp2(xyz[6], xyz[7], xyz[8]);
+
+    SECTION("Ctors") {
+        SECTION("Default") { REQUIRE(defaulted.size() == 0); }
+        SECTION("value") {
+            REQUIRE(no_points.size() == 0);
+
+            REQUIRE(one_point.size() == 1);
+            REQUIRE(one_point[0] == p0);
+
+            REQUIRE(three_points.size() == 3);
+            REQUIRE(three_points[0] == p0);
+            REQUIRE(three_points[1] == p1);
+            REQUIRE(three_points[2] == p2);
+        }
+        SECTION("aliases") {
+            REQUIRE(&three_points[2].x() == pxyz + 6);
+            REQUIRE(&three_points[2].y() == pxyz + 7);
+            REQUIRE(&three_points[2].z() == pxyz + 8);
+        }
+        SECTION("copy") {
+            pimpl_type defaulted_copy(defaulted);
+            REQUIRE(defaulted_copy == defaulted);
+
+            pimpl_type three_point_copy(three_points);
+            REQUIRE(three_point_copy == three_points);
+        }
+    }
+
+    SECTION("clone") {
+        auto defaulted_copy = defaulted.clone();
+        REQUIRE(defaulted_copy->are_equal(defaulted));
+
+        auto three_points_copy = three_points.clone();
+        REQUIRE(three_points_copy->are_equal(three_points));
+    }
+
+    SECTION("as_const") {
+        auto no_points_copy = no_points.as_const();
+        REQUIRE(no_points_copy->size() == 0);
+
+        auto three_points_copy = three_points.as_const();
+        REQUIRE(three_points_copy->size() == 3);
+        REQUIRE((*three_points_copy)[0] == cp0);
+        REQUIRE((*three_points_copy)[1] == cp1);
+        REQUIRE((*three_points_copy)[2] == cp2);
+        REQUIRE(&(*three_points_copy)[2].x() == pxyz + 6);
+    }
+
+    SECTION("size") {
+        REQUIRE(defaulted.size() == 0);
+        REQUIRE(no_points.size() == 0);
+        REQUIRE(one_point.size() == 1);
+        REQUIRE(three_points.size() == 3);
+    }
+
+    SECTION("operator[]") {
+        REQUIRE(three_points[0] == p0);
+        REQUIRE(three_points[1] == p1);
+        REQUIRE(three_points[2] == p2);
+    }
+
+    SECTION("operator[] const") {
+        REQUIRE(std::as_const(three_points)[0] == cp0);
+        REQUIRE(std::as_const(three_points)[1] == cp1);
+        REQUIRE(std::as_const(three_points)[2] == cp2);
+    }
+
+    SECTION("operator==") {
+        SECTION("Default vs default") {
+            pimpl_type other_defaulted;
+            REQUIRE(other_defaulted == defaulted);
+        }
+
+        SECTION("Default vs empty") { REQUIRE(defaulted == no_points); }
+
+        SECTION("Default vs. non-empty") {
+            REQUIRE_FALSE(defaulted == one_point);
+        }
+
+        SECTION("Same points, same addresses") {
+            pimpl_type other_three(3, pxyz, pxyz + 1, pxyz + 2, s);
+            REQUIRE(three_points == other_three);
+        }
+
+        SECTION("Same points, different layout") {
+            // Same points stored as three contiguous arrays
+            std::vector<coord_type> soa{1.1, 1.2, 1.3, 2.1, 2.2,
+                                        2.3, 3.1, 3.2, 3.3};
+            auto* p = soa.data();
+            pimpl_type other_three(3, p, p + 3, p + 6, one);
+            REQUIRE(three_points == other_three);
+        }
+
+        SECTION("Same points, both contiguous") {
+            std::vector<coord_type> soa{1.1, 1.2, 2.1, 2.2, 3.1, 3.2};
+            auto* p = soa.data();
+            pimpl_type lhs(2, p, p + 2, p + 4, one);
+            std::vector<coord_type> soa2(soa);
+            auto* p2 = soa2.data();
+            pimpl_type rhs(2, p2, p2 + 2, p2 + 4, one);
+            REQUIRE(lhs == rhs);
+        }
+
+        SECTION("Same addresses, different stride") {
+            pimpl_type other_three(3, pxyz, pxyz + 1, pxyz + 2, one);
+            REQUIRE_FALSE(three_points == other_three);
+        }
+
+        SECTION("Different points") {
+            // N.b. we swap x and y to get different coordinates
+            pimpl_type other_three(3, pxyz + 1, pxyz, pxyz + 2, s);
+            REQUIRE_FALSE(three_points == other_three);
+        }
+    }
+
+    SECTION("are_equal") {
+        std::vector<coord_type> x{1.1, 1.2, 1.3};
+        std::vector<coord_type> y{2.1, 2.2, 2.3};
+        std::vector<coord_type> z{3.1, 3.2, 3.3};
+        contiguous_type contiguous(3, x.data(), y.data(), z.data());
+        REQUIRE(three_points.are_equal(contiguous));
+        REQUIRE(contiguous.are_equal(three_points));
+        REQUIRE_FALSE(one_point.are_equal(contiguous));
+    }
+}
+
+TEMPLATE_TEST_CASE("PointSetStrided<T>", "", float, double) {
+    using point_type     = TestType;
+    using point_set_type = chemist::PointSet<point_type>;
+    test_point_set_strided_guts<point_set_type>();
+}
+
+TEMPLATE_TEST_CASE("PointSetStrided<const T>", "", float, double) {
+    using point_type     = TestType;
+    using point_set_type = chemist::PointSet<point_type>;
+    test_point_set_strided_guts<const point_set_type>();
+}
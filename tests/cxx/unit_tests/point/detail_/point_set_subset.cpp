@@ -0,0 +1,155 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../catch.hpp"
+#include <chemist/point/detail_/point_set_contiguous.hpp>
+#include <chemist/point/detail_/point_set_subset.hpp>
+#include <utility>
+#include <vector>
+
+template<typename PointSetType>
+void test_point_set_subset_guts() {
+    using point_set_type = PointSetType;
+    using coord_type     = typename point_set_type::value_type::coord_type;
+    using pimpl_type     = chemist::detail_::PointSetSubset<point_set_type>;
+    using view_type      = typename pimpl_type::parent_type;
+    using member_list_type = typename pimpl_type::member_list_type;
+    using reference        = typename pimpl_type::reference;
+    using const_reference  = typename pimpl_type::const_reference;
+    using contiguous_type =
+      chemist::detail_::PointSetContiguous<point_set_type>;
+
+    std::vector<coord_type> x{1.1, 1.2, 1.3};
+    std::vector<coord_type> y{2.1, 2.2, 2.3};
+    std::vector<coord_type> z{3.1, 3.2, 3.3};
+    view_type supersystem(3, x.data(), y.data(), z.data());
+
+    pimpl_type defaulted;
+    pimpl_type no_points(supersystem, member_list_type{});
+    pimpl_type reversed(supersystem, member_list_type{2, 1, 0});
+    pimpl_type two_points(supersystem, member_list_type{0, 2});
+
+    reference p0(x[0], y[0], z[0]);
+    reference p2(x[2], y[2], z[2]);
+    const_reference cp0(x[0], y[0], z[0]);
+    const_reference cp1(x[1], y[1], z[1]);
+    const_reference cp2(x[2], y[2], z[2]);
+
+    SECTION("Ctors") {
+        SECTION("Default") { REQUIRE(defaulted.size() == 0); }
+        SECTION("value") {
+            REQUIRE(no_points.size() == 0);
+
+            REQUIRE(reversed.size() == 3);
+            REQUIRE(reversed[0] == p2);
+            REQUIRE(reversed[2] == p0);
+
+            REQUIRE(two_points.size() == 2);
+            REQUIRE(two_points[0] == p0);
+            REQUIRE(two_points[1] == p2);
+        }
+        SECTION("aliases") { REQUIRE(&reversed[0].x() == x.data() + 2); }
+        SECTION("copy") {
+            pimpl_type defaulted_copy(defaulted);
+            REQUIRE(defaulted_copy == defaulted);
+
+            pimpl_type reversed_copy(reversed);
+            REQUIRE(reversed_copy == reversed);
+        }
+    }
+
+    SECTION("clone") {
+        auto reversed_copy = reversed.clone();
+        REQUIRE(reversed_copy->are_equal(reversed));
+    }
+
+    SECTION("as_const") {
+        auto reversed_copy = reversed.as_const();
+        REQUIRE(reversed_copy->size() == 3);
+        REQUIRE((*reversed_copy)[0] == cp2);
+        REQUIRE((*reversed_copy)[1] == cp1);
+        REQUIRE((*reversed_copy)[2] == cp0);
+        REQUIRE(&(*reversed_copy)[0].x() == x.data() + 2);
+    }
+
+    SECTION("size") {
+        REQUIRE(defaulted.size() == 0);
+        REQUIRE(no_points.size() == 0);
+        REQUIRE(reversed.size() == 3);
+        REQUIRE(two_points.size() == 2);
+    }
+
+    SECTION("operator[] const") {
+        REQUIRE(std::as_const(two_points)[0] == cp0);
+        REQUIRE(std::as_const(two_points)[1] == cp2);
+    }
+
+    SECTION("operator==") {
+        SECTION("Default vs default") { REQUIRE(defaulted == pimpl_type{}); }
+
+        SECTION("Default vs empty") { REQUIRE(defaulted == no_points); }
+
+        SECTION("Default vs. non-empty") {
+            REQUIRE_FALSE(defaulted == two_points);
+        }
+
+        SECTION("Same supersystem, same members") {
+            pimpl_type other(supersystem, member_list_type{0, 2});
+            REQUIRE(two_points == other);
+        }
+
+        SECTION("Same supersystem, different members") {
+            pimpl_type other(supersystem, member_list_type{2, 0});
+            REQUIRE_FALSE(two_points == other);
+        }
+
+        SECTION("Same supersystem, different members, same points") {
+            std::vector<coord_type> x2{1.1, 1.2, 1.1}, y2{2.1, 2.2, 2.1},
+              z2{3.1, 3.2, 3.1};
+            view_type ss2(3, x2.data(), y2.data(), z2.data());
+            pimpl_type lhs(ss2, member_list_type{0, 1});
+            pimpl_type rhs(ss2, member_list_type{2, 1});
+            REQUIRE(lhs == rhs);
+        }
+
+        SECTION("Different supersystem, same points") {
+            std::vector<coord_type> x2{1.3, 1.1}, y2{2.3, 2.1}, z2{3.3, 3.1};
+            view_type other_ss(2, x2.data(), y2.data(), z2.data());
+            pimpl_type other(other_ss, member_list_type{1, 0});
+            REQUIRE(two_points == other);
+        }
+    }
+
+    SECTION("are_equal") {
+        std::vector<coord_type> x2{1.3, 1.2, 1.1};
+        std::vector<coord_type> y2{2.3, 2.2, 2.1};
+        std::vector<coord_type> z2{3.3, 3.2, 3.1};
+        contiguous_type contiguous(3, x2.data(), y2.data(), z2.data());
+        REQUIRE(reversed.are_equal(contiguous));
+        REQUIRE(contiguous.are_equal(reversed));
+        REQUIRE_FALSE(two_points.are_equal(contiguous));
+    }
+}
+
+TEMPLATE_TEST_CASE("PointSetSubset<T>", "", float, double) {
+    using point_set_type = chemist::PointSet<TestType>;
+    test_point_set_subset_guts<point_set_type>();
+}
+
+TEMPLATE_TEST_CASE("PointSetSubset<const T>", "", float, double) {
+    using point_set_type = chemist::PointSet<TestType>;
+    test_point_set_subset_guts<const point_set_type>();
+}
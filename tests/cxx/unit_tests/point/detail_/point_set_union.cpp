@@ -0,0 +1,157 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../catch.hpp"
+#include <chemist/point/detail_/point_set_contiguous.hpp>
+#include <chemist/point/detail_/point_set_union.hpp>
+#include <utility>
+#include <vector>
+
+template<typename PointSetType>
+void test_point_set_union_guts() {
+    using point_set_type  = PointSetType;
+    using coord_type      = typename point_set_type::value_type::coord_type;
+    using pimpl_type      = chemist::detail_::PointSetUnion<point_set_type>;
+    using view_type       = typename pimpl_type::parent_type;
+    using container_type  = typename pimpl_type::point_set_view_container;
+    using reference       = typename pimpl_type::reference;
+    using const_reference = typename pimpl_type::const_reference;
+    using contiguous_type =
+      chemist::detail_::PointSetContiguous<point_set_type>;
+
+    std::vector<coord_type> x{1.1, 1.2, 1.3};
+    std::vector<coord_type> y{2.1, 2.2, 2.3};
+    std::vector<coord_type> z{3.1, 3.2, 3.3};
+    view_type p01(2, x.data(), y.data(), z.data());
+    view_type p2(1, x.data() + 2, y.data() + 2, z.data() + 2);
+
+    pimpl_type defaulted;
+    pimpl_type no_points(container_type{});
+    pimpl_type has_values(container_type{p01, p2});
+
+    reference r0(x[0], y[0], z[0]);
+    reference r2(x[2], y[2], z[2]);
+    const_reference cr0(x[0], y[0], z[0]);
+    const_reference cr1(x[1], y[1], z[1]);
+    const_reference cr2(x[2], y[2], z[2]);
+
+    SECTION("Ctors") {
+        SECTION("Default") { REQUIRE(defaulted.size() == 0); }
+        SECTION("value") {
+            REQUIRE(no_points.size() == 0);
+
+            REQUIRE(has_values.size() == 3);
+            REQUIRE(has_values[0] == r0);
+            REQUIRE(has_values[2] == r2);
+
+            // Empty members are skipped over
+            pimpl_type has_empties(
+              container_type{view_type{}, p01, view_type{}, p2, view_type{}});
+            REQUIRE(has_empties.size() == 3);
+            REQUIRE(has_empties[0] == r0);
+            REQUIRE(has_empties[2] == r2);
+        }
+        SECTION("aliases") { REQUIRE(&has_values[2].x() == x.data() + 2); }
+        SECTION("copy") {
+            pimpl_type defaulted_copy(defaulted);
+            REQUIRE(defaulted_copy == defaulted);
+
+            pimpl_type has_values_copy(has_values);
+            REQUIRE(has_values_copy == has_values);
+        }
+    }
+
+    SECTION("clone") {
+        auto has_values_copy = has_values.clone();
+        REQUIRE(has_values_copy->are_equal(has_values));
+    }
+
+    SECTION("as_const") {
+        auto has_values_copy = has_values.as_const();
+        REQUIRE(has_values_copy->size() == 3);
+        REQUIRE((*has_values_copy)[0] == cr0);
+        REQUIRE((*has_values_copy)[1] == cr1);
+        REQUIRE((*has_values_copy)[2] == cr2);
+        REQUIRE(&(*has_values_copy)[2].x() == x.data() + 2);
+    }
+
+    SECTION("size") {
+        REQUIRE(defaulted.size() == 0);
+        REQUIRE(no_points.size() == 0);
+        REQUIRE(has_values.size() == 3);
+    }
+
+    SECTION("operator[] const") {
+        REQUIRE(std::as_const(has_values)[0] == cr0);
+        REQUIRE(std::as_const(has_values)[1] == cr1);
+        REQUIRE(std::as_const(has_values)[2] == cr2);
+    }
+
+    SECTION("as_point_set") {
+        using value_type  = typename point_set_type::value_type;
+        using owning_type = std::remove_cv_t<point_set_type>;
+        owning_type corr{value_type{1.1, 2.1, 3.1}, value_type{1.2, 2.2, 3.2},
+                         value_type{1.3, 2.3, 3.3}};
+        REQUIRE(has_values.as_point_set() == corr);
+
+        // Mix in a strided member
+        std::vector<coord_type> xyz{1.3, 2.3, 3.3, 1.2, 2.2, 3.2};
+        auto* p = xyz.data();
+        view_type strided(2, p, p + 1, p + 2, 3 * sizeof(coord_type));
+        pimpl_type mixed(container_type{p01, strided});
+        owning_type corr2{value_type{1.1, 2.1, 3.1}, value_type{1.2, 2.2, 3.2},
+                          value_type{1.3, 2.3, 3.3}, value_type{1.2, 2.2, 3.2}};
+        REQUIRE(mixed.as_point_set() == corr2);
+    }
+
+    SECTION("operator==") {
+        SECTION("Default vs default") { REQUIRE(defaulted == pimpl_type{}); }
+
+        SECTION("Default vs empty") { REQUIRE(defaulted == no_points); }
+
+        SECTION("Default vs. non-empty") {
+            REQUIRE_FALSE(defaulted == has_values);
+        }
+
+        SECTION("Different partition") {
+            view_type p0(1, x.data(), y.data(), z.data());
+            view_type p12(2, x.data() + 1, y.data() + 1, z.data() + 1);
+            pimpl_type other(container_type{p0, p12});
+            REQUIRE(has_values == other);
+        }
+
+        SECTION("Different members") {
+            pimpl_type other(container_type{p2, p01});
+            REQUIRE_FALSE(has_values == other);
+        }
+    }
+
+    SECTION("are_equal") {
+        contiguous_type contiguous(3, x.data(), y.data(), z.data());
+        REQUIRE(has_values.are_equal(contiguous));
+        REQUIRE(contiguous.are_equal(has_values));
+    }
+}
+
+TEMPLATE_TEST_CASE("PointSetUnion<T>", "", float, double) {
+    using point_set_type = chemist::PointSet<TestType>;
+    test_point_set_union_guts<point_set_type>();
+}
+
+TEMPLATE_TEST_CASE("PointSetUnion<const T>", "", float, double) {
+    using point_set_type = chemist::PointSet<TestType>;
+    test_point_set_union_guts<const point_set_type>();
+}
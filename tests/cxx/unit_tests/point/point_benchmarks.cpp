@@ -0,0 +1,94 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include "chemist/point/detail_/point_pimpl.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <chemist/point/point.hpp>
+#include <memory>
+#include <vector>
+
+using namespace chemist;
+
+namespace {
+
+using pimpl_type = detail_::PointPIMPL<double>;
+
+/// Releases a PointPIMPL through the global allocator
+struct GlobalDelete {
+    void operator()(pimpl_type* p) const noexcept { ::delete p; }
+};
+
+/// A PointPIMPL allocated by the global allocator, i.e., the state of a Point
+/// before PointPIMPL objects were pooled
+using heap_point = std::unique_ptr<pimpl_type, GlobalDelete>;
+
+} // namespace
+
+/* Testing Notes:
+ *
+ * These benchmarks are hidden (they only run if explicitly requested, e.g.,
+ * by passing "[benchmark]" to the test executable). The "heap baseline"
+ * benchmarks create the same PointPIMPL objects a Point owns, but bypass the
+ * pool with `::new`, which is what creating a Point cost before PointPIMPL
+ * objects were pooled. They serve as the reference the Point numbers should
+ * be compared against.
+ */
+TEST_CASE("Point throughput", "[.][benchmark]") {
+    constexpr std::size_t n = 1000;
+
+    BENCHMARK("heap baseline: construct and destroy") {
+        std::vector<heap_point> buffer;
+        buffer.reserve(n);
+        for(std::size_t i = 0; i < n; ++i)
+            buffer.emplace_back(::new pimpl_type(double(i), 1.0, 2.0));
+        return buffer.size();
+    };
+
+    BENCHMARK("Point: construct and destroy") {
+        std::vector<Point<double>> buffer;
+        buffer.reserve(n);
+        for(std::size_t i = 0; i < n; ++i)
+            buffer.emplace_back(double(i), 1.0, 2.0);
+        return buffer.size();
+    };
+
+    std::vector<heap_point> heap_points;
+    std::vector<Point<double>> points;
+    for(std::size_t i = 0; i < n; ++i) {
+        heap_points.emplace_back(::new pimpl_type(double(i), 1.0, 2.0));
+        points.emplace_back(double(i), 1.0, 2.0);
+    }
+
+    BENCHMARK("heap baseline: copy") {
+        std::vector<heap_point> copy;
+        copy.reserve(n);
+        for(const auto& p : heap_points)
+            copy.emplace_back(::new pimpl_type(*p));
+        return copy.size();
+    };
+    BENCHMARK("Point: copy") {
+        std::vector<Point<double>> copy(points);
+        return copy.size();
+    };
+
+    BENCHMARK("Point: operator-") {
+        double sum = 0.0;
+        for(std::size_t i = 1; i < n; ++i)
+            sum += (points[i] - points[i - 1]).magnitude();
+        return sum;
+    };
+}
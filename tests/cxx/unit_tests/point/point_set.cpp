@@ -17,7 +17,9 @@
 #include "../catch.hpp"
 #include <cereal/archives/binary.hpp>
 #include <chemist/point/point_set.hpp>
+#include <cstdint>
 #include <sstream>
+#include <type_traits>
 
 using namespace chemist;
 
@@ -52,6 +54,22 @@ TEMPLATE_TEST_CASE("PointSet", "", float, double) {
             REQUIRE(points[2] == p1);
         }
 
+        SECTION("Coordinate arrays") {
+            std::vector<TestType> x{0.0, 3.0, 3.0};
+            std::vector<TestType> y{1.0, 4.0, 4.0};
+            std::vector<TestType> z{2.0, 5.0, 5.0};
+            set_type bulk(x, y, z);
+            REQUIRE(bulk == points);
+
+            std::vector<TestType> empty;
+            REQUIRE(set_type(empty, empty, empty) == defaulted);
+
+            std::vector<TestType> too_short{0.0};
+            using error_t = std::runtime_error;
+            REQUIRE_THROWS_AS(set_type(x, too_short, z), error_t);
+            REQUIRE_THROWS_AS(set_type(x, y, too_short), error_t);
+        }
+
         SECTION("Copy") {
             set_type copy0(defaulted);
             set_type copy1(points);
@@ -147,6 +165,123 @@ TEMPLATE_TEST_CASE("PointSet", "", float, double) {
         REQUIRE(cpoints.z_data() == &cpoints[0].z());
     }
 
+    SECTION("reserve") {
+        defaulted.reserve(10);
+        REQUIRE(defaulted.size() == 0);
+        defaulted.push_back(p0);
+        auto px = defaulted.x_data();
+        for(std::size_t i = 1; i < 10; ++i) defaulted.push_back(p1);
+        REQUIRE(defaulted.x_data() == px);
+    }
+
+    SECTION("permute") {
+        using error_t = std::runtime_error;
+        value_type p2(6.0, 7.0, 8.0);
+        set_type ps{p0, p1, p2};
+        ps.permute({2, 0, 1});
+        REQUIRE(ps == set_type{p2, p0, p1});
+
+        defaulted.permute({});
+        REQUIRE(defaulted == set_type{});
+
+        REQUIRE_THROWS_AS(ps.permute({0, 1}), error_t);
+        REQUIRE_THROWS_AS(ps.permute({0, 1, 1}), error_t);
+        REQUIRE_THROWS_AS(ps.permute({0, 1, 3}), error_t);
+        REQUIRE(ps == set_type{p2, p0, p1});
+    }
+
+    SECTION("reorder") {
+        REQUIRE(defaulted.reorder().empty());
+
+        // Points at opposite ends of the line are put next to each other
+        value_type q0(0.0, 0.0, 0.0), q1(3.0, 0.0, 0.0), q2(1.0, 0.0, 0.0);
+        set_type ps{q0, q1, q2};
+        auto p = ps.reorder(SpaceFillingCurve::morton);
+        REQUIRE(p == typename set_type::permutation_type{0, 2, 1});
+        REQUIRE(ps == set_type{q0, q2, q1});
+
+        auto copy = points;
+        p         = copy.reorder();
+        for(std::size_t i = 0; i < p.size(); ++i)
+            REQUIRE(copy[i] == points[p[i]]);
+    }
+
+    SECTION("Precision conversion") {
+        using other_type = typename set_type::other_precision_type;
+        using other_t    = typename other_type::coord_type;
+        STATIC_REQUIRE_FALSE(std::is_same_v<other_t, TestType>);
+
+        other_type converted(points);
+        REQUIRE(converted.size() == points.size());
+        for(std::size_t i = 0; i < points.size(); ++i) {
+            REQUIRE(converted[i].x() == other_t(points[i].x()));
+            REQUIRE(converted[i].y() == other_t(points[i].y()));
+            REQUIRE(converted[i].z() == other_t(points[i].z()));
+        }
+        REQUIRE(set_type(converted) == points);
+        REQUIRE(other_type(defaulted).size() == 0);
+    }
+
+    SECTION("transform") {
+        using affine_type = typename set_type::affine_type;
+        auto shift        = affine_type::translation({1.0, 2.0, 3.0});
+        value_type q0(1.0, 3.0, 5.0), q1(4.0, 6.0, 8.0);
+        auto moved = points.transformed(shift);
+        REQUIRE(moved == set_type{q0, q1, q1});
+        REQUIRE(points == set_type{p0, p1, p1});
+        points.transform(shift);
+        REQUIRE(points == moved);
+
+        // 90 degree rotation about z, i.e., (x, y, z) -> (-y, x, z)
+        auto rot = affine_type::rotation(
+          {0.0, -1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0});
+        set_type ps{p0, p1};
+        ps.transform(rot);
+        value_type r0(-1.0, 0.0, 2.0), r1(-4.0, 3.0, 5.0);
+        REQUIRE(ps == set_type{r0, r1});
+
+        defaulted.transform(shift);
+        REQUIRE(defaulted.transformed(rot) == set_type{});
+    }
+
+    SECTION("x_column, y_column, z_column") {
+        REQUIRE(defaulted.x_column().empty());
+
+        auto x = points.x_column();
+        REQUIRE(x.size() == points.size());
+        REQUIRE(x.data() == points.x_data());
+        REQUIRE(points.y_column()[1] == p1.y());
+        x[0] = 42.0;
+        REQUIRE(points[0].x() == TestType(42.0));
+
+        const auto& cpoints = points;
+        REQUIRE(cpoints.z_column().size() == 3);
+        REQUIRE(cpoints.z_column()[2] == p1.z());
+    }
+
+    SECTION("padded_size") {
+        REQUIRE(defaulted.padded_size() == 0);
+        REQUIRE(points.padded_size() >= points.size());
+        REQUIRE(points.padded_size() * sizeof(TestType) %
+                  set_type::data_alignment ==
+                0);
+        for(auto i = points.size(); i < points.padded_size(); ++i) {
+            REQUIRE(points.x_data()[i] == 0);
+            REQUIRE(points.y_data()[i] == 0);
+            REQUIRE(points.z_data()[i] == 0);
+        }
+    }
+
+    SECTION("data alignment") {
+        auto is_aligned = [](const TestType* p) {
+            auto addr = reinterpret_cast<std::uintptr_t>(p);
+            return addr % set_type::data_alignment == 0;
+        };
+        REQUIRE(is_aligned(points.x_data()));
+        REQUIRE(is_aligned(points.y_data()));
+        REQUIRE(is_aligned(points.z_data()));
+    }
+
     SECTION("at_()") {
         using rtype = decltype(points[0]);
         STATIC_REQUIRE(std::is_same_v<rtype, typename set_type::reference>);
@@ -0,0 +1,203 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/point/point_set_geometry.hpp>
+#include <cmath>
+#include <random>
+
+using namespace chemist;
+
+namespace {
+
+/// Naive distance used to check the kernels
+template<typename PointType0, typename PointType1>
+auto naive_distance(const PointType0& p0, const PointType1& p1) {
+    return (p0.as_point() - p1.as_point()).magnitude();
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("point_set_geometry", "", float, double) {
+    using point_set_type  = PointSet<TestType>;
+    using point_type      = typename point_set_type::value_type;
+    using view_type       = PointSetView<point_set_type>;
+    using const_view_type = PointSetView<const point_set_type>;
+
+    point_type p0{0.0, 0.0, 0.0};
+    point_type p1{1.0, 0.0, 0.0};
+    point_type p2{0.0, 3.0, 4.0};
+
+    point_set_type empty;
+    point_set_type ps{p0, p1, p2};
+    point_set_type other{p2, p1};
+
+    // Large enough to span several tiles and to trigger threading
+    point_set_type big;
+    for(std::size_t i = 0; i < 600; ++i)
+        big.push_back(point_type(TestType(0.01) * i, TestType(i % 7),
+                                 TestType(0.5) * (i % 13)));
+
+    auto eps = std::is_same_v<TestType, float> ? 1e-5 : 1e-12;
+
+    SECTION("distance_matrix(points)") {
+        REQUIRE(distance_matrix(empty).empty());
+
+        auto rv = distance_matrix(ps);
+        REQUIRE(rv.size() == 9);
+        std::vector<TestType> corr{0.0, 1.0, 5.0, 1.0, 0.0, std::sqrt(26.0),
+                                   5.0, std::sqrt(26.0), 0.0};
+        for(std::size_t i = 0; i < 9; ++i)
+            REQUIRE(rv[i] == Catch::Approx(corr[i]).epsilon(eps));
+    }
+
+    SECTION("distance_matrix(lhs, rhs)") {
+        REQUIRE(distance_matrix(empty, ps).empty());
+        REQUIRE(distance_matrix(ps, empty).empty());
+
+        auto rv = distance_matrix(ps, other);
+        REQUIRE(rv.size() == 6);
+        REQUIRE(rv[0] == Catch::Approx(5.0).epsilon(eps));
+        REQUIRE(rv[1] == Catch::Approx(1.0).epsilon(eps));
+        REQUIRE(rv[2] == Catch::Approx(std::sqrt(26.0)).epsilon(eps));
+        REQUIRE(rv[3] == Catch::Approx(0.0).margin(eps));
+        REQUIRE(rv[4] == Catch::Approx(0.0).margin(eps));
+        REQUIRE(rv[5] == Catch::Approx(std::sqrt(26.0)).epsilon(eps));
+    }
+
+    SECTION("distance_matrix spanning many tiles") {
+        auto rv = distance_matrix(big, ps);
+        REQUIRE(rv.size() == big.size() * ps.size());
+        for(std::size_t i = 0; i < big.size(); ++i)
+            for(std::size_t j = 0; j < ps.size(); ++j) {
+                auto corr = naive_distance(big[i], ps[j]);
+                REQUIRE(rv[i * ps.size() + j] ==
+                        Catch::Approx(corr).epsilon(eps));
+            }
+
+        auto rv2 = distance_matrix(big);
+        REQUIRE(rv2.size() == big.size() * big.size());
+        for(std::size_t i = 0; i < big.size(); i += 37)
+            for(std::size_t j = 0; j < big.size(); j += 41) {
+                auto corr = naive_distance(big[i], big[j]);
+                REQUIRE(rv2[i * big.size() + j] ==
+                        Catch::Approx(corr).epsilon(eps).margin(eps));
+            }
+    }
+
+    SECTION("distances") {
+        REQUIRE(distances(p0, empty).empty());
+
+        auto rv = distances(p1, ps);
+        REQUIRE(rv.size() == 3);
+        REQUIRE(rv[0] == Catch::Approx(1.0).epsilon(eps));
+        REQUIRE(rv[1] == Catch::Approx(0.0).margin(eps));
+        REQUIRE(rv[2] == Catch::Approx(std::sqrt(26.0)).epsilon(eps));
+    }
+
+    SECTION("neighbor_mask(point, points, cutoff)") {
+        REQUIRE(neighbor_mask(p0, empty, TestType(1.0)).empty());
+
+        auto rv = neighbor_mask(p0, ps, TestType(1.0));
+        REQUIRE(rv == neighbor_mask_type{1, 1, 0});
+
+        rv = neighbor_mask(p0, ps, TestType(0.5));
+        REQUIRE(rv == neighbor_mask_type{1, 0, 0});
+    }
+
+    SECTION("neighbor_mask(lhs, rhs, cutoff)") {
+        auto rv = neighbor_mask(ps, other, TestType(1.5));
+        REQUIRE(rv == neighbor_mask_type{0, 1, 0, 1, 1, 0});
+
+        auto big_mask = neighbor_mask(big, big, TestType(2.0));
+        auto big_dist = distance_matrix(big);
+        REQUIRE(big_mask.size() == big_dist.size());
+        for(std::size_t i = 0; i < big_mask.size(); ++i)
+            REQUIRE(bool(big_mask[i]) == (big_dist[i] <= TestType(2.0)));
+    }
+
+    SECTION("PointSetView overloads") {
+        view_type vps(ps);
+        view_type vother(other);
+        const_view_type cvps(ps);
+
+        REQUIRE(distance_matrix(vps) == distance_matrix(ps));
+        REQUIRE(distance_matrix(cvps) == distance_matrix(ps));
+        REQUIRE(distance_matrix(vps, vother) == distance_matrix(ps, other));
+        REQUIRE(distances(p1, vps) == distances(p1, ps));
+        REQUIRE(neighbor_mask(p0, cvps, TestType(1.0)) ==
+                neighbor_mask(p0, ps, TestType(1.0)));
+        REQUIRE(neighbor_mask(vps, vother, TestType(1.5)) ==
+                neighbor_mask(ps, other, TestType(1.5)));
+    }
+}
+
+TEST_CASE("point_set_geometry (mixed precision)") {
+    using point_type = Point<double>;
+    using set_type   = PointSet<double>;
+    using screen     = PointSet<float>;
+
+    // Random points, plus points just inside, on, and just outside a sphere
+    // of radius 5 about the origin, which single precision can not tell apart
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> dist(-20.0, 20.0);
+    set_type points;
+    for(std::size_t i = 0; i < 5000; ++i)
+        points.push_back(point_type(dist(gen), dist(gen), dist(gen)));
+    points.push_back(point_type(3.0, 4.0, 0.0));
+    points.push_back(point_type(5.0 - 1.0E-12, 0.0, 0.0));
+    points.push_back(point_type(5.0 + 1.0E-12, 0.0, 0.0));
+    points.push_back(point_type(0.0, 0.0, -5.0 - 1.0E-9));
+    screen points_f(points);
+
+    point_type origin(0.0, 0.0, 0.0);
+    const double cutoff = 5.0;
+
+    SECTION("neighbor_mask(point, points, screen, cutoff)") {
+        auto rv = neighbor_mask(origin, points, points_f, cutoff);
+        REQUIRE(rv == neighbor_mask(origin, points, cutoff));
+        const auto n = points.size();
+        REQUIRE(rv[n - 4] == 1);
+        REQUIRE(rv[n - 3] == 1);
+        REQUIRE(rv[n - 2] == 0);
+        REQUIRE(rv[n - 1] == 0);
+
+        point_type far(1.0E3, -2.0E3, 5.0E2);
+        REQUIRE(neighbor_mask(far, points, points_f, 100.0) ==
+                neighbor_mask(far, points, 100.0));
+
+        REQUIRE(neighbor_mask(origin, set_type{}, screen{}, cutoff).empty());
+        REQUIRE_THROWS_AS(neighbor_mask(origin, points, screen{}, cutoff),
+                          std::runtime_error);
+    }
+
+    SECTION("neighbor_mask(lhs, lhs_screen, rhs, rhs_screen, cutoff)") {
+        set_type centers{origin, point_type(5.0, 0.0, 0.0),
+                         point_type(-3.0, -4.0, 0.0)};
+        screen centers_f(centers);
+        auto rv = neighbor_mask(centers, centers_f, points, points_f, cutoff);
+        REQUIRE(rv == neighbor_mask(centers, points, cutoff));
+
+        auto self = neighbor_mask(points, points_f, points, points_f, 2.0);
+        REQUIRE(self == neighbor_mask(points, points, 2.0));
+
+        using error_t = std::runtime_error;
+        REQUIRE_THROWS_AS(
+          neighbor_mask(centers, screen{}, points, points_f, cutoff), error_t);
+        REQUIRE_THROWS_AS(
+          neighbor_mask(centers, centers_f, points, screen{}, cutoff), error_t);
+    }
+}
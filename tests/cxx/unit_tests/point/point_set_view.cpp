@@ -32,6 +32,7 @@
 
 #include "../catch.hpp"
 #include <chemist/point/point_set_view.hpp>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -40,6 +41,7 @@ void test_point_set_view_guts() {
     using point_set_type = PointSetType;
     using point_type     = typename point_set_type::value_type;
     using view_type      = chemist::PointSetView<point_set_type>;
+    using coord_type     = typename point_type::coord_type;
 
     point_type p0{1.1, 2.1, 3.1};
     point_type p1{1.2, 2.2, 3.2};
@@ -82,6 +84,42 @@ void test_point_set_view_guts() {
             REQUIRE(v1.size() == 1);
             REQUIRE(v1[0] == one_point_ps[0]);
         }
+        SECTION("strided pointers") {
+            view_type empty(0, nullptr, nullptr, nullptr, 0);
+            REQUIRE(empty.size() == 0);
+
+            std::vector<coord_type> xyz{1.1, 2.1, 3.1, 1.2, 2.2, 3.2};
+            auto* p = xyz.data();
+            view_type v2(2, p, p + 1, p + 2, 3 * sizeof(coord_type));
+            REQUIRE(v2.size() == 2);
+            REQUIRE(v2[0] == p0);
+            REQUIRE(v2[1] == p1);
+            REQUIRE(&v2[1].z() == p + 5);
+        }
+        SECTION("subset") {
+            using member_list_type = typename view_type::member_list_type;
+            view_type empty(three_points, member_list_type{});
+            REQUIRE(empty.size() == 0);
+
+            view_type subset(three_points, member_list_type{2, 0});
+            REQUIRE(subset.size() == 2);
+            REQUIRE(subset[0] == p2);
+            REQUIRE(subset[1] == p0);
+            REQUIRE(&subset[0].x() == &three_points[2].x());
+        }
+        SECTION("union") {
+            using container_type = typename view_type::point_set_view_container;
+            view_type empty(container_type{});
+            REQUIRE(empty.size() == 0);
+
+            view_type both(container_type{two_points, one_point});
+            REQUIRE(both.size() == 3);
+            REQUIRE(both[0] == p0);
+            REQUIRE(both[1] == p1);
+            REQUIRE(both[2] == p0);
+            REQUIRE(&both[2].x() == &one_point[0].x());
+            REQUIRE(both.as_point_set() == point_set_type{p0, p1, p0});
+        }
         SECTION("mutable to read-only") {
             if constexpr(!std::is_const_v<point_set_type>) {
                 using const_type = chemist::PointSetView<const point_set_type>;
@@ -100,6 +138,21 @@ void test_point_set_view_guts() {
                 REQUIRE(const_two_points.size() == 2);
                 REQUIRE(const_two_points[0] == two_points[0]);
                 REQUIRE(const_two_points[1] == two_points[1]);
+
+                // Must still alias the original memory for other layouts
+                std::vector<coord_type> xyz{1.1, 2.1, 3.1, 1.2, 2.2, 3.2};
+                auto* p = xyz.data();
+                view_type strided(2, p, p + 1, p + 2, 3 * sizeof(coord_type));
+                const_type const_strided(strided);
+                REQUIRE(const_strided == const_type(two_points));
+                REQUIRE(&const_strided[1].y() == p + 4);
+
+                using member_list_type = typename view_type::member_list_type;
+                view_type subset(three_points, member_list_type{2, 0});
+                const_type const_subset(subset);
+                REQUIRE(const_subset.size() == 2);
+                REQUIRE(const_subset[0] == subset[0]);
+                REQUIRE(&const_subset[1].x() == &three_points[0].x());
             }
         }
 
@@ -272,6 +325,15 @@ void test_point_set_view_guts() {
             view_type other_two(other_two_ps);
             REQUIRE_FALSE(two_points == other_two);
         }
+
+        SECTION("Same points, strided storage") {
+            std::vector<coord_type> xyz{1.1, 2.1, 3.1, 1.2, 2.2, 3.2};
+            auto* p = xyz.data();
+            view_type strided(2, p, p + 1, p + 2, 3 * sizeof(coord_type));
+            REQUIRE(two_points == strided);
+            REQUIRE(strided == two_points);
+            REQUIRE_FALSE(strided == three_points);
+        }
     }
 
     SECTION("operator!=") {
@@ -287,6 +349,60 @@ void test_point_set_view_guts() {
         REQUIRE(one_point.as_point_set() == one_point_ps);
         REQUIRE(two_points.as_point_set() == two_points_ps);
         REQUIRE(three_points.as_point_set() == three_points_ps);
+
+        using member_list_type = typename view_type::member_list_type;
+        view_type subset(three_points, member_list_type{2, 0});
+        REQUIRE(subset.as_point_set() == point_set_type{p2, p0});
+
+        std::vector<coord_type> xyz{1.1, 2.1, 3.1, 1.2, 2.2, 3.2};
+        auto* p = xyz.data();
+        view_type strided(2, p, p + 1, p + 2, 3 * sizeof(coord_type));
+        REQUIRE(strided.as_point_set() == two_points_ps);
+    }
+
+    SECTION("transformed") {
+        using affine_type = typename view_type::affine_type;
+        auto shift        = affine_type::translation({1.0, 1.0, 1.0});
+        REQUIRE(defaulted.transformed(shift) == defaulted_ps);
+        auto moved = two_points.transformed(shift);
+        REQUIRE(moved == two_points_ps.transformed(shift));
+        REQUIRE(two_points.as_point_set() == two_points_ps);
+    }
+
+    SECTION("is_contiguous") {
+        using member_list_type = typename view_type::member_list_type;
+        REQUIRE(defaulted.is_contiguous());
+        REQUIRE(three_points.is_contiguous());
+
+        std::vector<coord_type> xyz{1.1, 2.1, 3.1, 1.2, 2.2, 3.2};
+        auto* p = xyz.data();
+        REQUIRE_FALSE(view_type(2, p, p + 1, p + 2, 3 * sizeof(coord_type))
+                        .is_contiguous());
+        REQUIRE(view_type(2, p, p + 2, p + 4, sizeof(coord_type))
+                  .is_contiguous());
+
+        view_type subset(three_points, member_list_type{2, 0});
+        REQUIRE_FALSE(subset.is_contiguous());
+        REQUIRE(view_type(three_points, member_list_type{}).is_contiguous());
+    }
+
+    SECTION("x_column, y_column, z_column") {
+        REQUIRE(defaulted.x_column().empty());
+
+        auto x = three_points.x_column();
+        auto y = three_points.y_column();
+        auto z = three_points.z_column();
+        REQUIRE(x.size() == 3);
+        REQUIRE(x.data() == three_points_ps.x_data());
+        REQUIRE(y.data() == three_points_ps.y_data());
+        REQUIRE(z.data() == three_points_ps.z_data());
+        REQUIRE(std::as_const(three_points).z_column()[2] == p2.z());
+
+        using member_list_type = typename view_type::member_list_type;
+        view_type subset(three_points, member_list_type{2, 0});
+        REQUIRE_THROWS_AS(subset.x_column(), std::runtime_error);
+        REQUIRE_THROWS_AS(std::as_const(subset).y_column(),
+                          std::runtime_error);
     }
 }
 
@@ -308,6 +424,33 @@ TEMPLATE_TEST_CASE("PointSetView<T>", "", float, double) {
         REQUIRE(one_point[0].x() == point_type{42.0});
         REQUIRE(one_point_ps[0].x() == point_type{42.0});
     }
+
+    SECTION("transform") {
+        using view_type   = chemist::PointSetView<point_set_type>;
+        using affine_type = typename view_type::affine_type;
+        auto shift        = affine_type::translation({1.0, 2.0, 3.0});
+
+        view_type defaulted;
+        defaulted.transform(shift);
+        REQUIRE(defaulted.empty());
+
+        // Enough points to span several tiles
+        point_set_type ps;
+        for(std::size_t i = 0; i < 600; ++i)
+            ps.push_back({point_type(i), point_type(2 * i), point_type(0)});
+        auto corr = ps.transformed(shift);
+        view_type(ps).transform(shift);
+        REQUIRE(ps == corr);
+
+        // Strided storage, only the coordinates are touched
+        std::vector<point_type> xyzw{1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0};
+        auto* p = xyzw.data();
+        view_type strided(2, p, p + 1, p + 2, 4 * sizeof(point_type));
+        strided.transform(shift);
+        std::vector<point_type> corr_xyzw{2.0, 4.0, 6.0, 4.0,
+                                          6.0, 8.0, 10.0, 8.0};
+        REQUIRE(xyzw == corr_xyzw);
+    }
 }
 
 TEMPLATE_TEST_CASE("PointSetView<const T>", "", float, double) {
@@ -0,0 +1,161 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <algorithm>
+#include <chemist/point/space_filling_curve.hpp>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+using namespace chemist;
+
+/* Testing Notes:
+ *
+ * For a 2^k by 2^k by 2^k lattice of points the lattice coordinates of the
+ * points are 0, 1, ..., 2^k - 1 in the k most significant bits of each
+ * lattice coordinate. Hence the points are visited in exactly the order of
+ * the level-k curve. In particular, consecutive points along a Hilbert curve
+ * are always nearest neighbors.
+ */
+
+namespace {
+
+template<typename T>
+PointSet<T> make_lattice(std::size_t n) {
+    PointSet<T> rv;
+    for(std::size_t i = 0; i < n; ++i)
+        for(std::size_t j = 0; j < n; ++j)
+            for(std::size_t k = 0; k < n; ++k) rv.push_back({T(i), T(j), T(k)});
+    return rv;
+}
+
+bool is_permutation(std::vector<std::size_t> p) {
+    std::vector<std::size_t> corr(p.size());
+    std::iota(corr.begin(), corr.end(), 0);
+    std::sort(p.begin(), p.end());
+    return p == corr;
+}
+
+template<typename PointSetType>
+auto path_length(const PointSetType& points, std::vector<std::size_t> p) {
+    double rv = 0.0;
+    for(std::size_t i = 1; i < p.size(); ++i) {
+        const auto& a = points[p[i - 1]];
+        const auto& b = points[p[i]];
+        const double dx = a.x() - b.x();
+        const double dy = a.y() - b.y();
+        const double dz = a.z() - b.z();
+        rv += std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+    return rv;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("space_filling_curve_order", "", float, double) {
+    using set_type   = PointSet<TestType>;
+    using view_type  = PointSetView<const set_type>;
+    using order_type = std::vector<std::size_t>;
+
+    set_type defaulted;
+    auto cube    = make_lattice<TestType>(2);
+    auto lattice = make_lattice<TestType>(4);
+
+    SECTION("Empty") {
+        REQUIRE(space_filling_curve_order(defaulted).empty());
+        REQUIRE(space_filling_curve_order(view_type{}).empty());
+    }
+
+    SECTION("Single point") {
+        set_type one{{1.0, 2.0, 3.0}};
+        REQUIRE(space_filling_curve_order(one) == order_type{0});
+    }
+
+    SECTION("Morton") {
+        // make_lattice already generates the points in Z-order
+        const auto morton = SpaceFillingCurve::morton;
+        order_type corr(cube.size());
+        std::iota(corr.begin(), corr.end(), 0);
+        REQUIRE(space_filling_curve_order(cube, morton) == corr);
+
+        // Reversing the points reverses the order
+        set_type reversed;
+        for(std::size_t i = cube.size(); i > 0; --i)
+            reversed.push_back(cube[i - 1].as_point());
+        order_type corr_rev(corr.rbegin(), corr.rend());
+        REQUIRE(space_filling_curve_order(reversed, morton) == corr_rev);
+    }
+
+    SECTION("Hilbert") {
+        auto p = space_filling_curve_order(lattice);
+        REQUIRE(is_permutation(p));
+        REQUIRE(p[0] == 0); // Curve starts at the origin
+
+        // Each step of the curve moves to a nearest neighbor
+        REQUIRE(path_length(lattice, p) == Approx(lattice.size() - 1));
+    }
+
+    SECTION("Hilbert has better locality than Morton") {
+        auto morton  = SpaceFillingCurve::morton;
+        auto hilbert = space_filling_curve_order(lattice);
+        auto z_order = space_filling_curve_order(lattice, morton);
+        REQUIRE(path_length(lattice, hilbert) < path_length(lattice, z_order));
+    }
+
+    SECTION("Degenerate dimensions") {
+        // All points in the xy-plane, and a duplicate point
+        set_type plane{{1.0, 1.0, 5.0}, {0.0, 0.0, 5.0}, {1.0, 1.0, 5.0}};
+        auto p = space_filling_curve_order(plane);
+        REQUIRE(p == order_type{1, 0, 2});
+    }
+
+    SECTION("Views") {
+        view_type v(lattice);
+        const auto morton = SpaceFillingCurve::morton;
+        REQUIRE(space_filling_curve_order(v) ==
+                space_filling_curve_order(lattice));
+        REQUIRE(space_filling_curve_order(v, morton) ==
+                space_filling_curve_order(lattice, morton));
+    }
+
+    SECTION("Mapping back to the original order") {
+        auto reordered = lattice;
+        auto p         = reordered.reorder();
+        REQUIRE(reordered != lattice);
+
+        PointSetView<set_type> original(PointSetView<set_type>(reordered),
+                                        inverse_permutation(p));
+        REQUIRE(original == PointSetView<set_type>(lattice));
+    }
+}
+
+TEST_CASE("inverse_permutation") {
+    using order_type = std::vector<std::size_t>;
+    using error_t    = std::runtime_error;
+
+    REQUIRE(inverse_permutation({}).empty());
+    REQUIRE(inverse_permutation({0, 1, 2}) == order_type{0, 1, 2});
+    REQUIRE(inverse_permutation({2, 0, 1}) == order_type{1, 2, 0});
+
+    order_type p{3, 1, 4, 0, 2};
+    auto q = inverse_permutation(p);
+    for(std::size_t i = 0; i < p.size(); ++i) REQUIRE(q[p[i]] == i);
+    REQUIRE(inverse_permutation(q) == p);
+
+    REQUIRE_THROWS_AS(inverse_permutation({0, 0}), error_t);
+    REQUIRE_THROWS_AS(inverse_permutation({1, 2}), error_t);
+}
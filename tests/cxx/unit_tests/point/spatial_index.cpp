@@ -0,0 +1,256 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <algorithm>
+#include <chemist/grid/grid_class.hpp>
+#include <chemist/point/spatial_index.hpp>
+#include <random>
+#include <stdexcept>
+
+using namespace chemist;
+
+/* Testing Notes:
+ *
+ * The results of the queries are checked against brute-force searches over
+ * a cloud of random points. The cloud is large enough that the tree has
+ * several levels.
+ */
+
+namespace {
+
+template<typename T>
+PointSet<T> random_points(std::size_t n, unsigned int seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<T> dist(-10.0, 10.0);
+    PointSet<T> rv;
+    for(std::size_t i = 0; i < n; ++i)
+        rv.push_back(Point<T>(dist(gen), dist(gen), dist(gen)));
+    return rv;
+}
+
+template<typename T>
+T distance2(const Point<T>& a, const Point<T>& b) {
+    const T dx = a.x() - b.x();
+    const T dy = a.y() - b.y();
+    const T dz = a.z() - b.z();
+    return dx * dx + dy * dy + dz * dz;
+}
+
+template<typename T>
+std::vector<std::size_t> brute_radius(const PointSet<T>& points,
+                                      const Point<T>& r, T radius) {
+    std::vector<std::size_t> rv;
+    for(std::size_t i = 0; i < points.size(); ++i)
+        if(distance2(points[i].as_point(), r) <= radius * radius)
+            rv.push_back(i);
+    return rv;
+}
+
+template<typename T>
+std::vector<std::size_t> brute_knn(const PointSet<T>& points,
+                                   const Point<T>& r, std::size_t k) {
+    std::vector<std::pair<T, std::size_t>> d;
+    for(std::size_t i = 0; i < points.size(); ++i)
+        d.emplace_back(distance2(points[i].as_point(), r), i);
+    std::sort(d.begin(), d.end());
+    std::vector<std::size_t> rv;
+    for(std::size_t i = 0; i < std::min(k, d.size()); ++i)
+        rv.push_back(d[i].second);
+    return rv;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("SpatialIndex", "", float, double) {
+    using index_type      = SpatialIndex<TestType>;
+    using point_type      = Point<TestType>;
+    using set_type        = PointSet<TestType>;
+    using index_list_type = typename index_type::index_list_type;
+
+    const TestType radius = 3.0;
+    auto points           = random_points<TestType>(500, 42);
+    auto queries          = random_points<TestType>(50, 7);
+    point_type origin(0.0, 0.0, 0.0);
+
+    index_type defaulted;
+    index_type index(points);
+
+    SECTION("Ctors") {
+        SECTION("Default") { REQUIRE(defaulted.size() == 0); }
+        SECTION("PointSet") {
+            REQUIRE(index.size() == points.size());
+            REQUIRE(index_type(set_type{}).empty());
+        }
+        SECTION("PointSetView") {
+            PointSetView<const set_type> view(points);
+            index_type from_view(view);
+            REQUIRE(from_view.size() == points.size());
+            REQUIRE(from_view.radius_query(origin, radius) ==
+                    index.radius_query(origin, radius));
+        }
+        SECTION("Copy") {
+            index_type copy(index);
+            REQUIRE(copy.nearest_neighbors(origin, 5) ==
+                    index.nearest_neighbors(origin, 5));
+        }
+        SECTION("Move") {
+            auto corr = index.nearest_neighbors(origin, 5);
+            index_type moved(std::move(index));
+            REQUIRE(moved.nearest_neighbors(origin, 5) == corr);
+        }
+        SECTION("Copy assignment") {
+            defaulted = index;
+            REQUIRE(defaulted.size() == index.size());
+        }
+        SECTION("Move assignment") {
+            defaulted = std::move(index);
+            REQUIRE(defaulted.size() == points.size());
+        }
+    }
+
+    SECTION("radius_query") {
+        REQUIRE(defaulted.radius_query(origin, radius).empty());
+        REQUIRE(index.radius_query(origin, -1.0).empty());
+        for(const auto& q : queries) {
+            const auto r = q.as_point();
+            REQUIRE(index.radius_query(r, radius) ==
+                    brute_radius(points, r, radius));
+        }
+
+        // Points exactly on the sphere are included
+        set_type line{{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {2.0, 0.0, 0.0}};
+        REQUIRE(index_type(line).radius_query(origin, 1.0) ==
+                index_list_type{0, 1});
+    }
+
+    SECTION("nearest_neighbors") {
+        REQUIRE(defaulted.nearest_neighbors(origin, 3).empty());
+        REQUIRE(index.nearest_neighbors(origin, 0).empty());
+        for(const auto& q : queries) {
+            const auto r = q.as_point();
+            REQUIRE(index.nearest_neighbors(r, 1) == brute_knn(points, r, 1));
+            REQUIRE(index.nearest_neighbors(r, 10) == brute_knn(points, r, 10));
+        }
+
+        // Asking for more points than there are returns all of them
+        REQUIRE(index.nearest_neighbors(origin, 1000).size() == points.size());
+
+        // Ties are broken by index
+        set_type tied{{1.0, 0.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, 2.0, 0.0}};
+        REQUIRE(index_type(tied).nearest_neighbors(origin, 2) ==
+                index_list_type{0, 1});
+    }
+
+    SECTION("Batched queries") {
+        auto by_radius = index.radius_query(queries, radius);
+        auto by_k      = index.nearest_neighbors(queries, 4);
+        REQUIRE(by_radius.size() == queries.size());
+        REQUIRE(by_k.size() == queries.size());
+        for(std::size_t i = 0; i < queries.size(); ++i) {
+            const auto r = queries[i].as_point();
+            REQUIRE(by_radius[i] == index.radius_query(r, radius));
+            REQUIRE(by_k[i] == index.nearest_neighbors(r, 4));
+        }
+
+        auto empty = defaulted.radius_query(queries, radius);
+        REQUIRE(empty.size() == queries.size());
+        REQUIRE(empty[0].empty());
+    }
+
+    SECTION("neighbor_pairs") {
+        REQUIRE(defaulted.neighbor_pairs(radius).empty());
+
+        typename index_type::pair_list_type corr;
+        for(std::size_t i = 0; i < points.size(); ++i)
+            for(std::size_t j = i + 1; j < points.size(); ++j)
+                if(distance2(points[i].as_point(), points[j].as_point()) <=
+                   radius * radius)
+                    corr.emplace_back(i, j);
+        REQUIRE(index.neighbor_pairs(radius) == corr);
+    }
+
+    SECTION("update") {
+        // Move a few points far away
+        auto moved = points;
+        index_list_type changed{3, 250, 499};
+        for(auto i : changed) moved[i].x() += 25.0;
+        index.update(moved, changed);
+        REQUIRE(index.size() == moved.size());
+        for(const auto& q : queries) {
+            const auto r = q.as_point();
+            REQUIRE(index.radius_query(r, radius) ==
+                    brute_radius(moved, r, radius));
+            REQUIRE(index.nearest_neighbors(r, 3) == brute_knn(moved, r, 3));
+        }
+        point_type far(35.0, 0.0, 0.0);
+        REQUIRE(index.nearest_neighbors(far, 3) == brute_knn(moved, far, 3));
+
+        // One point at a time: out past the root's box, then back inside it
+        // (which shrinks the boxes along its path again)
+        for(auto i : index_list_type{0, 137, 499}) {
+            auto out = moved;
+            out[i].x() -= 100.0;
+            out[i].y() += 100.0;
+            index.update(out, {i});
+            const auto r = out[i].as_point();
+            REQUIRE(index.radius_query(r, radius) ==
+                    brute_radius(out, r, radius));
+            REQUIRE(index.nearest_neighbors(r, 3) == brute_knn(out, r, 3));
+
+            index.update(moved, {i});
+            REQUIRE(index.radius_query(r, radius).empty());
+            REQUIRE(index.nearest_neighbors(r, 3) == brute_knn(moved, r, 3));
+            for(const auto& q : queries) {
+                const auto rq = q.as_point();
+                REQUIRE(index.radius_query(rq, radius) ==
+                        brute_radius(moved, rq, radius));
+            }
+        }
+
+        // Results are unchanged by a rebuild
+        auto before = index.neighbor_pairs(radius);
+        index.rebuild();
+        REQUIRE(index.neighbor_pairs(radius) == before);
+
+        // Moving most of the points triggers a rebuild
+        auto shifted = random_points<TestType>(points.size(), 3);
+        index_list_type all(points.size());
+        for(std::size_t i = 0; i < all.size(); ++i) all[i] = i;
+        index.update(PointSetView<const set_type>(shifted), all);
+        REQUIRE(index.radius_query(origin, radius) ==
+                brute_radius(shifted, origin, radius));
+
+        // Errors
+        using error_t = std::runtime_error;
+        REQUIRE_THROWS_AS(index.update(queries, {0}), error_t);
+        REQUIRE_THROWS_AS(index.update(shifted, {points.size()}),
+                          std::out_of_range);
+        REQUIRE_THROWS_AS(defaulted.update(points, {0}), error_t);
+        defaulted.update(set_type{}, {});
+        REQUIRE(defaulted.empty());
+    }
+
+    SECTION("Indexing other containers") {
+        std::vector<GridPoint> gps{GridPoint(1.0, 0.0, 0.0, 0.0),
+                                   GridPoint(1.0, 5.0, 0.0, 0.0),
+                                   GridPoint(1.0, 0.5, 0.0, 0.0)};
+        Grid grid(gps.begin(), gps.end());
+        SpatialIndex<double> grid_index(grid.point_set());
+        REQUIRE(grid_index.radius_query(Point<double>(0.0, 0.0, 0.0), 1.0) ==
+                index_list_type{0, 2});
+    }
+}
@@ -17,6 +17,7 @@
 #include "../catch.hpp"
 #include <cereal/archives/binary.hpp>
 #include <chemist/point_charge/charges.hpp>
+#include <cstdint>
 #include <sstream>
 
 using namespace chemist;
@@ -49,6 +50,26 @@ TEMPLATE_TEST_CASE("Charges", "", float, double) {
             REQUIRE(charges[2] == q1);
         }
 
+        SECTION("PointSet and charges") {
+            std::vector<TestType> qs{0.0, 4.0, 4.0};
+            auto ps = charges.point_set().as_point_set();
+            set_type bulk(ps, qs);
+            REQUIRE(bulk == charges);
+
+            std::vector<TestType> too_short{0.0};
+            using error_t = std::runtime_error;
+            REQUIRE_THROWS_AS(set_type(ps, too_short), error_t);
+        }
+
+        SECTION("Coordinate and charge arrays") {
+            std::vector<TestType> x{1.0, 5.0, 5.0};
+            std::vector<TestType> y{2.0, 6.0, 6.0};
+            std::vector<TestType> z{3.0, 7.0, 7.0};
+            std::vector<TestType> qs{0.0, 4.0, 4.0};
+            set_type bulk(x, y, z, qs);
+            REQUIRE(bulk == charges);
+        }
+
         SECTION("Copy") {
             set_type copy0(defaulted);
             set_type copy1(charges);
@@ -111,6 +132,69 @@ TEMPLATE_TEST_CASE("Charges", "", float, double) {
         REQUIRE(defaulted == charges);
     }
 
+    SECTION("reserve") {
+        defaulted.reserve(10);
+        REQUIRE(defaulted.size() == 0);
+        defaulted.push_back(q0);
+        auto pq = defaulted.charge_data();
+        for(std::size_t i = 1; i < 10; ++i) defaulted.push_back(q1);
+        REQUIRE(defaulted.charge_data() == pq);
+    }
+
+    SECTION("permute") {
+        charges.permute({1, 0, 2});
+        REQUIRE(charges == set_type{q1, q0, q1});
+        REQUIRE(charges.charge_data()[1] == q0.charge());
+
+        defaulted.permute({});
+        REQUIRE(defaulted == set_type{});
+
+        using error_t = std::runtime_error;
+        REQUIRE_THROWS_AS(charges.permute({0, 0, 1}), error_t);
+    }
+
+    SECTION("reorder") {
+        REQUIRE(defaulted.reorder().empty());
+
+        value_type q2(1.0, 1.0, 2.0, 3.0);
+        set_type qs{q0, q1, q2};
+        auto p = qs.reorder(SpaceFillingCurve::morton);
+        REQUIRE(p == typename set_type::permutation_type{0, 2, 1});
+        REQUIRE(qs == set_type{q0, q2, q1});
+    }
+
+    SECTION("transform") {
+        using affine_type = typename set_type::affine_type;
+        auto shift        = affine_type::translation({1.0, 1.0, 1.0});
+        value_type r0(0.0, 2.0, 3.0, 4.0), r1(4.0, 6.0, 7.0, 8.0);
+        auto moved = charges.transformed(shift);
+        REQUIRE(moved == set_type{r0, r1, r1});
+        REQUIRE(charges == set_type{q0, q1, q1});
+        charges.transform(shift);
+        REQUIRE(charges == moved);
+
+        defaulted.transform(shift);
+        REQUIRE(defaulted.transformed(shift) == set_type{});
+    }
+
+    SECTION("charge_data") {
+        REQUIRE(defaulted.charge_data() == nullptr);
+        REQUIRE(std::as_const(defaulted).charge_data() == nullptr);
+        REQUIRE(charges.charge_data() == &charges[0].charge());
+        auto addr = reinterpret_cast<std::uintptr_t>(charges.charge_data());
+        REQUIRE(addr % set_type::data_alignment == 0);
+    }
+
+    SECTION("charge_column") {
+        REQUIRE(defaulted.charge_column().empty());
+        auto qs = charges.charge_column();
+        REQUIRE(qs.size() == 3);
+        REQUIRE(qs.data() == charges.charge_data());
+        qs[2] = 1.0;
+        REQUIRE(charges[2].charge() == TestType(1.0));
+        REQUIRE(std::as_const(charges).charge_column()[0] == q0.charge());
+    }
+
     SECTION("at_()") {
         using rtype = decltype(charges[0]);
         STATIC_REQUIRE(std::is_same_v<rtype, typename set_type::reference>);
@@ -17,6 +17,7 @@
 #include "../catch.hpp"
 #include <chemist/point_charge/charges_view.hpp>
 #include <sstream>
+#include <stdexcept>
 #include <utility>
 
 template<typename ChargesType>
@@ -63,6 +64,49 @@ void test_charges_view_guts() {
             REQUIRE(ps_and_qs[2] == q2);
         }
 
+        SECTION("strided points and charges") {
+            using charge_type = typename point_charge_type::charge_type;
+            std::vector<charge_type> xyzq{0.0, 0.0, 0.0, 0.0, 1.0, 2.0,
+                                          3.0, -1.1, 4.0, 5.0, 6.0, -2.2};
+            auto* p             = xyzq.data();
+            const std::size_t s = 4 * sizeof(charge_type);
+            point_set_reference points(3, p, p + 1, p + 2, s);
+            view_type aos(points, p + 3, s);
+            REQUIRE(aos.size() == 3);
+            REQUIRE(aos[0] == q0);
+            REQUIRE(aos[1] == q1);
+            REQUIRE(aos[2] == q2);
+            REQUIRE(aos == charges);
+            REQUIRE(&aos[1].charge() == p + 7);
+        }
+
+        SECTION("Subset") {
+            using member_list_type = typename view_type::member_list_type;
+            view_type empty(charges, member_list_type{});
+            REQUIRE(empty.size() == 0);
+
+            view_type subset(charges, member_list_type{2, 0});
+            REQUIRE(subset.size() == 2);
+            REQUIRE(subset[0] == q2);
+            REQUIRE(subset[1] == q0);
+            REQUIRE(&subset[0].charge() == charges_qs.charge_data() + 2);
+            REQUIRE(subset.point_set()[1] == charges.point_set()[0]);
+        }
+
+        SECTION("Union") {
+            using container_type = typename view_type::charges_view_container;
+            view_type empty(container_type{});
+            REQUIRE(empty.size() == 0);
+
+            view_type both(container_type{charges, view_type(charges, {1})});
+            REQUIRE(both.size() == 4);
+            REQUIRE(both[0] == q0);
+            REQUIRE(both[2] == q2);
+            REQUIRE(both[3] == q1);
+            REQUIRE(&both[3].charge() == charges_qs.charge_data() + 1);
+            REQUIRE(both.point_set().size() == 4);
+        }
+
         SECTION("Copy") {
             view_type defaulted_copy(defaulted);
             REQUIRE(defaulted == defaulted_copy);
@@ -174,6 +218,62 @@ void test_charges_view_guts() {
                 const_point_set_reference{corr});
     }
 
+    SECTION("is_contiguous") {
+        REQUIRE(defaulted.is_contiguous());
+        REQUIRE(charges.is_contiguous());
+
+        using charge_type = typename point_charge_type::charge_type;
+        std::vector<charge_type> xyzq{0.0, 0.0, 0.0, 0.0, 1.0, 2.0,
+                                      3.0, -1.1, 4.0, 5.0, 6.0, -2.2};
+        auto* p             = xyzq.data();
+        const std::size_t s = 4 * sizeof(charge_type);
+        point_set_reference points(3, p, p + 1, p + 2, s);
+        view_type aos(points, p + 3, s);
+        REQUIRE_FALSE(aos.is_contiguous());
+
+        // Contiguous charges, strided points
+        view_type mixed(points, charges_qs.charge_data());
+        REQUIRE_FALSE(mixed.is_contiguous());
+    }
+
+    SECTION("as_charges") {
+        REQUIRE(defaulted.as_charges() == defaulted_qs);
+        REQUIRE(no_charges.as_charges() == defaulted_qs);
+        REQUIRE(charges.as_charges() == charges_qs);
+
+        using charge_type = typename point_charge_type::charge_type;
+        std::vector<charge_type> xyzq{0.0, 0.0, 0.0, 0.0, 1.0, 2.0,
+                                      3.0, -1.1, 4.0, 5.0, 6.0, -2.2};
+        auto* p             = xyzq.data();
+        const std::size_t s = 4 * sizeof(charge_type);
+        point_set_reference points(3, p, p + 1, p + 2, s);
+        view_type aos(points, p + 3, s);
+        REQUIRE(aos.as_charges() == charges_qs);
+
+        // Contiguous charges, strided points
+        view_type mixed(points, charges_qs.charge_data());
+        REQUIRE(mixed.as_charges() == charges_qs);
+    }
+
+    SECTION("charge_column") {
+        REQUIRE(defaulted.charge_column().empty());
+
+        auto qs = charges.charge_column();
+        REQUIRE(qs.size() == 3);
+        REQUIRE(qs.data() == charges_qs.charge_data());
+        REQUIRE(std::as_const(charges).charge_column()[1] == q1.charge());
+        REQUIRE(charges.point_set().x_column()[2] == q2.x());
+
+        using charge_type = typename point_charge_type::charge_type;
+        std::vector<charge_type> xyzq{0.0, 0.0, 0.0, 0.0, 1.0, 2.0,
+                                      3.0, -1.1, 4.0, 5.0, 6.0, -2.2};
+        auto* p             = xyzq.data();
+        const std::size_t s = 4 * sizeof(charge_type);
+        point_set_reference points(3, p, p + 1, p + 2, s);
+        view_type aos(points, p + 3, s);
+        REQUIRE_THROWS_AS(aos.charge_column(), std::runtime_error);
+    }
+
     SECTION("size_()") {
         REQUIRE(defaulted.size() == 0);
         REQUIRE(no_charges.size() == 0);
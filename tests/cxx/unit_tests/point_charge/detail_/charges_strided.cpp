@@ -0,0 +1,140 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../catch.hpp"
+#include <chemist/point_charge/detail_/charges_contiguous.hpp>
+#include <chemist/point_charge/detail_/charges_strided.hpp>
+#include <utility>
+
+template<typename ChargesType>
+void test_case_guts() {
+    using charges_type = ChargesType;
+    using pimpl_type   = chemist::detail_::ChargesStrided<charges_type>;
+    using charge_type  = typename pimpl_type::point_charge_traits::charge_type;
+    using point_set_reference = typename pimpl_type::point_set_reference;
+    using point_set_type = typename pimpl_type::point_set_traits::value_type;
+    using point_type     = typename point_set_type::value_type;
+    using reference      = typename pimpl_type::reference;
+    using contiguous_type = chemist::detail_::ChargesContiguous<charges_type>;
+
+    point_type p0{0.0, 0.0, 0.0}, p1{1.0, 2.0, 3.0}, p2{4.0, 5.0, 6.0};
+    point_set_type no_points;
+    point_set_type points{p0, p1, p2};
+
+    // The same point charges stored as x, y, z, q records
+    std::vector<charge_type> xyzq{0.0, 0.0, 0.0, -1.1, 1.0, 2.0,
+                                  3.0, 2.2, 4.0, 5.0, 6.0, -3.3};
+    auto* p             = xyzq.data();
+    const std::size_t s = 4 * sizeof(charge_type);
+    point_set_reference aos_points(3, p, p + 1, p + 2, s);
+
+    reference q0(xyzq[3], p0);
+    reference q1(xyzq[7], p1);
+    reference q2(xyzq[11], p2);
+
+    pimpl_type defaulted;
+    pimpl_type no_charges(point_set_reference(no_points), nullptr, 0);
+    pimpl_type charges(aos_points, p + 3, s);
+
+    SECTION("Ctors") {
+        SECTION("Default") { REQUIRE(defaulted.size() == 0); }
+
+        SECTION("Value") {
+            REQUIRE(no_charges.size() == 0);
+            REQUIRE(charges.size() == 3);
+            REQUIRE(charges[0] == q0);
+            REQUIRE(charges[1] == q1);
+            REQUIRE(charges[2] == q2);
+            REQUIRE(&charges[2].charge() == p + 11);
+            REQUIRE(&charges[2].x() == p + 8);
+        }
+
+        SECTION("Copy") {
+            pimpl_type defaulted_copy(defaulted);
+            REQUIRE(defaulted == defaulted_copy);
+
+            pimpl_type charges_copy(charges);
+            REQUIRE(charges_copy == charges);
+        }
+    }
+
+    SECTION("clone") {
+        auto charges_copy = charges.clone();
+        REQUIRE(charges_copy->are_equal(charges));
+    }
+
+    SECTION("point_set()") {
+        REQUIRE(defaulted.point_set() == point_set_reference{});
+        REQUIRE(charges.point_set() == point_set_reference{points});
+    }
+
+    SECTION("at_() const") {
+        REQUIRE(std::as_const(charges)[0] == q0);
+        REQUIRE(std::as_const(charges)[1] == q1);
+        REQUIRE(std::as_const(charges)[2] == q2);
+    }
+
+    SECTION("size_()") {
+        REQUIRE(defaulted.size() == 0);
+        REQUIRE(no_charges.size() == 0);
+        REQUIRE(charges.size() == 3);
+    }
+
+    SECTION("operator==") {
+        SECTION("Default vs default") { REQUIRE(defaulted == pimpl_type{}); }
+        SECTION("Default vs. empty") { REQUIRE(defaulted == no_charges); }
+        SECTION("Default vs. non-empty") {
+            REQUIRE_FALSE(defaulted == charges);
+        }
+        SECTION("Same non-empty state") {
+            pimpl_type charges2(aos_points, p + 3, s);
+            REQUIRE(charges == charges2);
+        }
+        SECTION("Same values, contiguous charges") {
+            std::vector<charge_type> qs{-1.1, 2.2, -3.3};
+            pimpl_type charges2(point_set_reference(points), qs.data(),
+                                sizeof(charge_type));
+            REQUIRE(charges == charges2);
+        }
+        SECTION("Same address, different stride") {
+            pimpl_type charges2(aos_points, p + 3, sizeof(charge_type));
+            REQUIRE_FALSE(charges == charges2);
+        }
+        SECTION("Different charges") {
+            std::vector<charge_type> qs2{-9.9, -8.8, -7.7};
+            pimpl_type charges2(point_set_reference(points), qs2.data(),
+                                sizeof(charge_type));
+            REQUIRE_FALSE(charges == charges2);
+        }
+    }
+
+    SECTION("are_equal") {
+        std::vector<charge_type> qs{-1.1, 2.2, -3.3};
+        contiguous_type contiguous(point_set_reference(points), qs.data());
+        REQUIRE(charges.are_equal(contiguous));
+        REQUIRE(contiguous.are_equal(charges));
+    }
+}
+
+TEMPLATE_TEST_CASE("ChargesStrided<T>", "", float, double) {
+    using charges_type = chemist::Charges<TestType>;
+    test_case_guts<charges_type>();
+}
+
+TEMPLATE_TEST_CASE("ChargesStrided<const T>", "", float, double) {
+    using charges_type = chemist::Charges<TestType>;
+    test_case_guts<const charges_type>();
+}
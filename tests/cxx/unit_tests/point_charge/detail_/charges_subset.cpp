@@ -0,0 +1,178 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../catch.hpp"
+#include <chemist/point_charge/detail_/charges_contiguous.hpp>
+#include <chemist/point_charge/detail_/charges_subset.hpp>
+#include <utility>
+#include <vector>
+
+template<typename ChargesType>
+void test_charges_subset_guts() {
+    using pimpl_type       = chemist::detail_::ChargesSubset<ChargesType>;
+    using view_type        = typename pimpl_type::charges_view_type;
+    using member_list_type = typename pimpl_type::member_list_type;
+    using charges_type     = typename pimpl_type::charges_type;
+    using charge_type      = typename pimpl_type::charge_type;
+    using value_type       = typename charges_type::value_type;
+    using point_set_type   = typename charges_type::point_set_type;
+    using point_type       = typename point_set_type::value_type;
+    using contiguous_type  = chemist::detail_::ChargesContiguous<ChargesType>;
+    using point_set_reference = typename pimpl_type::point_set_reference;
+    using const_point_set_reference =
+      typename pimpl_type::const_point_set_reference;
+
+    value_type q0{-1.1, 0.0, 0.0, 0.0}, q1{2.2, 1.0, 2.0, 3.0},
+      q2{-3.3, 4.0, 5.0, 6.0};
+    charges_type qs{q0, q1, q2};
+    view_type supersystem(qs);
+
+    pimpl_type defaulted;
+    pimpl_type no_charges(supersystem, member_list_type{});
+    pimpl_type reversed(supersystem, member_list_type{2, 1, 0});
+    pimpl_type two_charges(supersystem, member_list_type{0, 2});
+
+    SECTION("Ctors") {
+        SECTION("Default") { REQUIRE(defaulted.size() == 0); }
+
+        SECTION("Value") {
+            REQUIRE(no_charges.size() == 0);
+
+            REQUIRE(reversed.size() == 3);
+            REQUIRE(reversed[0] == q2);
+            REQUIRE(reversed[1] == q1);
+            REQUIRE(reversed[2] == q0);
+
+            REQUIRE(two_charges.size() == 2);
+            REQUIRE(two_charges[0] == q0);
+            REQUIRE(two_charges[1] == q2);
+        }
+
+        SECTION("aliases") {
+            REQUIRE(&reversed[0].charge() == qs.charge_data() + 2);
+            auto px = qs.point_set().x_column().data();
+            REQUIRE(&reversed.point_set()[0].x() == px + 2);
+        }
+
+        SECTION("Copy") {
+            pimpl_type defaulted_copy(defaulted);
+            REQUIRE(defaulted_copy == defaulted);
+
+            pimpl_type reversed_copy(reversed);
+            REQUIRE(reversed_copy == reversed);
+        }
+    }
+
+    SECTION("clone") {
+        auto reversed_copy = reversed.clone();
+        REQUIRE(reversed_copy->are_equal(reversed));
+    }
+
+    SECTION("point_set()") {
+        REQUIRE(defaulted.point_set() == point_set_reference{});
+        REQUIRE(no_charges.point_set() == point_set_reference{});
+
+        point_set_type corr{point_type{0.0, 0.0, 0.0},
+                            point_type{4.0, 5.0, 6.0}};
+        REQUIRE(two_charges.point_set() == point_set_reference{corr});
+    }
+
+    SECTION("point_set() const") {
+        point_set_type corr{point_type{0.0, 0.0, 0.0},
+                            point_type{4.0, 5.0, 6.0}};
+        REQUIRE(std::as_const(two_charges).point_set() ==
+                const_point_set_reference{corr});
+    }
+
+    SECTION("at_() const") {
+        REQUIRE(std::as_const(two_charges)[0] == q0);
+        REQUIRE(std::as_const(two_charges)[1] == q2);
+    }
+
+    SECTION("size_()") {
+        REQUIRE(defaulted.size() == 0);
+        REQUIRE(no_charges.size() == 0);
+        REQUIRE(reversed.size() == 3);
+        REQUIRE(two_charges.size() == 2);
+    }
+
+    SECTION("as_charges") {
+        REQUIRE(two_charges.as_charges() == charges_type{q0, q2});
+        REQUIRE(reversed.as_charges() == charges_type{q2, q1, q0});
+
+        // Subset of a non-contiguous supersystem
+        std::vector<charge_type> xyzq{0.0, 0.0, 0.0, -1.1, 1.0, 2.0,
+                                      3.0, 2.2, 4.0, 5.0, 6.0, -3.3};
+        auto* p             = xyzq.data();
+        const std::size_t s = 4 * sizeof(charge_type);
+        point_set_reference points(3, p, p + 1, p + 2, s);
+        view_type aos(points, p + 3, s);
+        pimpl_type aos_subset(aos, member_list_type{0, 2});
+        REQUIRE(aos_subset.as_charges() == charges_type{q0, q2});
+    }
+
+    SECTION("operator==") {
+        SECTION("Default vs default") { REQUIRE(defaulted == pimpl_type{}); }
+
+        SECTION("Default vs. empty") { REQUIRE(defaulted == no_charges); }
+
+        SECTION("Default vs. non-empty") {
+            REQUIRE_FALSE(defaulted == two_charges);
+        }
+
+        SECTION("Same supersystem, same members") {
+            pimpl_type other(supersystem, member_list_type{0, 2});
+            REQUIRE(two_charges == other);
+        }
+
+        SECTION("Same supersystem, different members") {
+            pimpl_type other(supersystem, member_list_type{2, 0});
+            REQUIRE_FALSE(two_charges == other);
+        }
+
+        SECTION("Same supersystem, different members, same point charges") {
+            charges_type qs2{q0, q1, q0};
+            view_type supersystem2(qs2);
+            pimpl_type lhs(supersystem2, member_list_type{0, 1});
+            pimpl_type rhs(supersystem2, member_list_type{2, 1});
+            REQUIRE(lhs == rhs);
+        }
+
+        SECTION("Different supersystem, same point charges") {
+            charges_type qs2{q2, q0};
+            pimpl_type other(view_type(qs2), member_list_type{1, 0});
+            REQUIRE(two_charges == other);
+        }
+    }
+
+    SECTION("are_equal") {
+        charges_type qs2{q2, q1, q0};
+        contiguous_type contiguous(qs2.point_set(), qs2.charge_data());
+        REQUIRE(reversed.are_equal(contiguous));
+        REQUIRE(contiguous.are_equal(reversed));
+        REQUIRE_FALSE(two_charges.are_equal(contiguous));
+    }
+}
+
+TEMPLATE_TEST_CASE("ChargesSubset<T>", "", float, double) {
+    using charges_type = chemist::Charges<TestType>;
+    test_charges_subset_guts<charges_type>();
+}
+
+TEMPLATE_TEST_CASE("ChargesSubset<const T>", "", float, double) {
+    using charges_type = chemist::Charges<TestType>;
+    test_charges_subset_guts<const charges_type>();
+}
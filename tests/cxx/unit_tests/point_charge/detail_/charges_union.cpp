@@ -0,0 +1,147 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../catch.hpp"
+#include <chemist/point_charge/detail_/charges_contiguous.hpp>
+#include <chemist/point_charge/detail_/charges_union.hpp>
+#include <utility>
+#include <vector>
+
+template<typename ChargesType>
+void test_charges_union_guts() {
+    using pimpl_type          = chemist::detail_::ChargesUnion<ChargesType>;
+    using view_type           = chemist::ChargesView<ChargesType>;
+    using container_type      = typename pimpl_type::charges_view_container;
+    using charges_type        = typename pimpl_type::charges_type;
+    using charge_type         = typename pimpl_type::charge_type;
+    using value_type          = typename charges_type::value_type;
+    using point_set_reference = typename pimpl_type::point_set_reference;
+    using contiguous_type = chemist::detail_::ChargesContiguous<ChargesType>;
+
+    value_type q0{-1.1, 0.0, 0.0, 0.0}, q1{2.2, 1.0, 2.0, 3.0},
+      q2{-3.3, 4.0, 5.0, 6.0};
+    charges_type qs01{q0, q1}, qs2{q2}, none;
+
+    pimpl_type defaulted;
+    pimpl_type no_charges(container_type{});
+    pimpl_type has_values(container_type{view_type(qs01), view_type(qs2)});
+
+    SECTION("Ctors") {
+        SECTION("Default") { REQUIRE(defaulted.size() == 0); }
+
+        SECTION("Value") {
+            REQUIRE(no_charges.size() == 0);
+
+            REQUIRE(has_values.size() == 3);
+            REQUIRE(has_values[0] == q0);
+            REQUIRE(has_values[1] == q1);
+            REQUIRE(has_values[2] == q2);
+
+            // Empty members are skipped over
+            pimpl_type has_empties(container_type{
+              view_type(none), view_type(qs01), view_type(none),
+              view_type(qs2), view_type(none)});
+            REQUIRE(has_empties.size() == 3);
+            REQUIRE(has_empties[0] == q0);
+            REQUIRE(has_empties[1] == q1);
+            REQUIRE(has_empties[2] == q2);
+        }
+
+        SECTION("aliases") {
+            REQUIRE(&has_values[1].charge() == qs01.charge_data() + 1);
+            REQUIRE(&has_values[2].charge() == qs2.charge_data());
+        }
+
+        SECTION("Copy") {
+            pimpl_type defaulted_copy(defaulted);
+            REQUIRE(defaulted_copy == defaulted);
+
+            pimpl_type has_values_copy(has_values);
+            REQUIRE(has_values_copy == has_values);
+        }
+    }
+
+    SECTION("clone") {
+        auto has_values_copy = has_values.clone();
+        REQUIRE(has_values_copy->are_equal(has_values));
+    }
+
+    SECTION("point_set()") {
+        REQUIRE(defaulted.point_set() == point_set_reference{});
+        REQUIRE(no_charges.point_set() == point_set_reference{});
+
+        charges_type corr{q0, q1, q2};
+        REQUIRE(has_values.point_set() == corr.point_set());
+        REQUIRE(std::as_const(has_values).point_set() == corr.point_set());
+    }
+
+    SECTION("at_() const") {
+        REQUIRE(std::as_const(has_values)[0] == q0);
+        REQUIRE(std::as_const(has_values)[2] == q2);
+    }
+
+    SECTION("as_charges") {
+        REQUIRE(has_values.as_charges() == charges_type{q0, q1, q2});
+
+        // Mix in a strided member
+        std::vector<charge_type> xyzq{0.0, 0.0, 0.0, -1.1, 1.0, 2.0,
+                                      3.0, 2.2, 4.0, 5.0, 6.0, -3.3};
+        auto* p             = xyzq.data();
+        const std::size_t s = 4 * sizeof(charge_type);
+        point_set_reference points(3, p, p + 1, p + 2, s);
+        pimpl_type mixed(container_type{view_type(points, p + 3, s),
+                                        view_type(qs01)});
+        REQUIRE(mixed.as_charges() == charges_type{q0, q1, q2, q0, q1});
+    }
+
+    SECTION("operator==") {
+        SECTION("Default vs default") { REQUIRE(defaulted == pimpl_type{}); }
+
+        SECTION("Default vs. empty") { REQUIRE(defaulted == no_charges); }
+
+        SECTION("Default vs. non-empty") {
+            REQUIRE_FALSE(defaulted == has_values);
+        }
+
+        SECTION("Different partition") {
+            charges_type qs0{q0}, qs12{q1, q2};
+            pimpl_type other(container_type{view_type(qs0), view_type(qs12)});
+            REQUIRE(has_values == other);
+        }
+
+        SECTION("Different members") {
+            pimpl_type other(container_type{view_type(qs01)});
+            REQUIRE_FALSE(has_values == other);
+        }
+    }
+
+    SECTION("are_equal") {
+        charges_type qs012{q0, q1, q2};
+        contiguous_type contiguous(qs012.point_set(), qs012.charge_data());
+        REQUIRE(has_values.are_equal(contiguous));
+        REQUIRE(contiguous.are_equal(has_values));
+    }
+}
+
+TEMPLATE_TEST_CASE("ChargesUnion<T>", "", float, double) {
+    using charges_type = chemist::Charges<TestType>;
+    test_charges_union_guts<charges_type>();
+}
+
+TEMPLATE_TEST_CASE("ChargesUnion<const T>", "", float, double) {
+    using charges_type = chemist::Charges<TestType>;
+    test_charges_union_guts<const charges_type>();
+}
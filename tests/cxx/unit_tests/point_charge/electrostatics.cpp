@@ -0,0 +1,201 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/point_charge/electrostatics.hpp>
+#include <cmath>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace chemist;
+
+/* Testing Notes:
+ *
+ * The kernels are checked against a straightforward double loop. The random
+ * sets are large enough that the charges span several tiles.
+ */
+
+namespace {
+
+template<typename T>
+Charges<T> random_charges(std::size_t n, unsigned int seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<T> dist(-10.0, 10.0);
+    Charges<T> rv;
+    for(std::size_t i = 0; i < n; ++i)
+        rv.push_back(PointCharge<T>(dist(gen) / 10, dist(gen), dist(gen),
+                                    dist(gen)));
+    return rv;
+}
+
+template<typename T>
+PointSet<T> random_points(std::size_t n, unsigned int seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<T> dist(-12.0, 12.0);
+    PointSet<T> rv;
+    for(std::size_t i = 0; i < n; ++i)
+        rv.push_back(Point<T>(dist(gen), dist(gen), dist(gen)));
+    return rv;
+}
+
+/// Returns {phi, Ex, Ey, Ez} at @p r computed one charge at a time
+template<typename T>
+std::vector<double> brute_force(const Charges<T>& qs, const Point<T>& r,
+                                double cutoff, double a) {
+    std::vector<double> rv(4, 0.0);
+    for(std::size_t j = 0; j < qs.size(); ++j) {
+        const double dx = r.x() - qs[j].x();
+        const double dy = r.y() - qs[j].y();
+        const double dz = r.z() - qs[j].z();
+        const double r2 = dx * dx + dy * dy + dz * dz;
+        if(r2 > cutoff * cutoff || r2 + a * a == 0.0) continue;
+        const double inv = 1.0 / std::sqrt(r2 + a * a);
+        const double q   = qs[j].charge();
+        rv[0] += q * inv;
+        rv[1] += q * inv * inv * inv * dx;
+        rv[2] += q * inv * inv * inv * dy;
+        rv[3] += q * inv * inv * inv * dz;
+    }
+    return rv;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("electrostatics", "", float, double) {
+    using charges_type = Charges<TestType>;
+    using set_type     = PointSet<TestType>;
+    using point_type   = Point<TestType>;
+    using charge_type  = PointCharge<TestType>;
+
+    const double eps = std::is_same_v<TestType, float> ? 1.0E-3 : 1.0E-10;
+
+    auto qs     = random_charges<TestType>(600, 42);
+    auto points = random_points<TestType>(70, 7);
+
+    // Checks the results for points against brute_force
+    auto check = [&](const std::vector<TestType>& phi,
+                     const std::vector<TestType>& field, double cutoff,
+                     double a) {
+        const auto n = points.size();
+        REQUIRE(phi.size() == n);
+        REQUIRE(field.size() == 3 * n);
+        auto close = [&](double value, double corr) {
+            return std::fabs(value - corr) <= eps * (1.0 + std::fabs(corr));
+        };
+        bool all_good = true;
+        for(std::size_t i = 0; i < n; ++i) {
+            auto corr = brute_force(qs, points[i].as_point(), cutoff, a);
+            all_good  = all_good && close(phi[i], corr[0]) &&
+                       close(field[i], corr[1]) &&
+                       close(field[n + i], corr[2]) &&
+                       close(field[2 * n + i], corr[3]);
+        }
+        REQUIRE(all_good);
+    };
+
+    SECTION("Single charge") {
+        charges_type q1{charge_type(2.0, 0.0, 0.0, 0.0)};
+        set_type r{point_type(2.0, 0.0, 0.0), point_type(0.0, 0.0, -4.0)};
+
+        auto phi = electrostatic_potential(q1, r);
+        REQUIRE(phi[0] == Approx(1.0));
+        REQUIRE(phi[1] == Approx(0.5));
+
+        auto e = electric_field(q1, r);
+        REQUIRE(e[0] == Approx(0.5));
+        REQUIRE(e[5] == Approx(-0.125));
+        REQUIRE(e[1] == Approx(0.0).margin(1.0E-12));
+
+        // Cutoff removes the far charge
+        auto cut = electrostatic_potential(q1, r, TestType(3.0));
+        REQUIRE(cut[0] == Approx(1.0));
+        REQUIRE(cut[1] == TestType(0.0));
+
+        // Smoothing softens the interaction
+        auto soft = electrostatic_potential(q1, r, TestType(10.0),
+                                            TestType(std::sqrt(5.0)));
+        REQUIRE(soft[0] == Approx(2.0 / 3.0));
+    }
+
+    SECTION("Self-interaction is skipped") {
+        charges_type q1{charge_type(2.0, 0.0, 0.0, 0.0)};
+        set_type r{point_type(0.0, 0.0, 0.0)};
+        REQUIRE(electrostatic_potential(q1, r)[0] == TestType(0.0));
+        REQUIRE(electric_field(q1, r)[0] == TestType(0.0));
+
+        // With smoothing the charge contributes q / a
+        auto soft = electrostatic_potential(
+          q1, r, std::numeric_limits<TestType>::infinity(), TestType(2.0));
+        REQUIRE(soft[0] == Approx(1.0));
+    }
+
+    SECTION("Empty") {
+        REQUIRE(electrostatic_potential(charges_type{}, points) ==
+                std::vector<TestType>(points.size(), 0.0));
+        REQUIRE(electric_field(qs, set_type{}).empty());
+    }
+
+    SECTION("Charges/PointSet") {
+        const auto inf = std::numeric_limits<TestType>::infinity();
+        check(electrostatic_potential(qs, points),
+              electric_field(qs, points), inf, 0.0);
+        check(electrostatic_potential(qs, points, TestType(8.0)),
+              electric_field(qs, points, TestType(8.0)), 8.0, 0.0);
+        check(electrostatic_potential(qs, points, TestType(8.0), TestType(0.5)),
+              electric_field(qs, points, TestType(8.0), TestType(0.5)), 8.0,
+              0.5);
+    }
+
+    SECTION("Views") {
+        using charges_view = ChargesView<const charges_type>;
+        using points_view  = PointSetView<const set_type>;
+        const auto inf     = std::numeric_limits<TestType>::infinity();
+        charges_view qv(qs);
+        points_view pv(points);
+        check(electrostatic_potential(qv, pv), electric_field(qv, pv), inf,
+              0.0);
+
+        // Strided charges have to be gathered
+        std::vector<TestType> xyzq;
+        for(const auto& q : qs) {
+            xyzq.push_back(q.x());
+            xyzq.push_back(q.y());
+            xyzq.push_back(q.z());
+            xyzq.push_back(q.charge());
+        }
+        const auto* p       = xyzq.data();
+        const std::size_t s = 4 * sizeof(TestType);
+        points_view qpoints(qs.size(), p, p + 1, p + 2, s);
+        charges_view aos(qpoints, p + 3, s);
+        REQUIRE_FALSE(aos.is_contiguous());
+        check(electrostatic_potential(aos, pv, TestType(8.0)),
+              electric_field(aos, pv, TestType(8.0)), 8.0, 0.0);
+    }
+}
+
+TEST_CASE("electrostatics (Grid)") {
+    auto qs     = random_charges<double>(300, 3);
+    auto points = random_points<double>(40, 5);
+    std::vector<GridPoint> gps;
+    for(const auto& r : points)
+        gps.push_back(GridPoint(1.0, r.x(), r.y(), r.z()));
+    Grid grid(gps.begin(), gps.end());
+
+    REQUIRE(electrostatic_potential(qs, grid, 6.0, 0.1) ==
+            electrostatic_potential(qs, points, 6.0, 0.1));
+    REQUIRE(electric_field(qs, grid) == electric_field(qs, points));
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/point_charge/electrostatics.hpp>
+#include <chemist/point_charge/multipole_tree.hpp>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+using namespace chemist;
+
+/* Testing Notes:
+ *
+ * The approximate results are checked against the direct kernels. The
+ * charges are numerous enough that the tree has several levels, and the
+ * targets are a mix of points inside and far outside the charge cloud.
+ */
+
+namespace {
+
+template<typename T>
+Charges<T> random_charges(std::size_t n, unsigned int seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<T> dist(-10.0, 10.0);
+    Charges<T> rv;
+    for(std::size_t i = 0; i < n; ++i)
+        rv.push_back(PointCharge<T>(dist(gen) / 10, dist(gen), dist(gen),
+                                    dist(gen)));
+    return rv;
+}
+
+template<typename T>
+PointSet<T> random_points(std::size_t n, unsigned int seed, T width) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<T> dist(-width, width);
+    PointSet<T> rv;
+    for(std::size_t i = 0; i < n; ++i)
+        rv.push_back(Point<T>(dist(gen), dist(gen), dist(gen)));
+    return rv;
+}
+
+/// Sum over the charges of |q_j| / |r - r_j|, the scale of the error bound
+template<typename T>
+double abs_potential(const Charges<T>& qs, const Point<T>& r) {
+    double rv = 0.0;
+    for(const auto& q : qs) {
+        const double dx = r.x() - q.x();
+        const double dy = r.y() - q.y();
+        const double dz = r.z() - q.z();
+        const double d  = std::sqrt(dx * dx + dy * dy + dz * dz);
+        if(d > 0.0) rv += std::fabs(double(q.charge())) / d;
+    }
+    return rv;
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("MultipoleTree", "", float, double) {
+    using tree_type    = MultipoleTree<TestType>;
+    using charges_type = Charges<TestType>;
+    using set_type     = PointSet<TestType>;
+    using charge_type  = PointCharge<TestType>;
+    using point_type   = Point<TestType>;
+
+    // Round-off of the summations, on top of the truncation error
+    const double eps = std::is_same_v<TestType, float> ? 1.0E-4 : 1.0E-12;
+
+    auto qs     = random_charges<TestType>(2000, 11);
+    auto inside = random_points<TestType>(40, 13, 10.0);
+    auto far    = random_points<TestType>(20, 17, 100.0);
+    set_type points;
+    for(const auto& r : inside) points.push_back(r.as_point());
+    for(const auto& r : far) points.push_back(r.as_point());
+    // A target sitting on a charge
+    points.push_back(qs[0].as_point());
+
+    tree_type defaulted;
+    tree_type tree(qs);
+
+    SECTION("Ctors") {
+        SECTION("Default") {
+            REQUIRE(defaulted.size() == 0);
+            REQUIRE(defaulted.empty());
+            REQUIRE(defaulted.order() == 0);
+            REQUIRE(defaulted.error_bound() == TestType(0));
+        }
+
+        SECTION("Value") {
+            REQUIRE(tree.size() == qs.size());
+            REQUIRE(tree.order() == 4);
+            REQUIRE(tree.theta() == TestType(0.5));
+            REQUIRE(tree.error_bound() == Approx(1.5 * std::pow(0.5, 5) / 0.5));
+
+            REQUIRE_THROWS_AS(tree_type(qs, 4, TestType(1.0)),
+                              std::runtime_error);
+            REQUIRE_THROWS_AS(tree_type(qs, 4, TestType(-0.1)),
+                              std::runtime_error);
+            REQUIRE_THROWS_AS(tree_type(qs, 4, TestType(0.5), 0),
+                              std::runtime_error);
+        }
+
+        SECTION("ChargesView") {
+            ChargesView<const charges_type> qv(qs);
+            tree_type from_view(qv);
+            REQUIRE(from_view.potential(points) == tree.potential(points));
+        }
+
+        SECTION("Copy") {
+            tree_type copy(tree);
+            REQUIRE(copy.size() == tree.size());
+            REQUIRE(copy.potential(points) == tree.potential(points));
+        }
+
+        SECTION("Move") {
+            auto corr = tree.potential(points);
+            tree_type moved(std::move(tree));
+            REQUIRE(moved.potential(points) == corr);
+        }
+
+        SECTION("Copy assignment") {
+            tree_type copy;
+            auto pcopy = &(copy = tree);
+            REQUIRE(pcopy == &copy);
+            REQUIRE(copy.potential(points) == tree.potential(points));
+        }
+
+        SECTION("Move assignment") {
+            auto corr = tree.potential(points);
+            tree_type moved;
+            auto pmoved = &(moved = std::move(tree));
+            REQUIRE(pmoved == &moved);
+            REQUIRE(moved.potential(points) == corr);
+        }
+    }
+
+    SECTION("potential") {
+        SECTION("Empty tree") {
+            REQUIRE(defaulted.potential(points) ==
+                    std::vector<TestType>(points.size(), 0.0));
+        }
+
+        SECTION("Error bound") {
+            for(std::size_t p : {0, 2, 4, 6}) {
+                tree_type t(qs, p, TestType(0.6), 16);
+                const auto bound = double(t.error_bound());
+                auto approx      = t.potential(points);
+                auto exact       = electrostatic_potential(qs, points);
+                bool all_good    = true;
+                for(std::size_t i = 0; i < points.size(); ++i) {
+                    const auto scale = abs_potential(qs, points[i].as_point());
+                    const auto err = std::fabs(double(approx[i]) - exact[i]);
+                    all_good = all_good && err <= (bound + eps) * scale;
+                }
+                REQUIRE(all_good);
+            }
+        }
+
+        SECTION("Theta of zero is exact") {
+            tree_type t(qs, 4, TestType(0.0));
+            auto approx   = t.potential(points);
+            auto exact    = electrostatic_potential(qs, points);
+            bool all_good = true;
+            for(std::size_t i = 0; i < points.size(); ++i)
+                all_good = all_good &&
+                           std::fabs(double(approx[i]) - exact[i]) <=
+                             eps * abs_potential(qs, points[i].as_point());
+            REQUIRE(all_good);
+        }
+
+        SECTION("Coincident charges") {
+            charges_type same;
+            for(std::size_t i = 0; i < 100; ++i)
+                same.push_back(charge_type(1.0, 1.0, 2.0, 3.0));
+            tree_type t(same, 4, TestType(0.5), 8);
+            set_type r{point_type(1.0, 2.0, 3.0), point_type(1.0, 2.0, 13.0)};
+            auto phi = t.potential(r);
+            REQUIRE(phi[0] == TestType(0.0));
+            REQUIRE(phi[1] == Approx(10.0));
+        }
+
+        SECTION("PointSetView") {
+            PointSetView<const set_type> pv(points);
+            REQUIRE(tree.potential(pv) == tree.potential(points));
+        }
+    }
+
+    SECTION("field") {
+        SECTION("Empty tree") {
+            REQUIRE(defaulted.field(points) ==
+                    std::vector<TestType>(3 * points.size(), 0.0));
+        }
+
+        SECTION("Converges to the direct field") {
+            tree_type t(qs, 8, TestType(0.4));
+            auto approx = t.field(points);
+            auto exact  = electric_field(qs, points);
+            REQUIRE(approx.size() == 3 * points.size());
+            // The field bound has an extra factor of roughly (p + 1) / R
+            const double tol = std::is_same_v<TestType, float> ? 1.0E-3 :
+                                                                 1.0E-4;
+            bool all_good    = true;
+            for(std::size_t i = 0; i < approx.size(); ++i)
+                all_good = all_good &&
+                           std::fabs(double(approx[i]) - exact[i]) <=
+                             tol * (1.0 + std::fabs(double(exact[i])));
+            REQUIRE(all_good);
+        }
+
+        SECTION("PointSetView") {
+            PointSetView<const set_type> pv(points);
+            REQUIRE(tree.field(pv) == tree.field(points));
+        }
+    }
+
+    SECTION("swap") {
+        auto corr = tree.potential(points);
+        defaulted.swap(tree);
+        REQUIRE(defaulted.potential(points) == corr);
+        REQUIRE(tree.empty());
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/topology/bond_perception.hpp>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using namespace chemist;
+using namespace chemist::topology;
+
+namespace {
+
+/// Perceives the bonds of @p nuclei by comparing every pair of nuclei
+ConnectivityTable brute_force(const Nuclei& nuclei, double tolerance) {
+    ConnectivityTable rv(nuclei.size());
+    for(std::size_t i = 0; i < nuclei.size(); ++i) {
+        for(std::size_t j = i + 1; j < nuclei.size(); ++j) {
+            const auto r_i    = element(nuclei[i].Z()).covalent_radius_au();
+            const auto r_j    = element(nuclei[j].Z()).covalent_radius_au();
+            const auto dx     = nuclei[i].x() - nuclei[j].x();
+            const auto dy     = nuclei[i].y() - nuclei[j].y();
+            const auto dz     = nuclei[i].z() - nuclei[j].z();
+            const auto cutoff = r_i + r_j + tolerance;
+            if(std::sqrt(dx * dx + dy * dy + dz * dz) <= cutoff)
+                rv.add_bond(i, j);
+        }
+    }
+    return rv;
+}
+
+/// A cube of @p n by @p n by @p n water molecules
+Nuclei water_box(std::size_t n) {
+    const double spacing = 5.5;
+    Nuclei rv;
+    for(std::size_t i = 0; i < n; ++i) {
+        for(std::size_t j = 0; j < n; ++j) {
+            for(std::size_t k = 0; k < n; ++k) {
+                const double x = i * spacing, y = j * spacing, z = k * spacing;
+                rv.push_back(make_nucleus(8ul, x, y, z));
+                rv.push_back(make_nucleus(1ul, x, y + 1.43, z + 1.40));
+                rv.push_back(make_nucleus(1ul, x, y - 1.43, z + 1.40));
+            }
+        }
+    }
+    return rv;
+}
+
+} // namespace
+
+TEST_CASE("BondPerception") {
+    using index_list_type  = typename BondPerception::index_list_type;
+    using offset_pair      = typename ConnectivityTable::offset_pair;
+    using offset_pair_list = typename ConnectivityTable::offset_pair_list;
+
+    auto water = water_box(1);
+
+    SECTION("Ctors") {
+        BondPerception empty(Nuclei{});
+        REQUIRE(empty.natoms() == 0);
+        REQUIRE(empty.connectivity() == ConnectivityTable(0));
+
+        BondPerception p(water);
+        REQUIRE(p.natoms() == 3);
+        REQUIRE(p.tolerance() == BondPerception::default_tolerance);
+        offset_pair_list corr{offset_pair{0, 1}, offset_pair{0, 2}};
+        REQUIRE(p.connectivity().bonds() == corr);
+
+        // With no tolerance the O-H bonds are too long
+        REQUIRE(BondPerception(water, 0.0).connectivity().nbonds() == 0);
+
+        Molecule mol(0, 1, water);
+        REQUIRE(BondPerception(mol).connectivity() == p.connectivity());
+
+        REQUIRE_THROWS_AS(BondPerception(water, -1.0), std::runtime_error);
+    }
+
+    SECTION("Atoms which aren't elements aren't bonded") {
+        water.push_back(Nucleus("X", 0ul, 0.0, 0.0, 0.0, 1.0));
+        BondPerception p(water);
+        REQUIRE(p.connectivity().nbonds() == 2);
+        REQUIRE(p.connectivity().bonded_atoms(3).empty());
+    }
+
+    SECTION("Agrees with brute force") {
+        // Large enough to be threaded
+        auto box = water_box(7);
+        // Squeeze two molecules together so there are some extra bonds
+        box[3].x() = 1.0;
+        box[3].z() = 2.0;
+        for(double tol : {0.0, 0.5, BondPerception::default_tolerance, 3.0}) {
+            BondPerception p(box, tol);
+            REQUIRE(p.connectivity() == brute_force(box, tol));
+        }
+    }
+
+    SECTION("update") {
+        auto box = water_box(7);
+        BondPerception p(box);
+        const auto nbonds = p.connectivity().nbonds();
+
+        // update reads the coordinates in place, which requires this
+        REQUIRE(box.charges().point_set().is_contiguous());
+
+        // Pull a hydrogen off of the first water
+        box[1].y() = -4.0;
+        p.update(box, index_list_type{1});
+        REQUIRE(p.connectivity().nbonds() == nbonds - 1);
+        REQUIRE(p.connectivity() == brute_force(box, p.tolerance()));
+
+        // Move a whole molecule next to another molecule
+        index_list_type moved{3, 4, 5};
+        for(auto i : moved) box[i].x() = box[i].x() + 4.0;
+        p.update(box, moved);
+        REQUIRE(p.connectivity() == brute_force(box, p.tolerance()));
+        REQUIRE(p.connectivity() == BondPerception(box).connectivity());
+
+        // Put everything back
+        box = water_box(7);
+        p.update(Molecule(0, 1, box), index_list_type{1, 3, 4, 5});
+        REQUIRE(p.connectivity().nbonds() == nbonds);
+        REQUIRE(p.connectivity() == BondPerception(box).connectivity());
+
+        REQUIRE_THROWS_AS(p.update(water, index_list_type{}),
+                          std::runtime_error);
+        REQUIRE_THROWS_AS(p.update(box, index_list_type{box.size()}),
+                          std::out_of_range);
+    }
+}
+
+TEST_CASE("perceive_bonds") {
+    auto water = water_box(2);
+    auto corr  = BondPerception(water).connectivity();
+    REQUIRE(perceive_bonds(water) == corr);
+    REQUIRE(perceive_bonds(Molecule(0, 1, water)) == corr);
+    REQUIRE(perceive_bonds(water, 0.0) == ConnectivityTable(water.size()));
+}
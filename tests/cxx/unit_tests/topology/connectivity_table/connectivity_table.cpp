@@ -172,6 +172,21 @@ TEST_CASE("ConnectivityTable") {
         }
     }
 
+    SECTION("remove_bond") {
+        t3.add_bond(0, 1);
+        t3.add_bond(1, 2);
+        t3.remove_bond(1, 0);
+        REQUIRE(t3.nbonds() == 1);
+        REQUIRE(t3.bonds() == offset_pair_list{offset_pair{1, 2}});
+
+        // Removing a bond which isn't there is a no-op
+        t3.remove_bond(0, 1);
+        REQUIRE(t3.nbonds() == 1);
+
+        REQUIRE_THROWS_AS(t3.remove_bond(0, 3), std::out_of_range);
+        REQUIRE_THROWS_AS(t3.remove_bond(1, 1), std::out_of_range);
+    }
+
     SECTION("bonded_atoms") {
         REQUIRE_THROWS_AS(t.bonded_atoms(0), std::out_of_range);
         REQUIRE_THROWS_AS(t0.bonded_atoms(0), std::out_of_range);
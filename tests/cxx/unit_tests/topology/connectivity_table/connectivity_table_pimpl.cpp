@@ -134,6 +134,21 @@ TEST_CASE("ConnectivityTablePIMPL") {
         }
     }
 
+    SECTION("remove_bond") {
+        p3.add_bond(0, 1);
+        p3.add_bond(0, 2);
+        p3.remove_bond(2, 0);
+        REQUIRE(p3.nbonds() == 1);
+        REQUIRE(p3.are_bonded(0, 1));
+        REQUIRE_FALSE(p3.are_bonded(0, 2));
+
+        p3.remove_bond(1, 2);
+        REQUIRE(p3.nbonds() == 1);
+
+        REQUIRE_THROWS_AS(p3.remove_bond(0, 3), std::out_of_range);
+        REQUIRE_THROWS_AS(p3.remove_bond(0, 0), std::out_of_range);
+    }
+
     SECTION("bonds") {
         SECTION("No bonds") { REQUIRE(p0.bonds() == offset_pair_list{}); }
 
@@ -162,5 +177,47 @@ TEST_CASE("ConnectivityTablePIMPL") {
 
             REQUIRE(p3.bonds() == corr);
         }
+
+        SECTION("Bonds added out of order") {
+            ConnectivityTablePIMPL p5(5);
+            p5.add_bond(4, 2);
+            p5.add_bond(3, 0);
+            p5.add_bond(2, 0);
+            p5.add_bond(1, 4);
+
+            offset_pair_list corr{offset_pair{0, 2}, offset_pair{0, 3},
+                                  offset_pair{1, 4}, offset_pair{2, 4}};
+            REQUIRE(p5.bonds() == corr);
+        }
+    }
+
+    SECTION("bonded_atoms") {
+        using neighbor_list = typename ConnectivityTablePIMPL::neighbor_list;
+        REQUIRE_THROWS_AS(p0.bonded_atoms(0), std::out_of_range);
+        REQUIRE(p1.bonded_atoms(0) == neighbor_list{});
+
+        p3.add_bond(2, 1);
+        p3.add_bond(2, 0);
+        REQUIRE(p3.bonded_atoms(0) == neighbor_list{2});
+        REQUIRE(p3.bonded_atoms(1) == neighbor_list{2});
+        REQUIRE(p3.bonded_atoms(2) == neighbor_list{0, 1});
+    }
+
+    SECTION("Large, sparse table") {
+        // A chain of atoms, which would need 10^10 elements if stored densely
+        const size_type natoms = 100000;
+        ConnectivityTablePIMPL chain(natoms);
+        for(size_type i = 1; i < natoms; ++i) chain.add_bond(i, i - 1);
+
+        REQUIRE(chain.nbonds() == natoms - 1);
+        REQUIRE(chain.are_bonded(500, 501));
+        REQUIRE_FALSE(chain.are_bonded(500, 502));
+        auto bonds = chain.bonds();
+        REQUIRE(bonds.size() == natoms - 1);
+        REQUIRE(bonds.front() == offset_pair{0, 1});
+        REQUIRE(bonds.back() == offset_pair{natoms - 2, natoms - 1});
+
+        chain.set_natoms(2);
+        REQUIRE(chain.nbonds() == 0);
     }
 }
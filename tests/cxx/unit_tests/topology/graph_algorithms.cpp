@@ -0,0 +1,230 @@
+/*
+ * Copyright 2025 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../catch.hpp"
+#include <chemist/topology/graph_algorithms.hpp>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+using namespace chemist::topology;
+
+using size_type        = graph_size_type;
+using offset_pair      = typename ConnectivityTable::offset_pair;
+using offset_pair_list = typename ConnectivityTable::offset_pair_list;
+
+namespace {
+
+using bond_list = std::initializer_list<std::pair<size_type, size_type>>;
+
+/// Makes a table for @p natoms atoms with bonds @p bonds
+ConnectivityTable make_table(size_type natoms, bond_list bonds) {
+    ConnectivityTable rv(natoms);
+    for(const auto& [i, j] : bonds) rv.add_bond(i, j);
+    return rv;
+}
+
+/// A chain of @p natoms atoms
+ConnectivityTable chain(size_type natoms) {
+    ConnectivityTable rv(natoms);
+    for(size_type i = 1; i < natoms; ++i) rv.add_bond(i - 1, i);
+    return rv;
+}
+
+} // namespace
+
+TEST_CASE("ConnectivityTable::neighbors") {
+    auto t = make_table(3, {{2, 0}, {1, 2}});
+    REQUIRE(t.neighbors(0).size() == 1);
+    REQUIRE(t.neighbors(2)[0] == 0);
+    REQUIRE(t.neighbors(2)[1] == 1);
+    REQUIRE_THROWS_AS(t.neighbors(3), std::out_of_range);
+    REQUIRE_THROWS_AS(ConnectivityTable{}.neighbors(0), std::out_of_range);
+}
+
+TEST_CASE("connected_components") {
+    SECTION("Empty") {
+        REQUIRE(component_labels(ConnectivityTable{}).empty());
+        REQUIRE(connected_components(ConnectivityTable{}).empty());
+    }
+
+    SECTION("Several components") {
+        // 0-3-5, 1-4, and 2 on its own
+        auto t = make_table(6, {{5, 3}, {0, 3}, {1, 4}});
+        REQUIRE(component_labels(t) == atom_list_type{0, 1, 2, 0, 1, 0});
+        atom_list_set_type corr{{0, 3, 5}, {1, 4}, {2}};
+        REQUIRE(connected_components(t) == corr);
+    }
+}
+
+TEST_CASE("k_hop_neighborhood") {
+    auto t = chain(5);
+
+    REQUIRE(k_hop_neighborhood(t, 2, 0) == atom_list_type{2});
+    REQUIRE(k_hop_neighborhood(t, 2, 1) == atom_list_type{1, 2, 3});
+    REQUIRE(k_hop_neighborhood(t, 0, 2) == atom_list_type{0, 1, 2});
+    REQUIRE(k_hop_neighborhood(t, 4, 10) == atom_list_type{0, 1, 2, 3, 4});
+    REQUIRE_THROWS_AS(k_hop_neighborhood(t, 5, 1), std::out_of_range);
+
+    SECTION("Batched") {
+        // Enough seeds to be threaded
+        auto long_chain = chain(200);
+        atom_list_type seeds;
+        for(size_type i = 0; i < 200; i += 2) seeds.push_back(i);
+        auto neighborhoods = k_hop_neighborhoods(long_chain, seeds, 3);
+        REQUIRE(neighborhoods.size() == seeds.size());
+        for(size_type s = 0; s < seeds.size(); ++s)
+            REQUIRE(neighborhoods[s] ==
+                    k_hop_neighborhood(long_chain, seeds[s], 3));
+
+        REQUIRE(k_hop_neighborhoods(t, atom_list_type{}, 1).empty());
+        REQUIRE_THROWS_AS(k_hop_neighborhoods(t, atom_list_type{0, 5}, 1),
+                          std::out_of_range);
+    }
+}
+
+TEST_CASE("shortest_path") {
+    // A five-membered ring, 0-1-2-3-4-0, with 5 hanging off 2 and 6 alone
+    auto t = make_table(7, {{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}, {2, 5}});
+
+    REQUIRE(shortest_path(t, 3, 3) == atom_list_type{3});
+    REQUIRE(shortest_path(t, 0, 2) == atom_list_type{0, 1, 2});
+    REQUIRE(shortest_path(t, 0, 3) == atom_list_type{0, 4, 3});
+    REQUIRE(shortest_path(t, 5, 4) == atom_list_type{5, 2, 3, 4});
+    REQUIRE(shortest_path(t, 0, 6).empty());
+    REQUIRE_THROWS_AS(shortest_path(t, 0, 7), std::out_of_range);
+
+    SECTION("Batched") {
+        offset_pair_list pairs;
+        for(size_type i = 0; i < 7; ++i)
+            for(size_type j = 0; j < 7; ++j) pairs.push_back(offset_pair{i, j});
+        auto paths = shortest_paths(t, pairs);
+        REQUIRE(paths.size() == pairs.size());
+        for(size_type p = 0; p < pairs.size(); ++p)
+            REQUIRE(paths[p] == shortest_path(t, pairs[p][0], pairs[p][1]));
+
+        REQUIRE_THROWS_AS(shortest_paths(t, offset_pair_list{{0, 7}}),
+                          std::out_of_range);
+    }
+}
+
+TEST_CASE("smallest_set_of_smallest_rings") {
+    SECTION("No rings") {
+        REQUIRE(smallest_set_of_smallest_rings(ConnectivityTable{}).empty());
+        REQUIRE(smallest_set_of_smallest_rings(chain(10)).empty());
+    }
+
+    SECTION("Benzene ring with a substituent") {
+        auto t = make_table(
+          7, {{3, 4}, {0, 5}, {1, 2}, {4, 5}, {0, 1}, {2, 3}, {3, 6}});
+        atom_list_set_type corr{{0, 1, 2, 3, 4, 5}};
+        REQUIRE(smallest_set_of_smallest_rings(t) == corr);
+    }
+
+    SECTION("Naphthalene") {
+        auto t = make_table(10, {{0, 1},
+                                 {1, 2},
+                                 {2, 3},
+                                 {3, 4},
+                                 {4, 5},
+                                 {5, 0},
+                                 {4, 6},
+                                 {6, 7},
+                                 {7, 8},
+                                 {8, 9},
+                                 {9, 5}});
+        atom_list_set_type corr{{0, 1, 2, 3, 4, 5}, {4, 5, 9, 8, 7, 6}};
+        REQUIRE(smallest_set_of_smallest_rings(t) == corr);
+    }
+
+    SECTION("Spiro compound and a bridge") {
+        // Three-membered ring 0-1-2 shares atom 2 with the four-membered ring
+        // 2-3-4-5, which is connected to the three-membered ring 7-8-9 by 6
+        auto t = make_table(10, {{0, 1},
+                                 {1, 2},
+                                 {2, 0},
+                                 {2, 3},
+                                 {3, 4},
+                                 {4, 5},
+                                 {5, 2},
+                                 {5, 6},
+                                 {6, 7},
+                                 {7, 8},
+                                 {8, 9},
+                                 {9, 7}});
+        atom_list_set_type corr{{0, 1, 2}, {7, 8, 9}, {2, 3, 4, 5}};
+        REQUIRE(smallest_set_of_smallest_rings(t) == corr);
+    }
+
+    SECTION("Cubane") {
+        auto t     = make_table(8, {{0, 1},
+                                    {1, 2},
+                                    {2, 3},
+                                    {3, 0},
+                                    {4, 5},
+                                    {5, 6},
+                                    {6, 7},
+                                    {7, 4},
+                                    {0, 4},
+                                    {1, 5},
+                                    {2, 6},
+                                    {3, 7}});
+        auto rings = smallest_set_of_smallest_rings(t);
+        REQUIRE(rings.size() == 5);
+        for(const auto& ring : rings) {
+            REQUIRE(ring.size() == 4);
+            for(size_type i = 0; i < 4; ++i)
+                REQUIRE(t.bonded_atoms(ring[i]).count(ring[(i + 1) % 4]));
+        }
+    }
+
+    SECTION("Large fused ring system") {
+        // A graphene-like sheet of ~6500 atoms, as a brick wall: rows of
+        // atoms joined by every other vertical bond. All of it is one ring
+        // block, which must not need memory quadratic in its size.
+        const size_type n_rows = 80, n_cols = 81;
+        auto atom = [=](size_type r, size_type c) { return r * n_cols + c; };
+        ConnectivityTable t(n_rows * n_cols);
+        for(size_type r = 0; r < n_rows; ++r) {
+            for(size_type c = 0; c < n_cols; ++c) {
+                if(c + 1 < n_cols) t.add_bond(atom(r, c), atom(r, c + 1));
+                if(r + 1 < n_rows && (r + c) % 2 == 0)
+                    t.add_bond(atom(r, c), atom(r + 1, c));
+            }
+        }
+        auto rings = smallest_set_of_smallest_rings(t);
+        REQUIRE(rings.size() == t.nbonds() - t.natoms() + 1);
+        for(const auto& ring : rings) REQUIRE(ring.size() == 6);
+    }
+
+    SECTION("Many ring systems") {
+        // Enough separate rings to be threaded, linked into a chain
+        const size_type n_rings = 100;
+        ConnectivityTable t(6 * n_rings);
+        for(size_type r = 0; r < n_rings; ++r) {
+            for(size_type i = 0; i < 6; ++i)
+                t.add_bond(6 * r + i, 6 * r + (i + 1) % 6);
+            if(r) t.add_bond(6 * r - 3, 6 * r);
+        }
+        auto rings = smallest_set_of_smallest_rings(t);
+        REQUIRE(rings.size() == n_rings);
+        for(size_type r = 0; r < n_rings; ++r) {
+            const auto o = 6 * r;
+            REQUIRE(rings[r] ==
+                    atom_list_type{o, o + 1, o + 2, o + 3, o + 4, o + 5});
+        }
+    }
+}
@@ -63,6 +63,21 @@ class TestCapSet(unittest.TestCase):
         self.has_values[1] = self.cap0
         self.assertEqual(self.has_values[1], self.cap0)
 
+    def test_set_cap(self):
+        self.has_values.set_cap(0, self.cap1)
+        self.assertEqual(self.has_values[0], self.cap1)
+        self.assertRaises(IndexError, self.has_values.set_cap, 2, self.cap0)
+
+    def test_set_anchor_index(self):
+        self.has_values.set_anchor_index(1, 3)
+        self.assertEqual(self.has_values[1], Cap(3, 2))
+        self.assertRaises(IndexError, self.has_values.set_anchor_index, 2, 0)
+
+    def test_set_replaced_index(self):
+        self.has_values.set_replaced_index(1, 3)
+        self.assertEqual(self.has_values[1], Cap(1, 3))
+        self.assertRaises(IndexError, self.has_values.set_replaced_index, 2, 0)
+
     def test_size(self):
         self.assertEqual(len(self.defaulted), 0)
         self.assertEqual(self.defaulted.size(), 0)
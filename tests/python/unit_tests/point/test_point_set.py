@@ -14,11 +14,25 @@
 
 import unittest
 
+import numpy as np
 from chemist import PointD, PointF, PointSetD, PointSetF
 
 
 def make_test_point_set(point_type, point_set_type):
     class TestPointSet(unittest.TestCase):
+        def test_array_ctor(self):
+            from_lists = point_set_type([0.0, 1.0], [0.0, 2.0], [0.0, 3.0])
+            self.assertEqual(from_lists, self.has_value)
+
+            from_arrays = point_set_type(
+                np.array([0.0, 1.0]), np.array([0.0, 2.0]), np.array([0.0, 3.0])
+            )
+            self.assertEqual(from_arrays, self.has_value)
+
+            self.assertRaises(
+                RuntimeError, point_set_type, [0.0], [0.0, 2.0], [0.0, 3.0]
+            )
+
         def test_empty(self):
             self.assertTrue(self.defaulted.empty())
             self.assertFalse(self.has_value.empty())